@@ -111,6 +111,7 @@ bool AppBasketTrading::OnInit() {
   FrameMain::vpItems_t vItems;
   typedef FrameMain::structMenuItem mi;  // vxWidgets takes ownership of the objects
   vItems.push_back( new mi( "Test Selection", MakeDelegate( this, &AppBasketTrading::HandleMenuActionTestSelection ) ) );
+  vItems.push_back( new mi( "Update Daily Bar Panel", MakeDelegate( this, &AppBasketTrading::HandleMenuActionUpdatePanel ) ) );
   m_pFrameMain->AddDynamicMenu( "Actions", vItems );
 
 
@@ -165,6 +166,14 @@ void AppBasketTrading::HandleMenuActionTestSelectionDone( void ) {
   std::cout << "Selection Test Done" << std::endl;
 }
 
+void AppBasketTrading::HandleMenuActionUpdatePanel( void ) {
+  if ( 0 != m_pWorker ) m_pWorker->Join();  // its selection has the file open read only
+  std::cout << "Updating Daily Bar Panel ... " << std::endl;
+  if ( !SymbolSelection::UpdatePanel() ) {
+    std::cout << "Daily Bar Panel not updated" << std::endl;
+  }
+}
+
 void AppBasketTrading::HandleStopButton(void) {
   m_ManagePortfolio.Stop();
 }
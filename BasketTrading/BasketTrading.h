@@ -112,6 +112,7 @@ private:
 
   void HandleMenuActionTestSelection( void );
   void HandleMenuActionTestSelectionDone( void );
+  void HandleMenuActionUpdatePanel( void );
 
 };
 
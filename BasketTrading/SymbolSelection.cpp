@@ -19,8 +19,9 @@
 #include <vector>
 #include <math.h>
 
-#include <TFHDF5TimeSeries/HDF5IterateGroups.h>
-#include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+#include <boost/bind.hpp>
+
+#include <TFHDF5TimeSeries/HDF5DailyBarPanel.h>
 
 #include <TFIndicators/Darvas.h>
 #include <TFIndicators/Pivots.h>
@@ -48,14 +49,44 @@ void SymbolSelection::Process( setInstrumentInfo_t& selected ) {
 
   std::cout << "Running" << std::endl;
 
-  ou::tf::HDF5IterateGroups groups;
-
-  groups.SetOnHandleObject( MakeDelegate( this, &SymbolSelection::ProcessGroupItem ) );
+  // 2026/10/18 screened as a sweep over the daily bar panel, a column per field per symbol,
+  //   rather than reading each symbol's dataset, bars newer than the saved panel are folded in, in memory only,
+  //   the file is read only here, UpdatePanel is the maintenance step which saves the panel
+  ou::tf::DailyBarPanel panel;
+  ou::tf::HDF5DailyBarPanel hdf5Panel( m_dm, panel );
   try {
-    int result = groups.Start( "/bar/86400/" );
+    if ( !hdf5Panel.Load( m_dtDateOfFirstBar.date() ) ) {
+      std::cout << "SymbolSelection: no daily bar panel in " << hdf5Panel.Group() << ", UpdatePanel saves one" << std::endl;
+    }
+    const unsigned int nUpdated = hdf5Panel.Update();
+    if ( 0 != nUpdated ) {
+      std::cout << "SymbolSelection: " << nUpdated << " symbols have bars newer than the saved panel" << std::endl;
+    }
   }
-  catch (...) {
-    std::cout << "ouch" << std::endl;
+  catch ( H5::Exception& e ) {
+    std::cout << "SymbolSelection::Process " << hdf5Panel.Group() << ": " << e.getDetailMsg() << std::endl;
+    std::cout << "History not scanned." << std::endl;
+    return;
+  }
+
+  typedef ou::tf::DailyBarPanel::size_type size_type;
+  const size_type ixBegin = panel.LowerBound( m_dtDateOfFirstBar.date() );
+  const size_type ixEnd = panel.LowerBound( m_dtEnd.date() );
+  if ( ( ixBegin < ixEnd ) && ( m_dtLast.date() == panel.Date( ixEnd - 1 ) ) ) { // a symbol's last bar needs to be on m_dtLast
+    std::vector<size_type> vSelected;
+    panel.Select( ixBegin, ixEnd, boost::bind( &SymbolSelection::Screen, this, _1 ), vSelected );
+    ou::tf::Bars bars;
+    for ( std::vector<size_type>::const_iterator iter = vSelected.begin(); vSelected.end() != iter; ++iter ) {
+      panel.Bars( *iter, ixBegin, ixEnd, bars );
+      InstrumentInfo ii( panel.Symbol( *iter ), *bars.Last() );
+//      if ( ( 120 < bars.Size() ) ) {
+//        CheckForDarvas( ii, bars.begin(), bars.end() );
+//      }
+      CheckFor10Percent( ii, bars.end() - 20, bars.end() );
+//      CheckForVolatility( ii, bars.end() - 20, bars.end() );
+//      CheckForPivots( ii, bars.end() - m_nMinPivotBars, bars.end() );
+//      CheckForRange( ii, bars.end() - m_nMinPivotBars, bars.end() );
+    }
   }
 
 //  WrapUp10Percent(selected);
@@ -66,6 +97,32 @@ void SymbolSelection::Process( setInstrumentInfo_t& selected ) {
 
 }
 
+bool SymbolSelection::UpdatePanel( void ) {
+  bool bOk( false );
+  std::string sGroup;
+  try {
+    ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+    ou::tf::DailyBarPanel panel;
+    ou::tf::HDF5DailyBarPanel hdf5Panel( dm, panel );
+    sGroup = hdf5Panel.Group();
+    hdf5Panel.Load();  // the whole panel, a window can't be saved
+    const unsigned int nUpdated = hdf5Panel.Update();
+    hdf5Panel.Save();
+    std::cout
+      << "Daily bar panel " << sGroup << ": " << nUpdated << " symbols updated, "
+      << panel.Symbols() << " symbols over " << panel.Dates() << " dates"
+      << std::endl;
+    bOk = true;
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "SymbolSelection::UpdatePanel " << sGroup << ": " << e.getDetailMsg() << std::endl;
+  }
+  catch ( std::runtime_error& e ) {
+    std::cout << "SymbolSelection::UpdatePanel " << sGroup << ": " << e.what() << std::endl;
+  }
+  return bOk;
+}
+
 struct AverageVolume {
 private:
   ou::tf::Bar::volume_t m_nTotalVolume;
@@ -94,36 +151,22 @@ public:
   operator double() { return m_dblSumOfPrices / m_nNumberOfValues; };
 };
 
-void SymbolSelection::ProcessGroupItem( const std::string& sObjectPath, const std::string& sObjectName ) {
-//  std::cout << sObjectName << std::endl;
-  ou::tf::HDF5TimeSeriesContainer<ou::tf::Bar> barRepository( m_dm, sObjectPath );
-  ou::tf::HDF5TimeSeriesContainer<ou::tf::Bar>::iterator begin, end;
-  begin = lower_bound( barRepository.begin(), barRepository.end(), m_dtDateOfFirstBar );
-  end = lower_bound( begin, barRepository.end(), m_dtEnd ); 
-  hsize_t cnt = end - begin;
-  if ( m_nMinPivotBars <= cnt ) {
-    ptime dttmp = (*(end-1)).DateTime();
-//    std::cout << sObjectName << m_dtLast << ", " << dttmp << std::endl;
-      ou::tf::Bars bars;
-      bars.Resize( cnt );
-      barRepository.Read( begin, end, &bars );
-      ou::tf::Bars::const_iterator iterVolume = bars.end() - m_nMinPivotBars;
-      ou::tf::Bar::volume_t volAverage = std::for_each( iterVolume, bars.end(), AverageVolume() );
-      if ( ( 1000000 < volAverage ) 
-        && ( 15.0 <= bars.Last()->Close() )
-        && ( 90.0 >= bars.Last()->Close() ) 
-        && ( m_dtLast.date() == bars.Last()->DateTime().date() )
-        ) {
-          InstrumentInfo ii( sObjectName, *bars.Last() );
-//          if ( ( 120 < cnt ) && ( dttmp.date() == m_dtLast.date() ) ) {
-//            CheckForDarvas( ii, bars.begin(), bars.end() );
-//          }
-          CheckFor10Percent( ii, bars.end() - 20, bars.end() );
-//          CheckForVolatility( ii, bars.end() - 20, bars.end() );
-//          CheckForPivots( ii, bars.end() - m_nMinPivotBars, bars.end() );
-//          CheckForRange( ii, bars.end() - m_nMinPivotBars, bars.end() );
-      }
+// the symbol's column over [m_dtDateOfFirstBar, m_dtEnd): at least m_nMinPivotBars bars, the last one on m_dtLast,
+//   average volume of the last m_nMinPivotBars over 1000000, closing between 15 and 90
+bool SymbolSelection::Screen( const ou::tf::DailyBarPanel::Column& column ) const {
+  if ( column.Empty() || ( column.n - 1 != column.ixLast ) ) return false;
+  const double dblClose = column.Close()[ column.ixLast ];
+  if ( ( 15.0 > dblClose ) || ( 90.0 < dblClose ) ) return false;
+  const double* pVolume = column.Volume();
+  double dblVolume( 0 );
+  ou::tf::Bars::size_type cnt( 0 );
+  for ( size_t ix = column.ixLast + 1; ( ix > column.ixFirst ) && ( m_nMinPivotBars > cnt ); --ix ) {
+    if ( !ou::tf::DailyBarPanel::Missing( pVolume[ ix - 1 ] ) ) {
+      dblVolume += pVolume[ ix - 1 ];
+      ++cnt;
+    }
   }
+  return ( m_nMinPivotBars <= cnt ) && ( 1000000.0 < ( dblVolume / cnt ) );
 }
 
 void SymbolSelection::CheckForRange( const InstrumentInfo& ii, citer begin, citer end ) {
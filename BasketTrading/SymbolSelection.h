@@ -22,6 +22,7 @@ using namespace boost::posix_time;
 using namespace boost::gregorian;
 
 #include <TFTimeSeries/TimeSeries.h>
+#include <TFTimeSeries/DailyBarPanel.h>
 #include <TFHDF5TimeSeries/HDF5DataManager.h>
 
 class SymbolSelection {
@@ -42,7 +43,11 @@ public:
   explicit SymbolSelection( ptime eod );
   ~SymbolSelection( void );
 
-  void Process( setInstrumentInfo_t& selected );
+  void Process( setInstrumentInfo_t& selected );  // the hdf5 file is opened read only
+
+  // 2026/10/18 maintenance: brings the saved daily bar panel up to date for Process, false with the error reported
+  //   the file is opened read/write, so no SymbolSelection should be running
+  static bool UpdatePanel( void );
 
 protected:
 private:
@@ -84,7 +89,7 @@ private:
 
   mapRankingPos_t m_mapMaxVolatility;
   
-  void ProcessGroupItem( const std::string& sObjectPath, const std::string& sObjectName );
+  bool Screen( const ou::tf::DailyBarPanel::Column& column ) const;
 
   typedef ou::tf::Bars::const_iterator citer;
   void CheckForDarvas( const InstrumentInfo& sSymbol, citer begin, citer end );
@@ -42,7 +42,7 @@ public:
     }
   }
 
-  void Join( void ) { m_pThread->join(); };
+  void Join( void ) { if ( m_pThread->joinable() ) m_pThread->join(); };  // 2026/10/18 may be called again once done
   void operator()( void );
 
 protected:
@@ -0,0 +1,263 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+// times the queues of TFTimeSeries/DoubleBuffer.h against the mutex guarded std::queue they replaced,
+//   which is kept below, as it was, in ns per entry, with 16 byte entries, as a Price
+//   push: one thread pushes a batch, then drains it, the cost of Push and Drain without a second thread
+//   spsc: one producer thread, the consumer drains as it runs, until it has every entry
+//   mpsc: the producers given, the same, not for SpscQueue, as it takes one producer
+//   chart: as charting a watch list, one feed thread appends to a queue per symbol in turn,
+//     the consumer syncs every symbol, as a render does, count is the total over the symbols
+//   each line also checks the consumer saw every entry, in order for each producer, the exit status is 1 if not
+// options:
+//   --count n : entries per producer, --producers n : for mpsc, --symbols n : for chart, --rounds n : best of
+
+#include <queue>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/chrono.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+
+#include <TFTimeSeries/DoubleBuffer.h>
+
+namespace {
+
+struct Datum {  // as a Price, a time and a value
+  boost::int64_t nProducer;
+  double dblSequence;
+  Datum( void ): nProducer( 0 ), dblSequence( 0.0 ) {};
+  Datum( boost::int64_t nProducer_, double dblSequence_ ): nProducer( nProducer_ ), dblSequence( dblSequence_ ) {};
+};
+
+namespace previous { // Queue before the lock free queues
+
+template<typename datum_t>
+class Queue {
+  typedef std::queue<datum_t> qDatum_t;
+public:
+  Queue( void ) {}
+  virtual ~Queue() {}
+
+  void Append( const datum_t& datum ) {
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    m_qDatum.push( datum );
+  }
+
+  template<typename Function>
+  void Sync( Function f ) {
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    while ( !m_qDatum.empty() ) {
+      f( m_qDatum.front() );
+      m_qDatum.pop();
+    }
+  }
+
+protected:
+private:
+  boost::mutex m_mutex;
+  qDatum_t m_qDatum;
+};
+
+} // namespace previous
+
+// a common face on the queues
+struct Previous {
+  static const char* Name( void ) { return "previous"; };
+  previous::Queue<Datum> q;
+  void Push( const Datum& datum ) { q.Append( datum ); };
+  template<typename Function> void Drain( Function f ) { q.Sync( f ); };
+};
+
+struct Spsc {
+  static const char* Name( void ) { return "SpscQueue"; };
+  ou::tf::SpscQueue<Datum> q;
+  void Push( const Datum& datum ) { q.Push( datum ); };
+  template<typename Function> void Drain( Function f ) { q.Drain( f ); };
+};
+
+struct Chart {
+  static const char* Name( void ) { return "Queue"; };
+  ou::tf::Queue<Datum> q;
+  void Push( const Datum& datum ) { q.Append( datum ); };
+  template<typename Function> void Drain( Function f ) { q.Sync( f ); };
+};
+
+typedef boost::chrono::steady_clock clock_t_;
+
+class Seen { // what the consumer has had from each producer
+public:
+  explicit Seen( std::size_t nProducers ): m_vNext( nProducers, 0.0 ), m_nSeen( 0 ), m_bOrdered( true ) {};
+  void operator()( const Datum& datum ) {
+    double& next( m_vNext[ datum.nProducer ] );
+    if ( next != datum.dblSequence ) m_bOrdered = false;
+    next = datum.dblSequence + 1.0;
+    ++m_nSeen;
+  }
+  std::size_t Count( void ) const { return m_nSeen; };
+  bool Ordered( void ) const { return m_bOrdered; };
+private:
+  std::vector<double> m_vNext;
+  std::size_t m_nSeen;
+  bool m_bOrdered;
+};
+
+template<typename Q>
+void Produce( Q* pq, std::size_t ixProducer, std::size_t nCount ) {
+  for ( std::size_t ix = 0; ix < nCount; ++ix ) pq->Push( Datum( ixProducer, ix ) );
+}
+
+bool s_bOk( true );
+
+void Report( const char* szRun, const char* szQueue, std::size_t nProducers, double dblBest, bool bOk ) {
+  std::cout << szRun << " " << szQueue << " producers " << nProducers << ": " << dblBest << " ns/entry";
+  if ( !bOk ) {
+    std::cout << ", entries lost or out of order";
+    s_bOk = false;
+  }
+  std::cout << std::endl;
+}
+
+template<typename Q>
+void Push( std::size_t nCount, unsigned int nRounds ) {
+  static const std::size_t nBatch( 4096 );
+  double dblBest( 0.0 );
+  bool bOk( true );
+  for ( unsigned int ixRound = 0; ixRound < nRounds; ++ixRound ) {
+    Q q;
+    Seen seen( 1 );
+    clock_t_::time_point begin = clock_t_::now();
+    for ( std::size_t ix = 0; ix < nCount; ) {
+      const std::size_t end = std::min( nCount, ix + nBatch );
+      for ( ; ix < end; ++ix ) q.Push( Datum( 0, ix ) );
+      q.Drain( [&seen]( const Datum& datum ){ seen( datum ); } );
+    }
+    const double dblNs = boost::chrono::duration<double, boost::nano>( clock_t_::now() - begin ).count() / nCount;
+    if ( ( 0 == ixRound ) || ( dblNs < dblBest ) ) dblBest = dblNs;
+    bOk = bOk && seen.Ordered() && ( nCount == seen.Count() );
+  }
+  Report( "push", Q::Name(), 1, dblBest, bOk );
+}
+
+template<typename Q>
+void Threaded( const char* szRun, std::size_t nProducers, std::size_t nCount, unsigned int nRounds ) {
+  double dblBest( 0.0 );
+  bool bOk( true );
+  for ( unsigned int ixRound = 0; ixRound < nRounds; ++ixRound ) {
+    Q q;
+    Seen seen( nProducers );
+    const std::size_t nTotal( nProducers * nCount );
+    clock_t_::time_point begin = clock_t_::now();
+    boost::thread_group producers;
+    for ( std::size_t ix = 0; ix < nProducers; ++ix ) {
+      producers.create_thread( boost::bind( &Produce<Q>, &q, ix, nCount ) );
+    }
+    while ( seen.Count() < nTotal ) {
+      q.Drain( [&seen]( const Datum& datum ){ seen( datum ); } );
+      if ( seen.Count() < nTotal ) boost::this_thread::yield();  // as a consumer with other work would
+    }
+    producers.join_all();
+    const double dblNs = boost::chrono::duration<double, boost::nano>( clock_t_::now() - begin ).count() / nTotal;
+    if ( ( 0 == ixRound ) || ( dblNs < dblBest ) ) dblBest = dblNs;
+    bOk = bOk && seen.Ordered() && ( nTotal == seen.Count() );
+  }
+  Report( szRun, Q::Name(), nProducers, dblBest, bOk );
+}
+
+template<typename Q>
+void Feed( std::vector<boost::shared_ptr<Q> >* pvq, std::size_t nCount ) {
+  std::vector<boost::shared_ptr<Q> >& vq( *pvq );
+  for ( std::size_t ix = 0; ix < nCount; ++ix ) vq[ ix % vq.size() ]->Push( Datum( 0, ix / vq.size() ) );
+}
+
+template<typename Q>
+void Symbols( std::size_t nSymbols, std::size_t nCount, unsigned int nRounds ) {
+  nCount -= nCount % nSymbols;  // the same for each symbol
+  double dblBest( 0.0 );
+  bool bOk( true );
+  for ( unsigned int ixRound = 0; ixRound < nRounds; ++ixRound ) {
+    std::vector<boost::shared_ptr<Q> > vq;
+    std::vector<Seen> vSeen( nSymbols, Seen( 1 ) );
+    for ( std::size_t ix = 0; ix < nSymbols; ++ix ) vq.push_back( boost::shared_ptr<Q>( new Q ) );
+    std::size_t nSeen( 0 );
+    clock_t_::time_point begin = clock_t_::now();
+    boost::thread feed( boost::bind( &Feed<Q>, &vq, nCount ) );
+    while ( nSeen < nCount ) {
+      nSeen = 0;
+      for ( std::size_t ix = 0; ix < nSymbols; ++ix ) {
+        Seen& seen( vSeen[ ix ] );
+        vq[ ix ]->Drain( [&seen]( const Datum& datum ){ seen( datum ); } );
+        nSeen += seen.Count();
+      }
+      if ( nSeen < nCount ) boost::this_thread::yield();
+    }
+    feed.join();
+    const double dblNs = boost::chrono::duration<double, boost::nano>( clock_t_::now() - begin ).count() / nCount;
+    if ( ( 0 == ixRound ) || ( dblNs < dblBest ) ) dblBest = dblNs;
+    for ( std::size_t ix = 0; ix < nSymbols; ++ix ) {
+      bOk = bOk && vSeen[ ix ].Ordered() && ( nCount / nSymbols == vSeen[ ix ].Count() );
+    }
+  }
+  std::cout << "chart symbols " << nSymbols << ", ";
+  Report( "feed", Q::Name(), 1, dblBest, bOk );
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  std::size_t nCount( 4000000 );
+  std::size_t nProducers( 4 );
+  std::size_t nSymbols( 200 );
+  unsigned int nRounds( 5 );
+
+  for ( int ix = 1; ix < argc; ++ix ) {
+    const std::string sArg( argv[ ix ] );
+    if ( ( ix + 1 < argc ) && ( "--count" == sArg ) ) nCount = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--producers" == sArg ) ) nProducers = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--symbols" == sArg ) ) nSymbols = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--rounds" == sArg ) ) nRounds = std::strtoul( argv[ ++ix ], 0, 10 );
+    else {
+      std::cout << "usage: " << argv[ 0 ] << " [--count n] [--producers n] [--symbols n] [--rounds n]" << std::endl;
+      return 2;
+    }
+  }
+
+  Push<Previous>( nCount, nRounds );
+  Push<Spsc>( nCount, nRounds );
+  Push<Chart>( nCount, nRounds );
+
+  Threaded<Previous>( "spsc", 1, nCount, nRounds );
+  Threaded<Spsc>( "spsc", 1, nCount, nRounds );
+  Threaded<Chart>( "spsc", 1, nCount, nRounds );
+
+  Threaded<Previous>( "mpsc", nProducers, nCount, nRounds );
+  Threaded<Chart>( "mpsc", nProducers, nCount, nRounds );
+
+  Symbols<Previous>( nSymbols, nCount, nRounds );
+  Symbols<Chart>( nSymbols, nCount, nRounds );
+
+  return s_bOk ? 0 : 1;
+}
@@ -125,7 +125,9 @@ bool AppHdf5Chart::OnInit() {
   FrameMain::vpItems_t vItems;
   typedef FrameMain::structMenuItem mi;  // vxWidgets takes ownership of the objects
 //  vItems.push_back( new mi( "test", MakeDelegate( m_pPanelChartHdf5, &ou::tf::PanelChartHdf5::TestChart ) ) );
-//  m_pFrameMain->AddDynamicMenu( "Actions", vItems );
+  vItems.push_back( new mi( "Chart Whole Series", MakeDelegate( this, &AppHdf5Chart::HandleMenuActionChartWhole ) ) );
+  vItems.push_back( new mi( "Chart Recent Only", MakeDelegate( this, &AppHdf5Chart::HandleMenuActionChartRecent ) ) );
+  m_pFrameMain->AddDynamicMenu( "Actions", vItems );
 
 //  this->m_pData1Provider->Connect();
 
@@ -133,6 +135,16 @@ bool AppHdf5Chart::OnInit() {
 
 }
 
+void AppHdf5Chart::HandleMenuActionChartWhole( void ) {
+  m_pPanelChartHdf5->SetChartRecentOnly( false );
+  std::cout << "charts show the whole series" << std::endl;
+}
+
+void AppHdf5Chart::HandleMenuActionChartRecent( void ) {
+  m_pPanelChartHdf5->SetChartRecentOnly( true );
+  std::cout << "charts show the last day of ticks, the last year of bars" << std::endl;
+}
+
 void AppHdf5Chart::HandleGuiRefresh( wxTimerEvent& event ) {
   //m_winChart->RefreshRect( m_winChart->GetClientRect(), false );
 
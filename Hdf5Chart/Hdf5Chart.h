@@ -68,6 +68,8 @@ private:
   void OnExecDisconnected( int );
 
   //void HandleMenuActionLoadTree( void );
+  void HandleMenuActionChartWhole( void );
+  void HandleMenuActionChartRecent( void );
 
 };
 
@@ -0,0 +1,168 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+// load tests IQFeed ingestion with ou::tf::iqfeed::LoadGenerator, a synthetic stand in for IQConnect
+//   self ( the default ): the generator listens on 5009, and an IQFeedProvider in this process
+//     connects and watches every generated symbol, what it handled is reported against what was sent
+//   serve: the generator only, for a client run elsewhere, on --port
+// options:
+//   --equities n --underlyings n --expiries n --strikes n : the symbols, options are on the first underlyings
+//   --rate n --trades percent : Q messages per second, the share of them which are trades
+//   --burst none|square|spike --factor x --period seconds --length milliseconds
+//   --duration seconds --all ( updates without waiting for watches ) --shards n ( client dispatch threads )
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include <boost/atomic.hpp>
+#include <boost/thread.hpp>
+#include <boost/chrono.hpp>
+
+#include <TFTrading/Instrument.h>
+#include <TFIQFeed/IQFeedProvider.h>
+#include <TFIQFeed/LoadGenerator.h>
+
+using ou::tf::iqfeed::LoadGenerator;
+
+namespace {
+
+class Counter {
+public:
+  boost::atomic<bool> m_bConnected;
+  boost::atomic<bool> m_bFailed;  // an error before the connection was made
+  boost::atomic<std::size_t> m_cntQuotes;
+  boost::atomic<std::size_t> m_cntTrades;
+  Counter( void ): m_bConnected( false ), m_bFailed( false ), m_cntQuotes( 0 ), m_cntTrades( 0 ) {};
+  void HandleConnected( int ) { m_bConnected = true; };
+  void HandleError( size_t ) { if ( !m_bConnected ) m_bFailed = true; };
+  void HandleQuote( const ou::tf::Quote& ) { ++m_cntQuotes; };
+  void HandleTrade( const ou::tf::Trade& ) { ++m_cntTrades; };
+};
+
+void Usage( void ) {
+  std::cout
+    << "IQFeedLoad [serve|self] [--port n] [--equities n] [--underlyings n] [--expiries n] [--strikes n]" << std::endl
+    << "  [--rate n] [--trades percent] [--burst none|square|spike] [--factor x] [--period seconds] [--length milliseconds]" << std::endl
+    << "  [--duration seconds] [--all] [--shards n]" << std::endl;
+}
+
+} // namespace anonymous
+
+int main( int argc, char** argv ) {
+
+  LoadGenerator::Config config;
+  bool bServe( false );
+  unsigned int nShards( 0 );
+
+  for ( int ix = 1; ix < argc; ++ix ) {
+    const std::string sArg( argv[ ix ] );
+    const char* szValue = ( ix + 1 < argc ) ? argv[ ix + 1 ] : "";
+    if ( "serve" == sArg ) bServe = true;
+    else if ( "self" == sArg ) bServe = false;
+    else if ( "--all" == sArg ) config.bWatchAll = true;
+    else if ( "--port" == sArg ) { config.nPort = std::atoi( szValue ); ++ix; }
+    else if ( "--equities" == sArg ) { config.nEquities = std::atoi( szValue ); ++ix; }
+    else if ( "--underlyings" == sArg ) { config.nUnderlyings = std::atoi( szValue ); ++ix; }
+    else if ( "--expiries" == sArg ) { config.nExpiries = std::atoi( szValue ); ++ix; }
+    else if ( "--strikes" == sArg ) { config.nStrikes = std::atoi( szValue ); ++ix; }
+    else if ( "--rate" == sArg ) { config.dblRate = std::atof( szValue ); ++ix; }
+    else if ( "--trades" == sArg ) { config.nTradePercent = std::atoi( szValue ); ++ix; }
+    else if ( "--factor" == sArg ) { config.dblBurstFactor = std::atof( szValue ); ++ix; }
+    else if ( "--period" == sArg ) { config.tdBurstPeriod = boost::posix_time::seconds( std::atoi( szValue ) ); ++ix; }
+    else if ( "--length" == sArg ) { config.tdBurstLength = boost::posix_time::milliseconds( std::atoi( szValue ) ); ++ix; }
+    else if ( "--duration" == sArg ) { config.tdDuration = boost::posix_time::seconds( std::atoi( szValue ) ); ++ix; }
+    else if ( "--shards" == sArg ) { nShards = std::atoi( szValue ); ++ix; }
+    else if ( "--burst" == sArg ) {
+      const std::string sBurst( szValue );
+      if ( "none" == sBurst ) config.eBurst = LoadGenerator::BurstNone;
+      else if ( "square" == sBurst ) config.eBurst = LoadGenerator::BurstSquare;
+      else if ( "spike" == sBurst ) config.eBurst = LoadGenerator::BurstSpike;
+      else { Usage(); return 1; }
+      ++ix;
+    }
+    else { Usage(); return 1; }
+  }
+
+  if ( !bServe && ( 5009 != config.nPort ) ) {
+    std::cout << "self: IQFeedProvider connects on 5009" << std::endl;
+    return 1;
+  }
+
+  LoadGenerator generator( config );
+  try {
+    generator.Start();
+  }
+  catch ( const boost::system::system_error& e ) {
+    std::cout << "can't listen on " << config.nPort << ": " << e.what() << std::endl;
+    return 1;
+  }
+  std::cout << generator.Symbols().size() << " symbols, listening on " << config.nPort << std::endl;
+
+  Counter counter;
+  ou::tf::IQFeedProvider::pProvider_t pProvider;
+  std::vector<ou::tf::Instrument::pInstrument_t> vInstruments;
+
+  if ( !bServe ) {
+    pProvider.reset( new ou::tf::IQFeedProvider );
+    if ( 0 < nShards ) pProvider->SetDispatchShards( nShards );
+    pProvider->OnConnected.Add( MakeDelegate( &counter, &Counter::HandleConnected ) );
+    pProvider->OnError.Add( MakeDelegate( &counter, &Counter::HandleError ) );
+    pProvider->Connect();
+    // the generator is in this process, a connection not made in a few seconds is not coming
+    static const int nConnectWaits( 500 );
+    for ( int ix = 0; ( nConnectWaits > ix ) && !counter.m_bConnected && !counter.m_bFailed; ++ix ) {
+      boost::this_thread::sleep_for( boost::chrono::milliseconds( 10 ) );
+    }
+    if ( !counter.m_bConnected ) {
+      std::cout << "self: IQFeedProvider " << ( counter.m_bFailed ? "failed to connect" : "did not connect within 5s" ) << " on 5009" << std::endl;
+      return 1;
+    }
+    // the options too are watched as plain instruments, the provider only needs their IQFeed names
+    for ( std::vector<std::string>::const_iterator iter = generator.Symbols().begin(); generator.Symbols().end() != iter; ++iter ) {
+      ou::tf::Instrument::pInstrument_t pInstrument( new ou::tf::Instrument( *iter, ou::tf::InstrumentType::Stock, "SMART" ) );
+      pProvider->AddQuoteHandler( pInstrument, MakeDelegate( &counter, &Counter::HandleQuote ) );
+      pProvider->AddTradeHandler( pInstrument, MakeDelegate( &counter, &Counter::HandleTrade ) );
+      vInstruments.push_back( pInstrument );
+    }
+  }
+
+  generator.Wait();
+
+  const LoadGenerator::Stats& stats( generator.GetStats() );
+  const double dblSeconds = stats.tdElapsed.total_microseconds() / 1e6;
+  std::cout
+    << "sent: " << stats.nWatched << " symbols watched, " << stats.nUnknown << " unknown, "
+    << stats.nUpdates << " updates ( " << stats.nTrades << " trades ), "
+    << stats.nSent << " messages, " << stats.nBytes << " bytes, in " << dblSeconds << "s" << std::endl
+    << "  " << stats.nUpdates / dblSeconds << " updates/s, " << stats.nBytes / dblSeconds / 1e6 << " MB/s, "
+    << stats.nBacklog << " messages behind at the end, " << stats.nDropped << " dropped" << std::endl;
+
+  if ( !bServe ) {
+    // quotes only reach handlers when the bid or ask changed, trades always do
+    std::cout
+      << "handled: " << counter.m_cntTrades << " trades, " << counter.m_cntQuotes << " quotes, "
+      << ( counter.m_cntTrades + counter.m_cntQuotes ) / dblSeconds << " per second" << std::endl;
+    for ( std::vector<ou::tf::Instrument::pInstrument_t>::const_iterator iter = vInstruments.begin(); vInstruments.end() != iter; ++iter ) {
+      pProvider->RemoveQuoteHandler( *iter, MakeDelegate( &counter, &Counter::HandleQuote ) );
+      pProvider->RemoveTradeHandler( *iter, MakeDelegate( &counter, &Counter::HandleTrade ) );
+    }
+    pProvider->Disconnect();
+  }
+
+  return 0;
+}
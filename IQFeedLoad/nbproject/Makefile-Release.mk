@@ -0,0 +1,123 @@
+#
+# Generated Makefile - do not edit!
+#
+# Edit the Makefile in the project folder instead (../Makefile). Each target
+# has a -pre and a -post target defined where you can add customized code.
+#
+# This makefile implements configuration specific macros and targets.
+
+
+# Environment
+MKDIR=mkdir
+CP=cp
+GREP=grep
+NM=nm
+CCADMIN=CCadmin
+RANLIB=ranlib
+CC=gcc
+CCC=g++
+CXX=g++
+FC=gfortran
+AS=as
+
+# Macros
+CND_PLATFORM=GNU-Linux
+CND_DLIB_EXT=so
+CND_CONF=Release
+CND_DISTDIR=dist
+CND_BUILDDIR=build
+
+# Include project Makefile
+include Makefile
+
+# Object Directory
+OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
+
+# Object Files
+OBJECTFILES= \
+	${OBJECTDIR}/IQFeedLoad.o
+
+
+# C Compiler Flags
+CFLAGS=
+
+# CC Compiler Flags
+CCFLAGS=
+CXXFLAGS=
+
+# Fortran Compiler Flags
+FFLAGS=
+
+# Assembler Flags
+ASFLAGS=
+
+# Link Libraries and Options
+LDLIBSOPTIONS=-L/usr/local/lib -Wl,-rpath,'/usr/local/lib' ../lib/TFInteractiveBrokers/dist/Release/GNU-Linux/libtfinteractivebrokers.a ../lib/TFIQFeed/dist/Release/GNU-Linux/libtfiqfeed.a ../lib/TFSimulation/dist/Release/GNU-Linux/libtfsimulation.a ../lib/TFTrading/dist/Release/GNU-Linux/libtftrading.a ../lib/TFOptions/dist/Release/GNU-Linux/libtfoptions.a ../lib/TFHDF5TimeSeries/dist/Release/GNU-Linux/libtfhdf5timeseries.a ../lib/TFTimeSeries/dist/Release/GNU-Linux/libtftimeseries.a ../lib/OUCommon/dist/Release/GNU-Linux/liboucommon.a ../lib/OUSQL/dist/Release/GNU-Linux/libousql.a ../lib/OUSqlite/dist/Release/GNU-Linux/libousqlite.a -lhdf5_cpp -lhdf5 -lsz -lpthread -ldl -lz -lcurl -lboost_chrono-gcc-mt-1_61 -lboost_date_time-gcc-mt-1_61 -lboost_filesystem-gcc-mt-1_61 -lboost_regex-gcc-mt-1_61 -lboost_serialization-gcc-mt-1_61 -lboost_system-gcc-mt-1_61 -lboost_thread-gcc-mt-1_61
+
+# Build Targets
+.build-conf: ${BUILD_SUBPROJECTS}
+	"${MAKE}"  -f nbproject/Makefile-${CND_CONF}.mk ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/TFInteractiveBrokers/dist/Release/GNU-Linux/libtfinteractivebrokers.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/TFIQFeed/dist/Release/GNU-Linux/libtfiqfeed.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/TFSimulation/dist/Release/GNU-Linux/libtfsimulation.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/TFTrading/dist/Release/GNU-Linux/libtftrading.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/TFOptions/dist/Release/GNU-Linux/libtfoptions.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/TFHDF5TimeSeries/dist/Release/GNU-Linux/libtfhdf5timeseries.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/TFTimeSeries/dist/Release/GNU-Linux/libtftimeseries.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/OUCommon/dist/Release/GNU-Linux/liboucommon.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/OUSQL/dist/Release/GNU-Linux/libousql.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ../lib/OUSqlite/dist/Release/GNU-Linux/libousqlite.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload: ${OBJECTFILES}
+	${MKDIR} -p ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}
+	${LINK.cc} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/iqfeedload ${OBJECTFILES} ${LDLIBSOPTIONS}
+
+${OBJECTDIR}/IQFeedLoad.o: IQFeedLoad.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -O2 -I../lib -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/IQFeedLoad.o IQFeedLoad.cpp
+
+# Subprojects
+.build-subprojects:
+	cd ../lib/TFInteractiveBrokers && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/TFIQFeed && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/TFSimulation && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/TFTrading && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/TFOptions && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/TFHDF5TimeSeries && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/TFTimeSeries && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/OUCommon && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/OUSQL && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/OUSqlite && ${MAKE}  -f Makefile CONF=Release
+
+# Clean Targets
+.clean-conf: ${CLEAN_SUBPROJECTS}
+	${RM} -r ${CND_BUILDDIR}/${CND_CONF}
+
+# Subprojects
+.clean-subprojects:
+	cd ../lib/TFInteractiveBrokers && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/TFIQFeed && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/TFSimulation && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/TFTrading && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/TFOptions && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/TFHDF5TimeSeries && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/TFTimeSeries && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/OUCommon && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/OUSQL && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/OUSqlite && ${MAKE}  -f Makefile CONF=Release clean
+
+# Enable dependency checking
+.dep.inc: .depcheck-impl
+
+include .dep.inc
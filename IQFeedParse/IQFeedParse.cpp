@@ -0,0 +1,479 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+// checks and times the IQFeed field parsers of TFIQFeed/ParseFields.h against the ones they replaced:
+//   spirit for prices and sizes, spirit for dates, time_from_string for the last trade time,
+//   and a time_input_facet for the T message, the replaced ones are kept below, as they were
+//   check ( the default ): random and generated fields through both, any difference is listed,
+//     well formed dates and times need to match, malformed ones are reported, the old parsers
+//     read some of them in part, or threw, where the new ones decline them
+//     the exit status is 1 when prices, sizes, or well formed dates and times differ
+//   bench: Q lines through the message, old against new, in ns per message
+// options:
+//   --count n : fields per parser for check, --seed n
+//   --lines n --rounds n : Q lines generated for bench, and passes over them
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <iostream>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/spirit/include/qi.hpp>
+
+#include <TFIQFeed/IQFeedMessages.h>
+
+namespace {
+
+namespace previous { // the parsers replaced by ParseFields.h, as they were
+
+bool Double( const char* begin, const char* end, double& dbl ) {
+  namespace qi = boost::spirit::qi;
+  return qi::parse( begin, end, qi::double_, dbl );
+}
+
+bool Integer( const char* begin, const char* end, int& n ) {
+  namespace qi = boost::spirit::qi;
+  return qi::parse( begin, end, qi::int_, n );
+}
+
+boost::gregorian::date Date( const char* begin, const char* end ) {
+  namespace qi = boost::spirit::qi;
+  int nYear( 0 ), nMonth( 0 ), nDay( 0 );
+  boost::gregorian::date d( boost::gregorian::not_a_date_time );
+  if ( 10 == ( end - begin ) ) {
+    bool b;
+    const char* p;
+    p = begin + 0; b = qi::parse( p, begin +  2, qi::int_, nMonth );
+    p = begin + 3; b = qi::parse( p, begin +  5, qi::int_, nDay );
+    p = begin + 6; b = qi::parse( p, begin + 10, qi::int_, nYear );
+    if ( ( 99 == nDay ) || ( 99 == nMonth ) || ( 9999 == nYear ) ) {
+    }
+    else {
+      try {
+        if ( b ) d = boost::gregorian::date( nYear, nMonth, nDay );
+      }
+      catch (...) {
+      }
+    }
+  }
+  return d;
+}
+
+ptime LastTradeTime( boost::string_ref date, boost::string_ref time ) { // may throw, as time_from_string does
+  if ( ( 10 == date.size() ) && ( 8 <= time.size() ) ) {
+    char szDateTime[ 20 ];
+    szDateTime[  0 ] = date[ 6 ]; // yyyy
+    szDateTime[  1 ] = date[ 7 ];
+    szDateTime[  2 ] = date[ 8 ];
+    szDateTime[  3 ] = date[ 9 ];
+    szDateTime[  5 ] = date[ 0 ]; // mm
+    szDateTime[  6 ] = date[ 1 ];
+    szDateTime[  8 ] = date[ 3 ]; // dd
+    szDateTime[  9 ] = date[ 4 ];
+    std::memcpy( szDateTime + 11, time.data(), 8 ); // hh:mm:ss
+    szDateTime[ 4 ] = szDateTime[ 7 ] = '-';
+    szDateTime[ 10 ] = ' ';
+    szDateTime[ 19 ] = 0;
+    return boost::posix_time::time_from_string( szDateTime );
+  }
+  else {
+    return ptime( boost::date_time::special_values::min_date_time );
+  }
+}
+
+ptime TimeStamp( const std::string& sField ) { // the T message
+  ptime dt;
+  std::stringstream ss( sField );
+  boost::posix_time::time_input_facet* input_facet = new boost::posix_time::time_input_facet();
+  input_facet->format( "%Y%m%d %H:%M:%S" );
+  ss.imbue( std::locale( ss.getloc(), input_facet ) );
+  ss >> dt;
+  return dt;
+}
+
+} // namespace previous
+
+typedef ou::tf::IQFUpdateMessage::linebuffer_t linebuffer_t;
+typedef boost::chrono::steady_clock clock_t;
+
+class Random {
+public:
+  explicit Random( unsigned int nSeed ): m_rng( nSeed ) {};
+  int Int( int nMin, int nMax ) { return boost::random::uniform_int_distribution<int>( nMin, nMax )( m_rng ); }; // [nMin, nMax]
+  bool OneIn( int n ) { return 0 == Int( 0, n - 1 ); };
+  char Of( const char* sz ) { return sz[ Int( 0, std::strlen( sz ) - 1 ) ]; };
+  void Mutate( std::string& s ) { if ( !s.empty() ) s[ Int( 0, s.size() - 1 ) ] = Of( "0123456789:/- .xT" ); };
+private:
+  boost::random::mt19937 m_rng;
+};
+
+struct Tally {
+  const char* szName;
+  std::size_t nCount;
+  std::size_t nDiffer;
+  bool bRequired;  // differences fail the check
+  Tally( const char* szName_, bool bRequired_ ): szName( szName_ ), nCount( 0 ), nDiffer( 0 ), bRequired( bRequired_ ) {};
+  void Add( bool bSame, const std::string& sField, const std::string& sOld, const std::string& sNew ) {
+    ++nCount;
+    if ( !bSame ) {
+      if ( 5 > nDiffer ) std::cout << "  " << szName << " [" << sField << "] old " << sOld << ", new " << sNew << std::endl;
+      ++nDiffer;
+    }
+  }
+};
+
+std::string Format( const char* szFormat, double dbl ) {
+  char sz[ 64 ];
+  std::snprintf( sz, sizeof( sz ), szFormat, dbl );
+  return sz;
+}
+
+std::string Format( const char* szFormat, int n ) {
+  char sz[ 64 ];
+  std::snprintf( sz, sizeof( sz ), szFormat, n );
+  return sz;
+}
+
+template<typename T>
+std::string Text( const T& t ) {
+  std::stringstream ss;
+  ss << t;
+  return ss.str();
+}
+
+std::string Field( Random& random ) { // a price or size as formatted by the feed, or any short string
+  if ( random.OneIn( 2 ) ) {
+    std::string s;
+    const int n = random.Int( 0, 23 );
+    for ( int ix = 0; ix < n; ++ix ) s += random.Of( "0123456789012345678901234567890123456789.-+eE nNaiIfx" );
+    return s;
+  }
+  const double dbl = ( random.Int( 0, 1999999 ) - 1000000 ) / double( 1 << random.Int( 0, 7 ) ) * ( random.OneIn( 3 ) ? 0.001 : 1.0 );
+  if ( random.OneIn( 5 ) ) return Format( "%d", random.Int( -2000000000, 2000000000 ) );
+  char szFormat[ 8 ];
+  std::snprintf( szFormat, sizeof( szFormat ), "%%.%df", random.Int( 0, 7 ) );
+  return Format( szFormat, dbl );
+}
+
+std::string Date( Random& random, bool bNone = true ) { // MM/DD/YYYY, valid, or the feed's 99/99/9999 when bNone
+  if ( bNone && random.OneIn( 50 ) ) return "99/99/9999";
+  char sz[ 16 ];
+  std::snprintf( sz, sizeof( sz ), "%02d/%02d/%04d", random.Int( 1, 12 ), random.Int( 1, 28 ), random.Int( 1990, 2049 ) );
+  return sz;
+}
+
+std::string Time( Random& random ) { // HH:MM:SS, with a fraction, or the trade type, as the feed sends them
+  char sz[ 32 ];
+  std::snprintf( sz, sizeof( sz ), "%02d:%02d:%02d", random.Int( 0, 23 ), random.Int( 0, 59 ), random.Int( 0, 59 ) );
+  std::string s( sz );
+  switch ( random.Int( 0, 2 ) ) {
+    case 0: break;
+    case 1: s += random.Of( "tTbaoO" ); break;
+    case 2:
+      s += '.';
+      for ( int n = random.Int( 1, 6 ); 0 < n; --n ) s += random.Of( "0123456789" );
+      break;
+  }
+  return s;
+}
+
+// a Q line with the fields read by the pricing path
+std::string Line( Random& random, const std::string& sSymbol, const std::string& sDate, const std::string& sTime ) {
+  char sz[ 512 ];
+  std::snprintf( sz, sizeof( sz ),
+    "Q,%s,,%.2f,0.12,0.5,%d,100,%.2f,%.2f,%.4f,%.2f,%d,%d,0,0,,%s,0,10.0,9.9,,,,0,,,,,,%s,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,",
+    sSymbol.c_str(), random.Int( 1000, 99999 ) / 100.0, random.Int( 0, 9999999 ), random.Int( 1000, 99999 ) / 100.0,
+    random.Int( 1000, 99999 ) / 100.0, random.Int( 1, 999999999 ) / 1e4, random.Int( 1000, 99999 ) / 100.0,
+    random.Int( 1, 9999 ), random.Int( 1, 9999 ), sTime.c_str(), sDate.c_str() );
+  return sz;
+}
+
+// the last trade time as a result, or that it threw
+template<typename F>
+std::string Outcome( F f ) {
+  try {
+    return Text( f() );
+  }
+  catch ( const std::exception& e ) {
+    return std::string( "threw " ) + e.what();
+  }
+}
+
+class Quiet { // Date reports the dates it can't make, not wanted here
+public:
+  Quiet( void ): m_pBuf( std::cout.rdbuf( 0 ) ) {};
+  ~Quiet( void ) { std::cout.clear(); std::cout.rdbuf( m_pBuf ); };
+private:
+  std::streambuf* m_pBuf;
+};
+
+boost::gregorian::date CurrentDate( ou::tf::IQFUpdateMessage& msg ) {
+  Quiet quiet;
+  return msg.Date( ou::tf::IQFUpdateMessage::QPLastTradeDate );
+}
+
+struct PreviousLastTradeTime {
+  ou::tf::IQFUpdateMessage& msg;
+  PreviousLastTradeTime( ou::tf::IQFUpdateMessage& msg_ ): msg( msg_ ) {};
+  ptime operator()( void ) const {
+    return previous::LastTradeTime( msg.FieldRef( ou::tf::IQFUpdateMessage::QPLastTradeDate ), msg.FieldRef( ou::tf::IQFUpdateMessage::QPLastTradeTime ) );
+  }
+};
+
+struct CurrentLastTradeTime {
+  ou::tf::IQFUpdateMessage& msg;
+  CurrentLastTradeTime( ou::tf::IQFUpdateMessage& msg_ ): msg( msg_ ) {};
+  ptime operator()( void ) const { return msg.LastTradeTime(); };
+};
+
+int Check( std::size_t nCount, unsigned int nSeed ) {
+
+  Random random( nSeed );
+
+  Tally tallyDouble( "Double", true );
+  Tally tallyInteger( "Integer", true );
+  Tally tallyDate( "Date", true );
+  Tally tallyDateMalformed( "Date malformed", false );
+  Tally tallyTime( "LastTradeTime", true );
+  Tally tallyTimeMalformed( "LastTradeTime malformed", false );
+  Tally tallyStamp( "T message", true );
+  Tally tallyStampMalformed( "T message malformed", false );
+
+  for ( std::size_t ix = 0; ix < nCount; ++ix ) {
+    const std::string s( Field( random ) );
+    const char* begin = s.data();
+    const char* end = s.data() + s.size();
+    double dblOld( -7 ), dblNew( -7 );
+    const bool bOld = previous::Double( begin, end, dblOld );
+    const bool bNew = ou::tf::iqfeed::ParseDouble( begin, end, dblNew );
+    tallyDouble.Add(
+      ( bOld == bNew ) && ( !bOld || ( 0 == std::memcmp( &dblOld, &dblNew, sizeof( double ) ) ) ),
+      s, Text( bOld ) + " " + Format( "%.17g", dblOld ), Text( bNew ) + " " + Format( "%.17g", dblNew ) );
+    int nOld( -7 ), nNew( -7 );
+    const bool bIntOld = previous::Integer( begin, end, nOld );
+    const bool bIntNew = ou::tf::iqfeed::ParseInteger( begin, end, nNew );
+    tallyInteger.Add( ( bIntOld == bIntNew ) && ( !bIntOld || ( nOld == nNew ) ), s, Text( bIntOld ) + " " + Text( nOld ), Text( bIntNew ) + " " + Text( nNew ) );
+  }
+
+  ou::tf::IQFUpdateMessage msg;
+  linebuffer_t line;
+  for ( std::size_t ix = 0; ix < nCount; ++ix ) {
+    std::string sDate( Date( random ) );
+    std::string sTime( Time( random ) );
+    const bool bMalformed( random.OneIn( 5 ) );
+    if ( bMalformed ) {
+      if ( random.OneIn( 2 ) ) random.Mutate( sDate );
+      else random.Mutate( sTime );
+    }
+    const std::string s( Line( random, "SYM", sDate, sTime ) );
+    line.assign( s.begin(), s.end() );
+    linebuffer_t::iterator begin( line.begin() ), end( line.end() );
+    msg.Assign( begin, end );
+
+    const boost::gregorian::date dateOld( previous::Date( sDate.data(), sDate.data() + sDate.size() ) );
+    const boost::gregorian::date dateNew( CurrentDate( msg ) );
+    ( bMalformed ? tallyDateMalformed : tallyDate ).Add( dateOld == dateNew, sDate, Text( dateOld ), Text( dateNew ) );
+
+    const std::string sOld( Outcome( PreviousLastTradeTime( msg ) ) );
+    const std::string sNew( Outcome( CurrentLastTradeTime( msg ) ) );
+    ( bMalformed ? tallyTimeMalformed : tallyTime ).Add( sOld == sNew, sDate + " " + sTime, sOld, sNew );
+
+    char sz[ 16 ];
+    std::snprintf( sz, sizeof( sz ), "%04d%02d%02d ", random.Int( 1990, 2049 ), random.Int( 1, 12 ), random.Int( 1, 28 ) );
+    std::string sStamp( sz + sTime.substr( 0, 8 ) );  // the T message carries whole seconds
+    if ( bMalformed ) random.Mutate( sStamp );
+    const std::string sT( "T," + sStamp );
+    line.assign( sT.begin(), sT.end() );
+    begin = line.begin();
+    end = line.end();
+    ou::tf::IQFTimeMessage msgTime( begin, end );
+    const ptime dtOld( previous::TimeStamp( sStamp ) );
+    ( bMalformed ? tallyStampMalformed : tallyStamp ).Add( dtOld == msgTime.TimeStamp(), sStamp, Text( dtOld ), Text( msgTime.TimeStamp() ) );
+  }
+
+  // out of range dates, which both turn down
+  const char* rszDate[] = { "02/30/2026", "13/01/2026", "00/10/2026", "10/00/2026", "99/18/2026", "10/18/9999" };
+  for ( std::size_t ix = 0; ix < sizeof( rszDate ) / sizeof( rszDate[ 0 ] ); ++ix ) {
+    const std::string s( Line( random, "SYM", rszDate[ ix ], "10:00:00" ) );
+    line.assign( s.begin(), s.end() );
+    linebuffer_t::iterator begin( line.begin() ), end( line.end() );
+    msg.Assign( begin, end );
+    const boost::gregorian::date dateOld( previous::Date( rszDate[ ix ], rszDate[ ix ] + 10 ) );
+    const boost::gregorian::date dateNew( CurrentDate( msg ) );
+    tallyDate.Add( dateOld == dateNew, rszDate[ ix ], Text( dateOld ), Text( dateNew ) );
+    tallyTime.Add( Outcome( PreviousLastTradeTime( msg ) ) == Outcome( CurrentLastTradeTime( msg ) ), rszDate[ ix ],
+      Outcome( PreviousLastTradeTime( msg ) ), Outcome( CurrentLastTradeTime( msg ) ) );
+  }
+
+  const Tally* rTally[] = {
+    &tallyDouble, &tallyInteger, &tallyDate, &tallyTime, &tallyStamp, &tallyDateMalformed, &tallyTimeMalformed, &tallyStampMalformed };
+  bool bFailed( false );
+  for ( std::size_t ix = 0; ix < sizeof( rTally ) / sizeof( rTally[ 0 ] ); ++ix ) {
+    const Tally& tally( *rTally[ ix ] );
+    std::cout << tally.szName << ": " << tally.nDiffer << " of " << tally.nCount << " differ" << std::endl;
+    if ( tally.bRequired && ( 0 != tally.nDiffer ) ) bFailed = true;
+  }
+  std::cout << ( bFailed ? "FAILED" : "passed" ) << std::endl;
+  return bFailed ? 1 : 0;
+}
+
+double Nanoseconds( const clock_t::time_point& start, std::size_t n ) {
+  return boost::chrono::duration_cast<boost::chrono::nanoseconds>( clock_t::now() - start ).count() / double( n );
+}
+
+int Bench( std::size_t nLines, std::size_t nRounds, unsigned int nSeed ) {
+
+  typedef ou::tf::IQFUpdateMessage msg_t;
+
+  Random random( nSeed );
+  std::vector<linebuffer_t> vLines;
+  std::vector<std::string> vStamps;
+  for ( std::size_t ix = 0; ix < nLines; ++ix ) {
+    // 99/99/9999 is left out, LastTradeTime throws on it, as time_from_string did
+    const std::string s( Line( random, "SYM" + Text( ix ), Date( random, false ), Time( random ) ) );
+    vLines.push_back( linebuffer_t( s.begin(), s.end() ) );
+    char sz[ 32 ];
+    std::snprintf( sz, sizeof( sz ), "%04d%02d%02d %02d:%02d:%02d",
+      random.Int( 1990, 2049 ), random.Int( 1, 12 ), random.Int( 1, 28 ), random.Int( 0, 23 ), random.Int( 0, 59 ), random.Int( 0, 59 ) );
+    vStamps.push_back( sz );
+  }
+  const std::size_t n( nLines * nRounds );
+
+  msg_t msg;
+  double dblSum( 0 );  // keeps the results in use
+  clock_t::time_point start;
+
+  const msg_t::enumFieldIds rDouble[] = { msg_t::QPLast, msg_t::QPBid, msg_t::QPAsk, msg_t::QPHigh, msg_t::QPLow, msg_t::QPOpen, msg_t::QPClose };
+  const msg_t::enumFieldIds rInteger[] = { msg_t::QPTtlVol, msg_t::QPBidSize, msg_t::QPAskSize };
+
+  start = clock_t::now();
+  for ( std::size_t nRound = 0; nRound < nRounds; ++nRound ) {
+    for ( std::vector<linebuffer_t>::iterator iter = vLines.begin(); vLines.end() != iter; ++iter ) {
+      linebuffer_t::iterator begin( iter->begin() ), end( iter->end() );
+      msg.Assign( begin, end );
+      for ( std::size_t ix = 0; ix < sizeof( rDouble ) / sizeof( rDouble[ 0 ] ); ++ix ) {
+        double dbl( 0 );
+        boost::string_ref field( msg.FieldRef( rDouble[ ix ] ) );
+        if ( !field.empty() ) previous::Double( field.begin(), field.end(), dbl );
+        dblSum += dbl;
+      }
+      for ( std::size_t ix = 0; ix < sizeof( rInteger ) / sizeof( rInteger[ 0 ] ); ++ix ) {
+        int n( 0 );
+        boost::string_ref field( msg.FieldRef( rInteger[ ix ] ) );
+        if ( !field.empty() ) previous::Integer( field.begin(), field.end(), n );
+        dblSum += n;
+      }
+    }
+  }
+  const double dblNumericOld( Nanoseconds( start, n ) );
+
+  start = clock_t::now();
+  for ( std::size_t nRound = 0; nRound < nRounds; ++nRound ) {
+    for ( std::vector<linebuffer_t>::iterator iter = vLines.begin(); vLines.end() != iter; ++iter ) {
+      linebuffer_t::iterator begin( iter->begin() ), end( iter->end() );
+      msg.Assign( begin, end );
+      for ( std::size_t ix = 0; ix < sizeof( rDouble ) / sizeof( rDouble[ 0 ] ); ++ix ) dblSum += msg.Double( rDouble[ ix ] );
+      for ( std::size_t ix = 0; ix < sizeof( rInteger ) / sizeof( rInteger[ 0 ] ); ++ix ) dblSum += msg.Integer( rInteger[ ix ] );
+    }
+  }
+  const double dblNumericNew( Nanoseconds( start, n ) );
+
+  start = clock_t::now();
+  for ( std::size_t nRound = 0; nRound < nRounds; ++nRound ) {
+    for ( std::vector<linebuffer_t>::iterator iter = vLines.begin(); vLines.end() != iter; ++iter ) {
+      linebuffer_t::iterator begin( iter->begin() ), end( iter->end() );
+      msg.Assign( begin, end );
+      dblSum += PreviousLastTradeTime( msg )().time_of_day().seconds();
+    }
+  }
+  const double dblTimeOld( Nanoseconds( start, n ) );
+
+  start = clock_t::now();
+  for ( std::size_t nRound = 0; nRound < nRounds; ++nRound ) {
+    for ( std::vector<linebuffer_t>::iterator iter = vLines.begin(); vLines.end() != iter; ++iter ) {
+      linebuffer_t::iterator begin( iter->begin() ), end( iter->end() );
+      msg.Assign( begin, end );
+      dblSum += msg.LastTradeTime().time_of_day().seconds();
+    }
+  }
+  const double dblTimeNew( Nanoseconds( start, n ) );
+
+  start = clock_t::now();
+  for ( std::size_t nRound = 0; nRound < nRounds; ++nRound ) {
+    for ( std::vector<std::string>::const_iterator iter = vStamps.begin(); vStamps.end() != iter; ++iter ) {
+      dblSum += previous::TimeStamp( *iter ).time_of_day().seconds();
+    }
+  }
+  const double dblStampOld( Nanoseconds( start, n ) );
+
+  start = clock_t::now();
+  linebuffer_t line;
+  for ( std::size_t nRound = 0; nRound < nRounds; ++nRound ) {
+    for ( std::vector<std::string>::const_iterator iter = vStamps.begin(); vStamps.end() != iter; ++iter ) {
+      line.assign( 2, ',' );
+      line[ 0 ] = 'T';
+      line.insert( line.end(), iter->begin(), iter->end() );
+      linebuffer_t::iterator begin( line.begin() ), end( line.end() );
+      ou::tf::IQFTimeMessage msgTime( begin, end );
+      dblSum += msgTime.TimeStamp().time_of_day().seconds();
+    }
+  }
+  const double dblStampNew( Nanoseconds( start, n ) );
+
+  std::cout
+    << n << " messages, ns per message, old -> new, each includes indexing the fields" << std::endl
+    << "  seven prices, three sizes: " << dblNumericOld << " -> " << dblNumericNew << std::endl
+    << "  LastTradeTime:             " << dblTimeOld << " -> " << dblTimeNew << std::endl
+    << "  T message:                 " << dblStampOld << " -> " << dblStampNew << std::endl
+    << "  ( " << dblSum << " )" << std::endl;
+  return 0;
+}
+
+void Usage( void ) {
+  std::cout
+    << "IQFeedParse [check|bench] [--count n] [--seed n] [--lines n] [--rounds n]" << std::endl;
+}
+
+} // namespace anonymous
+
+int main( int argc, char** argv ) {
+
+  bool bBench( false );
+  std::size_t nCount( 1000000 );
+  unsigned int nSeed( 11 );
+  std::size_t nLines( 1000 );
+  std::size_t nRounds( 1000 );
+
+  for ( int ix = 1; ix < argc; ++ix ) {
+    const std::string sArg( argv[ ix ] );
+    const char* szValue = ( ix + 1 < argc ) ? argv[ ix + 1 ] : "";
+    if ( "check" == sArg ) bBench = false;
+    else if ( "bench" == sArg ) bBench = true;
+    else if ( "--count" == sArg ) { nCount = std::atol( szValue ); ++ix; }
+    else if ( "--seed" == sArg ) { nSeed = std::atoi( szValue ); ++ix; }
+    else if ( "--lines" == sArg ) { nLines = std::atol( szValue ); ++ix; }
+    else if ( "--rounds" == sArg ) { nRounds = std::atol( szValue ); ++ix; }
+    else { Usage(); return 1; }
+  }
+
+  return bBench ? Bench( nLines, nRounds, nSeed ) : Check( nCount, nSeed );
+}
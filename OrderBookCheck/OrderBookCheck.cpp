@@ -0,0 +1,280 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+// checks TFTrading/OrderBook against a reference book, a map of levels per side rebuilt from the market maker quotes
+//   stub: a real bid against a lone stub ask at 99999.99, then a bad bid far above it, the inside wider than the
+//     array, the tops need to match, and each update needs to finish, the array is kept to nWindowMax
+//   random: market makers requote around a moving price, with stub quotes far off, price jumps,
+//     and now and then a stub ask, or a bad price, as the only quote on its side, the inside wide
+//     tops, the published tops, the best prices, and the level counts are compared every few updates
+//   the exit status is 1 when anything differs
+// options:
+//   --updates n : for random, --window n : the nWindowMax of the book, --seed n
+
+#include <map>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+#include <TFTrading/OrderBook.h>
+
+namespace {
+
+typedef ou::tf::OrderBook OrderBook;
+typedef OrderBook::MMID_t MMID_t;
+typedef long tick_t;
+
+const double c_dblTickSize( 0.01 );
+const unsigned int c_nTop( 10 );
+
+struct Quote {
+  tick_t tick;
+  OrderBook::volume_t nVolume;
+  bool bActive;
+  Quote( void ): tick( 0 ), nVolume( 0 ), bActive( false ) {};
+};
+
+class Reference { // the quotes of each market maker, levels built from them when asked
+public:
+  void Update( ou::tf::MarketDepth::ESide eSide, MMID_t mmid, double dblPrice, OrderBook::volume_t nVolume ) {
+    Quote& quote( m_rmapQuote[ eSide ][ mmid ] );
+    quote.bActive = ( 0.0 < dblPrice ) && ( 0 < nVolume );
+    quote.tick = std::lround( dblPrice / c_dblTickSize );
+    quote.nVolume = nVolume;
+  }
+  void Levels( std::map<tick_t, OrderBook::volume_t>* rmapLevel ) const {
+    for ( int side = 0; side < 2; ++side ) {
+      rmapLevel[ side ].clear();
+      for ( mapQuote_t::const_iterator iter = m_rmapQuote[ side ].begin(); m_rmapQuote[ side ].end() != iter; ++iter ) {
+        if ( iter->second.bActive ) rmapLevel[ side ][ iter->second.tick ] += iter->second.nVolume;
+      }
+    }
+  }
+private:
+  typedef std::map<MMID_t, Quote> mapQuote_t;
+  mapQuote_t m_rmapQuote[ 2 ];  // Bid, Ask
+};
+
+class Checker {
+public:
+
+  Checker( unsigned int nWindowMax )
+  : m_book( c_dblTickSize, c_nTop, 64, nWindowMax ), m_bTop( false ), m_nChecks( 0 ), m_nDiffer( 0 ), m_dblSlowest( 0.0 )
+  {
+    m_book.OnTop.Add( MakeDelegate( this, &Checker::HandleTop ) );
+  }
+
+  ~Checker( void ) {
+    m_book.OnTop.Remove( MakeDelegate( this, &Checker::HandleTop ) );
+  }
+
+  void Update( ou::tf::MarketDepth::ESide eSide, MMID_t mmid, double dblPrice, OrderBook::volume_t nVolume ) {
+    typedef boost::chrono::steady_clock clock_t_;
+    const clock_t_::time_point begin = clock_t_::now();
+    m_book.Update( m_dt, eSide, mmid, dblPrice, nVolume );
+    const double dblMs = boost::chrono::duration<double, boost::milli>( clock_t_::now() - begin ).count();
+    if ( m_dblSlowest < dblMs ) m_dblSlowest = dblMs;
+    if ( 1e15 * c_dblTickSize > dblPrice ) m_reference.Update( eSide, mmid, dblPrice, nVolume );  // the book takes no larger
+  }
+
+  void EndOfGroup( void ) {
+    m_bTop = false;
+    m_book.EndOfGroup();
+  }
+
+  bool Check( const char* szWhat, bool bPublished ) { // true when the book matches the reference
+    ++m_nChecks;
+    std::map<tick_t, OrderBook::volume_t> rmapLevel[ 2 ];
+    m_reference.Levels( rmapLevel );
+    OrderBook::Top top;
+    m_book.GetTop( top );
+    std::string sDiffer;
+    if ( !Same( rmapLevel, top ) ) sDiffer += " top";
+    if ( bPublished && m_bTop && !Same( rmapLevel, m_top ) ) sDiffer += " published";
+    if ( ( rmapLevel[ 0 ].size() != m_book.Levels( ou::tf::MarketDepth::Bid ) )
+      || ( rmapLevel[ 1 ].size() != m_book.Levels( ou::tf::MarketDepth::Ask ) ) ) sDiffer += " levels";
+    const tick_t tickBid( rmapLevel[ 0 ].empty() ? 0 : rmapLevel[ 0 ].rbegin()->first );
+    const tick_t tickAsk( rmapLevel[ 1 ].empty() ? 0 : rmapLevel[ 1 ].begin()->first );
+    if ( ( tickBid != std::lround( m_book.BestBid() / c_dblTickSize ) )
+      || ( tickAsk != std::lround( m_book.BestAsk() / c_dblTickSize ) ) ) sDiffer += " best";
+    if ( sDiffer.empty() ) return true;
+    if ( 10 > m_nDiffer ) std::cout << szWhat << ": differs in" << sDiffer << std::endl;
+    ++m_nDiffer;
+    return false;
+  }
+
+  std::size_t Checks( void ) const { return m_nChecks; };
+  std::size_t Differ( void ) const { return m_nDiffer; };
+  double Slowest( void ) const { return m_dblSlowest; };  // ms for an update
+
+private:
+
+  OrderBook m_book;
+  Reference m_reference;
+  boost::posix_time::ptime m_dt;
+  OrderBook::Top m_top;
+  bool m_bTop;  // published since the last EndOfGroup
+  std::size_t m_nChecks;
+  std::size_t m_nDiffer;
+  double m_dblSlowest;
+
+  void HandleTop( const OrderBook::Top& top ) {
+    m_top = top;
+    m_bTop = true;
+  }
+
+  static bool Same( const std::map<tick_t, OrderBook::volume_t>* rmapLevel, const OrderBook::Top& top ) {
+    std::vector<std::pair<tick_t, OrderBook::volume_t> > vBid( rmapLevel[ 0 ].rbegin(), rmapLevel[ 0 ].rend() );
+    std::vector<std::pair<tick_t, OrderBook::volume_t> > vAsk( rmapLevel[ 1 ].begin(), rmapLevel[ 1 ].end() );
+    if ( c_nTop < vBid.size() ) vBid.resize( c_nTop );
+    if ( c_nTop < vAsk.size() ) vAsk.resize( c_nTop );
+    if ( ( vBid.size() != top.vBid.size() ) || ( vAsk.size() != top.vAsk.size() ) ) return false;
+    for ( std::size_t ix = 0; ix < vBid.size(); ++ix ) {
+      if ( ( vBid[ ix ].first != std::lround( top.vBid[ ix ].dblPrice / c_dblTickSize ) ) || ( vBid[ ix ].second != top.vBid[ ix ].nVolume ) ) return false;
+    }
+    for ( std::size_t ix = 0; ix < vAsk.size(); ++ix ) {
+      if ( ( vAsk[ ix ].first != std::lround( top.vAsk[ ix ].dblPrice / c_dblTickSize ) ) || ( vAsk[ ix ].second != top.vAsk[ ix ].nVolume ) ) return false;
+    }
+    return true;
+  }
+};
+
+MMID_t Mmid( const char* sz ) { // packed as MarketDepth packs its four characters
+  MMID_t mmid( 0 );
+  for ( int ix = 0; ( 4 > ix ) && ( 0 != sz[ ix ] ); ++ix ) reinterpret_cast<char*>( &mmid )[ ix ] = sz[ ix ];
+  return mmid;
+}
+
+bool Stub( unsigned int nWindowMax ) {
+  using ou::tf::MarketDepth;
+  Checker checker( nWindowMax );
+  bool bOk( true );
+
+  checker.Update( MarketDepth::Bid, Mmid( "NSDQ" ), 100.00, 300 );
+  checker.Update( MarketDepth::Ask, Mmid( "NITE" ), 99999.99, 100 );  // the stub, the only ask
+  checker.EndOfGroup();
+  bOk = checker.Check( "stub ask", true ) && bOk;
+
+  for ( int ix = 0; ix < 20; ++ix ) {  // the bids move about under the stub
+    checker.Update( MarketDepth::Bid, Mmid( "ARCA" ), 99.90 + 0.01 * ix, 200 );
+    checker.Update( MarketDepth::Bid, Mmid( "EDGX" ), 99.80 - 0.01 * ix, 100 );
+    checker.EndOfGroup();
+    bOk = checker.Check( "stub ask, bids requoting", true ) && bOk;
+  }
+
+  checker.Update( MarketDepth::Ask, Mmid( "ARCA" ), 100.05, 100 );  // a real ask, the inside narrows
+  checker.EndOfGroup();
+  bOk = checker.Check( "real ask under the stub", true ) && bOk;
+
+  checker.Update( MarketDepth::Ask, Mmid( "ARCA" ), 0.0, 0 );  // and withdrawn, the stub is the inside again
+  checker.EndOfGroup();
+  bOk = checker.Check( "real ask withdrawn", true ) && bOk;
+
+  checker.Update( MarketDepth::Bid, Mmid( "BADP" ), 2.2e7, 100 );  // past 2^31 ticks, crossed far above the stub
+  checker.EndOfGroup();
+  bOk = checker.Check( "bad bid", true ) && bOk;
+
+  checker.Update( MarketDepth::Bid, Mmid( "BADP" ), 0.0, 0 );
+  checker.Update( MarketDepth::Ask, Mmid( "NITE" ), 0.0, 0 );
+  checker.EndOfGroup();
+  bOk = checker.Check( "bad bid and stub withdrawn", true ) && bOk;
+
+  checker.Update( MarketDepth::Ask, Mmid( "HUGE" ), 1e300, 100 );  // no tick for it, not taken
+  checker.EndOfGroup();
+  bOk = checker.Check( "price with no tick", true ) && bOk;
+
+  std::cout << "stub window " << nWindowMax << ": " << checker.Checks() << " checks, " << checker.Differ() << " differ, slowest update " << checker.Slowest() << " ms" << std::endl;
+  return bOk;
+}
+
+bool Random( unsigned int nWindowMax, std::size_t nUpdates, unsigned int nSeed ) {
+  using ou::tf::MarketDepth;
+  typedef boost::random::mt19937 engine_t;
+  engine_t engine( nSeed );
+  boost::random::uniform_int_distribution<long> distribution( 0, 1000000 );
+  struct Draw {
+    engine_t& engine;
+    boost::random::uniform_int_distribution<long>& distribution;
+    long operator()( long n ) { return distribution( engine ) % n; }
+  } draw = { engine, distribution };
+
+  Checker checker( nWindowMax );
+  static const int nMarketMakers( 60 );
+  tick_t tickMid( 10000 );
+  for ( std::size_t ix = 0; ix < nUpdates; ++ix ) {
+    if ( 0 == draw( 200 ) ) tickMid += draw( 21 ) - 10;
+    if ( 0 == draw( 20000 ) ) tickMid += draw( 2 ) ? 3000 : -3000;  // a jump
+    if ( 0 == draw( 5000 ) ) {  // a wide inside: withdraw one side, then a lone stub, or a bad price, on it
+      const MarketDepth::ESide eSide( draw( 2 ) ? MarketDepth::Bid : MarketDepth::Ask );
+      for ( int ixMM = 0; ixMM < nMarketMakers; ++ixMM ) checker.Update( eSide, 'A' + ixMM + ( 'M' << 8 ), 0.0, 0 );
+      const double dblFar( draw( 3 ) ? 99999.99 : ( draw( 2 ) ? 2.2e7 : 0.01 ) );
+      checker.Update( eSide, Mmid( "STUB" ), dblFar, 100 );
+    }
+    const MarketDepth::ESide eSide( draw( 2 ) ? MarketDepth::Bid : MarketDepth::Ask );
+    const MMID_t mmid( 'A' + draw( nMarketMakers ) + ( 'M' << 8 ) );
+    tick_t tickOffset( draw( 30 ) );
+    if ( 0 == draw( 50 ) ) tickOffset = 1000 + draw( 50000 );  // stub quotes, far away
+    tick_t tick( ( MarketDepth::Bid == eSide ) ? tickMid - 1 - tickOffset : tickMid + 1 + tickOffset );
+    if ( 1 > tick ) tick = 1;
+    const OrderBook::volume_t nVolume( ( 0 == draw( 20 ) ) ? 0 : 100 * ( 1 + draw( 10 ) ) );
+    checker.Update( eSide, mmid, tick * c_dblTickSize, nVolume );
+    if ( 0 == draw( 1000 ) ) checker.Update( MarketDepth::Ask, Mmid( "STUB" ), 0.0, 0 );
+    if ( 0 == draw( 1000 ) ) checker.Update( MarketDepth::Bid, Mmid( "STUB" ), 0.0, 0 );
+    const bool bEndOfGroup( 0 == draw( 4 ) );
+    if ( bEndOfGroup ) checker.EndOfGroup();
+    if ( 0 == ix % 13 ) checker.Check( "random", bEndOfGroup );
+  }
+  std::cout << "random window " << nWindowMax << ": " << checker.Checks() << " checks, " << checker.Differ() << " differ, slowest update " << checker.Slowest() << " ms" << std::endl;
+  return 0 == checker.Differ();
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  std::size_t nUpdates( 300000 );
+  std::vector<unsigned int> vWindow;
+  unsigned int nSeed( 7 );
+
+  for ( int ix = 1; ix < argc; ++ix ) {
+    const std::string sArg( argv[ ix ] );
+    if ( ( ix + 1 < argc ) && ( "--updates" == sArg ) ) nUpdates = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--window" == sArg ) ) vWindow.push_back( std::strtoul( argv[ ++ix ], 0, 10 ) );
+    else if ( ( ix + 1 < argc ) && ( "--seed" == sArg ) ) nSeed = std::strtoul( argv[ ++ix ], 0, 10 );
+    else {
+      std::cout << "usage: " << argv[ 0 ] << " [--updates n] [--window n] [--seed n]" << std::endl;
+      return 2;
+    }
+  }
+  if ( vWindow.empty() ) {
+    vWindow.push_back( 128 );
+    vWindow.push_back( 1024 );
+    vWindow.push_back( 65536 );
+  }
+
+  bool bOk( true );
+  for ( std::vector<unsigned int>::const_iterator iter = vWindow.begin(); vWindow.end() != iter; ++iter ) {
+    bOk = Stub( *iter ) && bOk;
+    bOk = Random( *iter, nUpdates, nSeed ) && bOk;
+  }
+
+  return bOk ? 0 : 1;
+}
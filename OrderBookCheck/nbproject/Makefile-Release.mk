@@ -0,0 +1,95 @@
+#
+# Generated Makefile - do not edit!
+#
+# Edit the Makefile in the project folder instead (../Makefile). Each target
+# has a -pre and a -post target defined where you can add customized code.
+#
+# This makefile implements configuration specific macros and targets.
+
+
+# Environment
+MKDIR=mkdir
+CP=cp
+GREP=grep
+NM=nm
+CCADMIN=CCadmin
+RANLIB=ranlib
+CC=gcc
+CCC=g++
+CXX=g++
+FC=gfortran
+AS=as
+
+# Macros
+CND_PLATFORM=GNU-Linux
+CND_DLIB_EXT=so
+CND_CONF=Release
+CND_DISTDIR=dist
+CND_BUILDDIR=build
+
+# Include project Makefile
+include Makefile
+
+# Object Directory
+OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
+
+# Object Files
+OBJECTFILES= \
+	${OBJECTDIR}/OrderBookCheck.o
+
+
+# C Compiler Flags
+CFLAGS=
+
+# CC Compiler Flags
+CCFLAGS=
+CXXFLAGS=
+
+# Fortran Compiler Flags
+FFLAGS=
+
+# Assembler Flags
+ASFLAGS=
+
+# Link Libraries and Options
+LDLIBSOPTIONS=-L/usr/local/lib -Wl,-rpath,'/usr/local/lib' ../lib/TFTrading/dist/Release/GNU-Linux/libtftrading.a ../lib/TFTimeSeries/dist/Release/GNU-Linux/libtftimeseries.a ../lib/OUCommon/dist/Release/GNU-Linux/liboucommon.a -lhdf5_cpp -lhdf5 -lsz -lpthread -ldl -lz -lboost_chrono-gcc-mt-1_61 -lboost_date_time-gcc-mt-1_61 -lboost_system-gcc-mt-1_61
+
+# Build Targets
+.build-conf: ${BUILD_SUBPROJECTS}
+	"${MAKE}"  -f nbproject/Makefile-${CND_CONF}.mk ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/orderbookcheck
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/orderbookcheck: ../lib/TFTrading/dist/Release/GNU-Linux/libtftrading.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/orderbookcheck: ../lib/TFTimeSeries/dist/Release/GNU-Linux/libtftimeseries.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/orderbookcheck: ../lib/OUCommon/dist/Release/GNU-Linux/liboucommon.a
+
+${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/orderbookcheck: ${OBJECTFILES}
+	${MKDIR} -p ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}
+	${LINK.cc} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/orderbookcheck ${OBJECTFILES} ${LDLIBSOPTIONS}
+
+${OBJECTDIR}/OrderBookCheck.o: OrderBookCheck.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -O2 -I../lib -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/OrderBookCheck.o OrderBookCheck.cpp
+
+# Subprojects
+.build-subprojects:
+	cd ../lib/TFTrading && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/TFTimeSeries && ${MAKE}  -f Makefile CONF=Release
+	cd ../lib/OUCommon && ${MAKE}  -f Makefile CONF=Release
+
+# Clean Targets
+.clean-conf: ${CLEAN_SUBPROJECTS}
+	${RM} -r ${CND_BUILDDIR}/${CND_CONF}
+
+# Subprojects
+.clean-subprojects:
+	cd ../lib/TFTrading && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/TFTimeSeries && ${MAKE}  -f Makefile CONF=Release clean
+	cd ../lib/OUCommon && ${MAKE}  -f Makefile CONF=Release clean
+
+# Enable dependency checking
+.dep.inc: .depcheck-impl
+
+include .dep.inc
@@ -0,0 +1,207 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+// times CheckOutL/CheckInL of OUCommon/ReusableBuffers.h against the mutex guarded repository they replaced,
+//   which is kept below, as it was, in ns per buffer, a check out and its check in, over all threads, wall clock
+//   local: each thread checks out a few buffers, then checks them in, as a parser with its line buffers
+//   handoff: threads in pairs, one checks out and passes the buffer on, the other checks it in,
+//     as the network thread and the thread processing its lines, the hand off is the same for both repositories
+//   threads run 1, 2, 4, ... up to --threads, each line checks nothing is outstanding, the exit status is 1 if not
+// options:
+//   --count n : buffers per thread, --threads n : the most threads, --rounds n : best of
+
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+#include <boost/bind.hpp>
+#include <boost/chrono.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <OUCommon/ReusableBuffers.h>
+
+namespace {
+
+struct Buffer {  // as a line buffer
+  char rch[ 256 ];
+};
+
+namespace previous { // BufferRepository before the per thread caches, without its debug counts
+
+template<typename bufferT>
+class BufferRepository {
+public:
+  typedef bufferT* buffer_t;
+  BufferRepository(void): cntCheckins( 0 ), cntCheckouts( 0 ) {}
+  ~BufferRepository(void) {
+    boost::mutex::scoped_lock lock(m_mutex);
+    while ( !m_vStack.empty() ) {
+      delete m_vStack.back();
+      m_vStack.pop_back();
+    }
+  }
+  void CheckInL( buffer_t pBuffer ) {
+    boost::mutex::scoped_lock lock(m_mutex);
+    m_vStack.push_back( pBuffer );
+    ++cntCheckins;
+  }
+  buffer_t CheckOutL() {
+    boost::mutex::scoped_lock lock(m_mutex);
+    bufferT* pBuffer;
+    if ( m_vStack.empty() ) {
+      pBuffer = new bufferT();
+    }
+    else {
+      pBuffer = m_vStack.back();
+      m_vStack.pop_back();
+    }
+    ++cntCheckouts;
+    return pBuffer;
+  }
+  bool Outstanding( void ) { return ( cntCheckins != cntCheckouts ); };
+protected:
+  boost::mutex m_mutex;
+  std::vector<buffer_t> m_vStack;
+private:
+  std::size_t cntCheckins, cntCheckouts;
+};
+
+} // namespace previous
+
+// a common face on the repositories
+struct Previous {
+  static const char* Name( void ) { return "previous"; };
+  typedef previous::BufferRepository<Buffer> repository_t;
+};
+
+struct Cached {
+  static const char* Name( void ) { return "BufferRepository"; };
+  typedef ou::BufferRepository<Buffer> repository_t;
+};
+
+typedef boost::chrono::steady_clock clock_t_;
+
+template<typename R>
+void Local( R* pRepository, std::size_t nCount ) {
+  static const std::size_t nHeld( 8 );
+  Buffer* rpBuffer[ nHeld ];
+  for ( std::size_t ix = 0; ix < nCount; ix += nHeld ) {
+    for ( std::size_t ixHeld = 0; ixHeld < nHeld; ++ixHeld ) rpBuffer[ ixHeld ] = pRepository->CheckOutL();
+    for ( std::size_t ixHeld = 0; ixHeld < nHeld; ++ixHeld ) pRepository->CheckInL( rpBuffer[ ixHeld ] );
+  }
+}
+
+typedef boost::lockfree::spsc_queue<Buffer*, boost::lockfree::capacity<1024> > handoff_t;
+
+template<typename R>
+void Give( R* pRepository, handoff_t* pHandoff, std::size_t nCount ) {
+  for ( std::size_t ix = 0; ix < nCount; ++ix ) {
+    Buffer* pBuffer = pRepository->CheckOutL();
+    while ( !pHandoff->push( pBuffer ) ) boost::this_thread::yield();
+  }
+}
+
+template<typename R>
+void Take( R* pRepository, handoff_t* pHandoff, std::size_t nCount ) {
+  Buffer* pBuffer;
+  for ( std::size_t ix = 0; ix < nCount; ) {
+    if ( pHandoff->pop( pBuffer ) ) {
+      pRepository->CheckInL( pBuffer );
+      ++ix;
+    }
+    else boost::this_thread::yield();
+  }
+}
+
+bool s_bOk( true );
+
+void Report( const char* szRun, const char* szRepository, std::size_t nThreads, double dblBest, bool bOk ) {
+  std::cout << szRun << " " << szRepository << " threads " << nThreads << ": " << dblBest << " ns/buffer";
+  if ( !bOk ) {
+    std::cout << ", buffers outstanding";
+    s_bOk = false;
+  }
+  std::cout << std::endl;
+}
+
+template<typename T>
+void Run( const char* szRun, std::size_t nThreads, std::size_t nCount, unsigned int nRounds ) {
+  typedef typename T::repository_t repository_t;
+  const bool bHandoff( 'h' == szRun[ 0 ] );
+  double dblBest( 0.0 );
+  bool bOk( true );
+  for ( unsigned int ixRound = 0; ixRound < nRounds; ++ixRound ) {
+    repository_t repository;
+    std::vector<boost::shared_ptr<handoff_t> > vHandoff;
+    const std::size_t nTotal( nThreads * nCount );
+    clock_t_::time_point begin = clock_t_::now();
+    boost::thread_group threads;
+    if ( bHandoff ) {
+      for ( std::size_t ix = 0; ix < nThreads; ix += 2 ) {
+        vHandoff.push_back( boost::shared_ptr<handoff_t>( new handoff_t ) );
+        threads.create_thread( boost::bind( &Give<repository_t>, &repository, vHandoff.back().get(), nCount ) );
+        threads.create_thread( boost::bind( &Take<repository_t>, &repository, vHandoff.back().get(), nCount ) );
+      }
+    }
+    else {
+      for ( std::size_t ix = 0; ix < nThreads; ++ix ) {
+        threads.create_thread( boost::bind( &Local<repository_t>, &repository, nCount ) );
+      }
+    }
+    threads.join_all();
+    // a handoff pair moves nCount buffers between two threads
+    const double dblNs = boost::chrono::duration<double, boost::nano>( clock_t_::now() - begin ).count() / ( bHandoff ? nTotal / 2 : nTotal );
+    if ( ( 0 == ixRound ) || ( dblNs < dblBest ) ) dblBest = dblNs;
+    bOk = bOk && !repository.Outstanding();
+  }
+  Report( szRun, T::Name(), nThreads, dblBest, bOk );
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  std::size_t nCount( 2000000 );
+  std::size_t nThreads( 16 );
+  unsigned int nRounds( 5 );
+
+  for ( int ix = 1; ix < argc; ++ix ) {
+    const std::string sArg( argv[ ix ] );
+    if ( ( ix + 1 < argc ) && ( "--count" == sArg ) ) nCount = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--threads" == sArg ) ) nThreads = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--rounds" == sArg ) ) nRounds = std::strtoul( argv[ ++ix ], 0, 10 );
+    else {
+      std::cout << "usage: " << argv[ 0 ] << " [--count n] [--threads n] [--rounds n]" << std::endl;
+      return 2;
+    }
+  }
+
+  for ( std::size_t n = 1; n <= nThreads; n *= 2 ) {
+    Run<Previous>( "local", n, nCount, nRounds );
+    Run<Cached>( "local", n, nCount, nRounds );
+  }
+
+  for ( std::size_t n = 2; n <= nThreads; n *= 2 ) {
+    Run<Previous>( "handoff", n, nCount, nRounds );
+    Run<Cached>( "handoff", n, nCount, nRounds );
+  }
+
+  return s_bOk ? 0 : 1;
+}
@@ -0,0 +1,282 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+// times reads of the same trades through the two TimeSeriesStore backends:
+//   HDF5TimeSeriesStore, the datasets in the hdf5 file, and FlatFileTimeSeries, the files HDF5FlatFileConverter writes
+//   the data is written to a scratch directory, made current for the run, and removed after, the hdf5 file of
+//     the directory the bench is started in is not touched
+//   a day of trades per symbol, so a symbol is one dataset, and one flat file
+//   sequential: each symbol's store is opened, and the whole series read in blocks, through TimeSeriesStore::Read
+//   mapped: as sequential, the flat files walked in place, without the copy Read makes
+//   window: random windows over the symbols, a LowerBound on a time, then a read of the records from it
+//   reads are warm, the files were just written, so this compares the read paths, not the disks
+//   each line checks the sum of the prices read against the one written, the exit status is 1 if they differ
+// options:
+//   --symbols n, --records n : per symbol, --windows n, --window n : records per window, --rounds n : best of,
+//   --dir path : the scratch directory, it may not exist
+
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <stdexcept>
+#include <iostream>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <TFTimeSeries/TimeSeries.h>
+#include <TFTimeSeries/DatedDatumPod.h>
+#include <TFTimeSeries/FlatFileTimeSeries.h>
+
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesStore.h>
+#include <TFHDF5TimeSeries/HDF5FlatFileConverter.h>
+
+namespace {
+
+typedef ou::tf::pod::Trade datum_t;
+typedef ou::tf::TimeSeriesStore<datum_t> store_t;
+typedef store_t::size_type size_type;
+
+typedef boost::chrono::steady_clock clock_t_;
+
+const std::string c_sGroup( "/bench/trades/" );
+const std::string c_sFlat( "flat" );
+const boost::gregorian::date c_date( 2026, 10, 16 );
+const boost::posix_time::ptime c_dtOpen( c_date, boost::posix_time::time_duration( 13, 30, 0 ) );  // utc
+const boost::posix_time::time_duration c_tdSession( 6, 30, 0 );
+
+struct Options {
+  std::size_t nSymbols;
+  std::size_t nRecords;
+  std::size_t nWindows;
+  std::size_t nWindow;
+  unsigned int nRounds;
+  Options( void ): nSymbols( 20 ), nRecords( 200000 ), nWindows( 20000 ), nWindow( 256 ), nRounds( 5 ) {};
+};
+
+std::string Symbol( std::size_t ix ) { return "SYM" + boost::lexical_cast<std::string>( ix ); };
+
+double Price( std::size_t ixSymbol, std::size_t ix ) { return 10.0 + ixSymbol + 0.01 * ( ix % 1000 ); };
+
+boost::posix_time::ptime Time( std::size_t ix, std::size_t nRecords ) {  // spread over the session
+  return c_dtOpen + boost::posix_time::microseconds( ( c_tdSession.total_microseconds() / nRecords ) * ix );
+}
+
+// the hdf5 datasets, then the flat files from them, returns the sum of the prices written
+double Write( const Options& options ) {
+  double dblSum( 0.0 );
+  {
+    ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+    dm.AddGroup( c_sGroup );
+    for ( std::size_t ixSymbol = 0; ixSymbol < options.nSymbols; ++ixSymbol ) {
+      ou::tf::Trades trades;
+      for ( std::size_t ix = 0; ix < options.nRecords; ++ix ) {
+        const double dblPrice( Price( ixSymbol, ix ) );
+        trades.Append( ou::tf::Trade( Time( ix, options.nRecords ), dblPrice, 100 ) );
+        dblSum += dblPrice;
+      }
+      ou::tf::HDF5WriteTimeSeries<ou::tf::Trades> wts( dm, false, true, 0, 1024 );  // uncompressed, the default chunk size
+      wts.Write( c_sGroup + Symbol( ixSymbol ), &trades );
+    }
+  }
+  ou::tf::HDF5FlatFileConverter converter( c_sFlat );
+  const ou::tf::HDF5FlatFileConverter::stats_t& stats( converter.Convert( c_sGroup ) );
+  std::cout
+    << options.nSymbols << " symbols, " << options.nRecords << " trades each, "
+    << sizeof( datum_t ) << " bytes a trade, " << stats.nFiles << " flat files" << std::endl;
+  // the writer and the converter report their failures rather than throw
+  if ( ( options.nSymbols != stats.nFiles ) || ( options.nSymbols * options.nRecords != stats.nRecords ) ) {
+    throw std::runtime_error( "the datasets were not all written and converted" );
+  }
+  return dblSum;
+}
+
+// a common face on the stores
+struct HDF5 {
+  static const char* Name( void ) { return "HDF5TimeSeriesStore"; };
+  ou::tf::HDF5DataManager dm;
+  HDF5( void ): dm( ou::tf::HDF5DataManager::RO ) {};
+  store_t* Open( const std::string& sSymbol ) { return new ou::tf::HDF5TimeSeriesStore<datum_t>( dm, c_sGroup + sSymbol ); };
+};
+
+struct Flat {
+  static const char* Name( void ) { return "FlatFileTimeSeries"; };
+  store_t* Open( const std::string& sSymbol ) {
+    return new ou::tf::FlatFileTimeSeries<datum_t>( ou::tf::FlatFile::FileName( c_sFlat, datum_t::Signature(), c_date, sSymbol ) );
+  };
+};
+
+bool s_bOk( true );
+
+void Report( const char* szRun, const char* szStore, double dblNsBest, std::size_t nRecords, bool bOk ) {
+  std::cout
+    << szRun << " " << szStore << ": " << dblNsBest / nRecords << " ns/record, "
+    << ( nRecords * sizeof( datum_t ) ) / ( dblNsBest / 1e9 ) / ( 1024 * 1024 ) << " MB/s";
+  if ( !bOk ) {
+    std::cout << ", prices differ from those written";
+    s_bOk = false;
+  }
+  std::cout << std::endl;
+}
+
+double Ns( const clock_t_::time_point& begin ) {
+  return boost::chrono::duration<double, boost::nano>( clock_t_::now() - begin ).count();
+}
+
+template<typename S>
+void Sequential( const Options& options, double dblSum ) {
+  static const size_type nBlock( 4096 );
+  std::vector<datum_t> v( nBlock );
+  double dblBest( 0.0 );
+  bool bOk( true );
+  for ( unsigned int ixRound = 0; ixRound < options.nRounds; ++ixRound ) {
+    S s;
+    double dblRead( 0.0 );
+    clock_t_::time_point begin = clock_t_::now();
+    for ( std::size_t ixSymbol = 0; ixSymbol < options.nSymbols; ++ixSymbol ) {
+      boost::shared_ptr<store_t> pStore( s.Open( Symbol( ixSymbol ) ) );
+      const size_type size( pStore->Size() );
+      for ( size_type ix = 0; ix < size; ix += nBlock ) {
+        const size_type n( std::min( nBlock, size - ix ) );
+        pStore->Read( ix, n, &v[ 0 ] );
+        for ( size_type ixBlock = 0; ixBlock < n; ++ixBlock ) dblRead += v[ ixBlock ].Price();
+      }
+    }
+    const double dblNs( Ns( begin ) );
+    if ( ( 0 == ixRound ) || ( dblNs < dblBest ) ) dblBest = dblNs;
+    bOk = bOk && ( dblSum == dblRead );
+  }
+  Report( "sequential", S::Name(), dblBest, options.nSymbols * options.nRecords, bOk );
+}
+
+void Mapped( const Options& options, double dblSum ) {
+  typedef ou::tf::FlatFileTimeSeries<datum_t> flat_t;
+  double dblBest( 0.0 );
+  bool bOk( true );
+  for ( unsigned int ixRound = 0; ixRound < options.nRounds; ++ixRound ) {
+    double dblRead( 0.0 );
+    clock_t_::time_point begin = clock_t_::now();
+    for ( std::size_t ixSymbol = 0; ixSymbol < options.nSymbols; ++ixSymbol ) {
+      flat_t flat( ou::tf::FlatFile::FileName( c_sFlat, datum_t::Signature(), c_date, Symbol( ixSymbol ) ) );
+      for ( flat_t::const_iterator iter = flat.begin(); flat.end() != iter; ++iter ) dblRead += iter->Price();
+    }
+    const double dblNs( Ns( begin ) );
+    if ( ( 0 == ixRound ) || ( dblNs < dblBest ) ) dblBest = dblNs;
+    bOk = bOk && ( dblSum == dblRead );
+  }
+  Report( "mapped", Flat::Name(), dblBest, options.nSymbols * options.nRecords, bOk );
+}
+
+template<typename S>
+void Window( const Options& options ) {
+  std::vector<datum_t> v;
+  double dblBest( 0.0 );
+  bool bOk( true );
+  std::size_t nRead( 0 );
+  for ( unsigned int ixRound = 0; ixRound < options.nRounds; ++ixRound ) {
+    S s;
+    std::vector<boost::shared_ptr<store_t> > vpStore;
+    for ( std::size_t ixSymbol = 0; ixSymbol < options.nSymbols; ++ixSymbol ) {
+      vpStore.push_back( boost::shared_ptr<store_t>( s.Open( Symbol( ixSymbol ) ) ) );
+    }
+    boost::random::mt19937 rng( 17 );  // the same windows for each store
+    boost::random::uniform_int_distribution<std::size_t> symbol( 0, options.nSymbols - 1 );
+    boost::random::uniform_int_distribution<std::size_t> record( 0, options.nRecords - 1 );
+    nRead = 0;
+    clock_t_::time_point begin = clock_t_::now();
+    for ( std::size_t ixWindow = 0; ixWindow < options.nWindows; ++ixWindow ) {
+      const std::size_t ixSymbol( symbol( rng ) );
+      const std::size_t ixRecord( record( rng ) );
+      store_t& store( *vpStore[ ixSymbol ] );
+      const size_type ixBegin( store.LowerBound( Time( ixRecord, options.nRecords ) ) );
+      const size_type n( std::min<size_type>( options.nWindow, store.Size() - ixBegin ) );
+      v.resize( n );
+      if ( 0 < n ) store.Read( ixBegin, n, &v[ 0 ] );
+      nRead += n;
+      bOk = bOk && ( ixRecord == ixBegin ) && ( 0 < n ) && ( Price( ixSymbol, ixRecord ) == v[ 0 ].Price() );
+    }
+    const double dblNs( Ns( begin ) );
+    if ( ( 0 == ixRound ) || ( dblNs < dblBest ) ) dblBest = dblNs;
+  }
+  Report( "window", S::Name(), dblBest, nRead, bOk );
+  std::cout << "  " << dblBest / options.nWindows / 1000.0 << " us/window" << std::endl;
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  Options options;
+  std::string sDir( "TimeSeriesStoreBench.tmp" );
+
+  for ( int ix = 1; ix < argc; ++ix ) {
+    const std::string sArg( argv[ ix ] );
+    if ( ( ix + 1 < argc ) && ( "--symbols" == sArg ) ) options.nSymbols = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--records" == sArg ) ) options.nRecords = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--windows" == sArg ) ) options.nWindows = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--window" == sArg ) ) options.nWindow = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--rounds" == sArg ) ) options.nRounds = std::strtoul( argv[ ++ix ], 0, 10 );
+    else if ( ( ix + 1 < argc ) && ( "--dir" == sArg ) ) sDir = argv[ ++ix ];
+    else {
+      std::cout << "usage: " << argv[ 0 ] << " [--symbols n] [--records n] [--windows n] [--window n] [--rounds n] [--dir path]" << std::endl;
+      return 2;
+    }
+  }
+
+  if ( ( 0 == options.nSymbols ) || ( 0 == options.nRecords ) ) {
+    std::cout << "symbols and records need to be more than 0" << std::endl;
+    return 2;
+  }
+
+  const boost::filesystem::path pathStart( boost::filesystem::current_path() );
+  const boost::filesystem::path pathScratch( boost::filesystem::absolute( sDir ) );
+  if ( boost::filesystem::exists( pathScratch ) ) {
+    std::cout << pathScratch << " exists, the bench needs a directory of its own" << std::endl;
+    return 2;
+  }
+  boost::filesystem::create_directories( pathScratch );
+  boost::filesystem::current_path( pathScratch );
+
+  try {
+    const double dblSum( Write( options ) );
+
+    Sequential<HDF5>( options, dblSum );
+    Sequential<Flat>( options, dblSum );
+    Mapped( options, dblSum );
+
+    Window<HDF5>( options );
+    Window<Flat>( options );
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "hdf5: " << e.getDetailMsg() << std::endl;
+    s_bOk = false;
+  }
+  catch ( std::runtime_error& e ) {
+    std::cout << e.what() << std::endl;
+    s_bOk = false;
+  }
+
+  boost::filesystem::current_path( pathStart );
+  boost::filesystem::remove_all( pathScratch );
+
+  return s_bOk ? 0 : 1;
+}
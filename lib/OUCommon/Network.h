@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <cstring>
 
 #include <typeinfo>
 #include <sstream>
@@ -36,6 +37,7 @@
 #include <OUCommon/Debug.h>
 
 #include "ReusableBuffers.h"
+#include "NetworkCapture.h"
 
 // custom on
 // http://msdn.microsoft.com/en-us/library/e5ewb1h3.aspx
@@ -68,6 +70,14 @@ using boost::asio::ip::tcp;
 //   or come up with a different scheme of managing iterators over multiple buffers for use by Spirit
 // need code to catch when the socket is closed for whatever reason
 // provide an interator capability scan buffers with out the re-copy process, useful for the news parsing libraries
+// 2026/10/18 lines are framed with memchr over the whole receive buffer rather than a byte at a time:
+//   OnNetworkLineBuffer: each line is copied in bulk into a line buffer, as before, cr removed
+//   OnNetworkLineView: when the owner defines it, used instead, a line lying within one receive buffer
+//     is handed over in place as [begin,end), less its trailing cr, only lines straddling two reads are copied,
+//     the view is valid only for the duration of the call
+//   NETWORK_INPUT_BUF_SIZE may be defined larger for the build, fewer reads, fewer straddled lines
+// 2026/10/18 StartCapture writes each read, as received, with its receipt time, to a capture file,
+//   NetworkReplayServer plays a capture file back to a client, see NetworkCapture.h
 
 // ownerT:  CRTP class
 // charT:  type of character processed 
@@ -85,7 +95,9 @@ public:
     ERROR_CONNECT
   };
 
+#ifndef NETWORK_INPUT_BUF_SIZE
 #define NETWORK_INPUT_BUF_SIZE 2048
+#endif
 
   typedef unsigned short port_t;
   typedef std::string ipaddress_t;
@@ -100,6 +112,7 @@ public:
 
   // factor a couple of these out as traits for here and for IQFeedMessages.
   typedef charT bufferelement_t;
+  static_assert( 1 == sizeof( charT ), "lines are framed with memchr" );
   typedef boost::array<bufferelement_t, NETWORK_INPUT_BUF_SIZE> inputbuffer_t; // bulk input buffer via asio
   typedef BufferRepository<inputbuffer_t> inputrepository_t;
   typedef std::vector<bufferelement_t> linebuffer_t;  // used for composing lines of data for processing
@@ -117,6 +130,8 @@ public:
   void Disconnect( void );
   void Send( const std::string&, bool bNotifyOnDone = false ); // string being sent out to network
   void GiveBackBuffer( linebuffer_t* p ) { m_reposLineBuffers.CheckInL( p ); };  // parsed buffer being given back to accept more parsed network traffic
+  void StartCapture( const std::string& sPath );  // raw input from the next read on, throws when the file can't be opened
+  void StopCapture( void );
 
 protected:
 
@@ -125,6 +140,7 @@ protected:
   void OnNetworkDisconnected(void) {};
   void OnNetworkError( size_t ) {;};
   void OnNetworkLineBuffer( linebuffer_t* ) {};  // new line available for processing
+  void OnNetworkLineView( const bufferelement_t* /* begin */, const bufferelement_t* /* end */ ) {};  // new line, in place, see note at top
   void OnNetworkSendDone(void) {};
 
 private:
@@ -158,6 +174,8 @@ private:
 
   linebuffer_t* m_pline;  // current parsing results
 
+  NetworkCaptureWriter* m_pCapture;  // used on the asio thread only
+
   size_t m_cntAsyncReads;
   size_t m_cntBytesTransferred_input;
   size_t m_cntLinesProcessed;
@@ -171,6 +189,7 @@ private:
   void OnSendDone( const boost::system::error_code& error, std::size_t bytes_transferred, linebuffer_t* );
   void OnSendDoneNoNotify( const boost::system::error_code& error, std::size_t bytes_transferred, linebuffer_t* );
   void OnReadDone( const boost::system::error_code& error, std::size_t bytes_transferred, inputbuffer_t* );
+  void AppendToLine( const bufferelement_t* begin, const bufferelement_t* end );
   void AsyncRead( void );
 
   void AsioThread( void );
@@ -178,6 +197,8 @@ private:
   void CommonConstruction( void );
   void OnTimeOut( void );
 
+  void SetCapture( NetworkCaptureWriter* pCapture );
+
 };
 
 // 
@@ -245,6 +266,7 @@ template <typename ownerT, typename charT>
 void Network<ownerT,charT>::CommonConstruction( void ) {
   m_pline = m_reposLineBuffers.CheckOutL();  // have a receiving line ready
   m_pline->clear();
+  m_pCapture = NULL;
   m_pwork = new boost::asio::io_service::work(m_io);  // keep the asio service running 
   m_asioThread = boost::thread( boost::bind( &Network::AsioThread, this ) );
   m_stateNetwork = NS_DISCONNECTED;
@@ -269,6 +291,9 @@ Network<ownerT,charT>::~Network(void) {
 
   m_asioThread.join();  // wait for i/o thread to cleanup and terminate
 
+  delete m_pCapture;
+  m_pCapture = NULL;
+
   m_stateNetwork = NS_CLOSING;
 
 //  delete m_asioThread;
@@ -346,6 +371,27 @@ void Network<ownerT,charT>::Connect( void ) {
   m_timer.async_wait( boost::bind<void>( &Network::OnTimeOut, this ) );
 }
 
+//
+// StartCapture, StopCapture
+//   the writer is handed to the asio thread, which does the writing
+//
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::StartCapture( const std::string& sPath ) {
+  m_io.post( boost::bind( &Network::SetCapture, this, new NetworkCaptureWriter( sPath ) ) );
+}
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::StopCapture( void ) {
+  m_io.post( boost::bind( &Network::SetCapture, this, static_cast<NetworkCaptureWriter*>( NULL ) ) );
+}
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::SetCapture( NetworkCaptureWriter* pCapture ) {
+  delete m_pCapture;
+  m_pCapture = pCapture;
+}
+
 template <typename ownerT, typename charT>
 void Network<ownerT,charT>::OnTimeOut( void ) {
   if ( NS_CONNECTING == m_stateNetwork ) {
@@ -484,6 +530,10 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
   else {
     assert( ( NS_CONNECTED == m_stateNetwork ) || ( NS_DISCONNECTING == m_stateNetwork) );
 
+    if ( NULL != m_pCapture ) {
+      m_pCapture->Write( boost::posix_time::microsec_clock::universal_time(), pbuffer->data(), bytes_transferred );
+    }
+
     ++m_cntAsyncReads;
     m_cntBytesTransferred_input += bytes_transferred;
 
@@ -491,33 +541,41 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
 
     // process the buffer:
     // need current linebuffer, need stats on how often it waits for subsequent bulk data
-    bufferelement_t ch;
-    typename inputbuffer_t::const_iterator input = pbuffer->begin();
-    while ( 0 != bytes_transferred ) {
-      ch = *input;
-      ++input;
-      if ( 0 == ch ) {
-//        OutputDebugString( "Network::ReadHandler: have a 0x00 character.\n" );
+    const bool bView( &Network<ownerT, charT>::OnNetworkLineView != &ownerT::OnNetworkLineView );
+    const bufferelement_t* input = pbuffer->data();
+    const bufferelement_t* const end = input + bytes_transferred;
+    while ( end != input ) {
+      const bufferelement_t* eol = static_cast<const bufferelement_t*>( std::memchr( input, 0x0a, end - input ) );
+      if ( NULL == eol ) {
+        AppendToLine( input, end );  // remainder of the line arrives with the next read
+        break;
+      }
+      if ( bView ) {
+        if ( m_pline->empty() ) {
+          const bufferelement_t* eos = ( ( input != eol ) && ( 0x0d == *( eol - 1 ) ) ) ? eol - 1 : eol;
+          static_cast<ownerT*>( this )->OnNetworkLineView( input, eos );
+        }
+        else {
+          // straddled the previous read
+          m_pline->insert( m_pline->end(), input, eol );
+          if ( 0x0d == m_pline->back() ) m_pline->pop_back();
+          const bufferelement_t* begin = m_pline->empty() ? NULL : &m_pline->front();
+          static_cast<ownerT*>( this )->OnNetworkLineView( begin, begin + m_pline->size() );
+          m_pline->clear();
+        }
       }
-      if ( 0x0a == ch ) {
+      else {
+        AppendToLine( input, eol );
         // send the buffer off 
         if ( &Network<ownerT, charT>::OnNetworkLineBuffer != &ownerT::OnNetworkLineBuffer ) {
           static_cast<ownerT*>( this )->OnNetworkLineBuffer( m_pline );
         }
-        ++m_cntLinesProcessed;
         // and allocate another buffer
         m_pline = m_reposLineBuffers.CheckOutL();
         m_pline->clear();
       }
-      else {
-        if ( 0x0d == ch ) {
-          // ignore the character
-        }
-        else {
-          m_pline->push_back( ch );
-        }
-      }
-      --bytes_transferred;
+      ++m_cntLinesProcessed;
+      input = eol + 1;
     } // end while
 
   }
@@ -527,6 +585,26 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
   boost::interprocess::ipcdetail::atomic_dec32( &m_lReadProgress );
 }
 
+//
+// AppendToLine
+//
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::AppendToLine( const bufferelement_t* begin, const bufferelement_t* end ) {
+  if ( &Network<ownerT, charT>::OnNetworkLineView != &ownerT::OnNetworkLineView ) {
+    m_pline->insert( m_pline->end(), begin, end );  // trailing cr is dropped when the line completes
+  }
+  else {
+    // cr is dropped wherever it is, as it always has been for line buffers
+    while ( begin != end ) {
+      const bufferelement_t* cr = static_cast<const bufferelement_t*>( std::memchr( begin, 0x0d, end - begin ) );
+      if ( NULL == cr ) cr = end;
+      m_pline->insert( m_pline->end(), begin, cr );
+      begin = ( end == cr ) ? end : cr + 1;
+    }
+  }
+}
+
 //
 // Send
 //
@@ -0,0 +1,157 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+// Started 2026/10/18
+
+// raw network capture files: the bytes of each read, as received, with the time received
+//   written by Network when capturing, read back by NetworkReplayServer
+// layout:
+//   "OUNETCAP" followed by a version byte
+//   then a record per read:
+//     microseconds since the previous record ( since the epoch for the first ), zigzag varint
+//     byte count, varint
+//     the bytes
+//   a record costs two or three bytes besides its content
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+namespace ou { // One Unified
+
+namespace capture {
+
+  static const char szMagic[] = "OUNETCAP";
+  static const std::size_t nMagic = 8;
+  static const char chVersion = 1;
+
+  inline boost::int64_t MicroSeconds( boost::posix_time::ptime dt ) {
+    static const boost::posix_time::ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+    return ( dt - dtEpoch ).total_microseconds();
+  }
+
+  inline boost::posix_time::ptime Time( boost::int64_t us ) {
+    static const boost::posix_time::ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+    return dtEpoch + boost::posix_time::microseconds( us );
+  }
+
+} // namespace capture
+
+class NetworkCaptureWriter: boost::noncopyable {
+public:
+
+  explicit NetworkCaptureWriter( const std::string& sPath )
+  : m_file( sPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc ), m_usPrevious( 0 )
+  {
+    if ( !m_file.is_open() ) throw std::runtime_error( "NetworkCaptureWriter: can not open " + sPath );
+    m_file.write( capture::szMagic, capture::nMagic );
+    m_file.put( capture::chVersion );
+  }
+
+  ~NetworkCaptureWriter( void ) {};
+
+  void Write( boost::posix_time::ptime dtReceived, const void* pData, std::size_t nData ) {
+    boost::int64_t us = capture::MicroSeconds( dtReceived );
+    boost::int64_t delta = us - m_usPrevious;  // receipt times can step back when the clock is adjusted
+    m_usPrevious = us;
+    PutVarint( ( static_cast<boost::uint64_t>( delta ) << 1 ) ^ static_cast<boost::uint64_t>( delta >> 63 ) );
+    PutVarint( nData );
+    m_file.write( static_cast<const char*>( pData ), nData );
+  }
+
+  void Flush( void ) { m_file.flush(); };
+
+protected:
+private:
+
+  std::ofstream m_file;
+  boost::int64_t m_usPrevious;
+
+  void PutVarint( boost::uint64_t n ) {
+    char rBuf[ 10 ];
+    std::size_t ix = 0;
+    while ( 0x80 <= n ) {
+      rBuf[ ix++ ] = static_cast<char>( 0x80 | ( n & 0x7f ) );
+      n >>= 7;
+    }
+    rBuf[ ix++ ] = static_cast<char>( n );
+    m_file.write( rBuf, ix );
+  }
+};
+
+class NetworkCaptureReader: boost::noncopyable {
+public:
+
+  explicit NetworkCaptureReader( const std::string& sPath )
+  : m_file( sPath.c_str(), std::ios::in | std::ios::binary ), m_usPrevious( 0 )
+  {
+    if ( !m_file.is_open() ) throw std::runtime_error( "NetworkCaptureReader: can not open " + sPath );
+    char rHeader[ capture::nMagic + 1 ];
+    m_file.read( rHeader, capture::nMagic + 1 );
+    if ( !m_file
+      || ( 0 != std::string( rHeader, capture::nMagic ).compare( capture::szMagic ) )
+      || ( capture::chVersion != rHeader[ capture::nMagic ] ) ) {
+      throw std::runtime_error( "NetworkCaptureReader: not a capture file " + sPath );
+    }
+  }
+
+  ~NetworkCaptureReader( void ) {};
+
+  // false at the end of the file, a record cut short by the end of a capture is dropped
+  bool Read( boost::int64_t& usReceived, std::vector<char>& vData ) {
+    boost::uint64_t zigzag, nData;
+    if ( !GetVarint( zigzag ) || !GetVarint( nData ) ) return false;
+    vData.resize( nData );
+    if ( 0 != nData ) {
+      m_file.read( &vData[ 0 ], nData );
+      if ( !m_file ) return false;
+    }
+    m_usPrevious += static_cast<boost::int64_t>( ( zigzag >> 1 ) ^ ( ~( zigzag & 1 ) + 1 ) );
+    usReceived = m_usPrevious;
+    return true;
+  }
+
+  bool Read( boost::posix_time::ptime& dtReceived, std::vector<char>& vData ) {
+    boost::int64_t us;
+    if ( !Read( us, vData ) ) return false;
+    dtReceived = capture::Time( us );
+    return true;
+  }
+
+protected:
+private:
+
+  std::ifstream m_file;
+  boost::int64_t m_usPrevious;
+
+  bool GetVarint( boost::uint64_t& n ) {
+    n = 0;
+    for ( unsigned int shift = 0; 64 > shift; shift += 7 ) {
+      int ch = m_file.get();
+      if ( std::char_traits<char>::eof() == ch ) return false;
+      n |= static_cast<boost::uint64_t>( ch & 0x7f ) << shift;
+      if ( 0 == ( ch & 0x80 ) ) return true;
+    }
+    return false;
+  }
+};
+
+} // namespace ou
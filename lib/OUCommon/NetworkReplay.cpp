@@ -0,0 +1,144 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <boost/bind.hpp>
+
+#include "NetworkReplay.h"
+
+namespace ou { // One Unified
+
+NetworkReplayServer::NetworkReplayServer( const std::string& sPath, port_t nPort, enumPacing pacing )
+: m_reader( sPath ), m_nPort( nPort ), m_pacing( pacing ),
+  m_acceptor( m_io ), m_socket( m_io ), m_timer( m_io ),
+  m_bRecord( false ), m_usRecord( 0 ), m_usFirst( 0 ),
+  m_cntRecords( 0 ), m_cntBytes( 0 )
+{
+}
+
+NetworkReplayServer::~NetworkReplayServer( void ) {
+  m_io.stop();
+  if ( m_thread.joinable() ) m_thread.join();
+}
+
+void NetworkReplayServer::Start( void ) {
+  boost::asio::ip::tcp::endpoint endpoint( boost::asio::ip::address_v4::loopback(), m_nPort );
+  m_acceptor.open( endpoint.protocol() );
+  m_acceptor.set_option( boost::asio::ip::tcp::acceptor::reuse_address( true ) );
+  m_acceptor.bind( endpoint );
+  m_acceptor.listen();
+  m_acceptor.async_accept( m_socket, boost::bind( &NetworkReplayServer::OnAccept, this, boost::asio::placeholders::error ) );
+  m_thread = boost::thread( boost::bind( &boost::asio::io_service::run, &m_io ) );
+}
+
+void NetworkReplayServer::Wait( void ) {
+  m_thread.join();
+}
+
+void NetworkReplayServer::OnAccept( const boost::system::error_code& error ) {
+  m_acceptor.close();  // one client
+  if ( error ) return;
+  m_socket.set_option( boost::asio::ip::tcp::no_delay( true ) );
+  m_socket.async_read_some(
+    boost::asio::buffer( m_rDiscard ),
+    boost::bind( &NetworkReplayServer::OnDiscard, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred ) );
+  m_dtStart = boost::posix_time::microsec_clock::universal_time();
+  m_bRecord = ReadRecord();
+  m_usFirst = m_usRecord;
+  Next();
+}
+
+void NetworkReplayServer::OnDiscard( const boost::system::error_code& error, std::size_t /* bytes_transferred */ ) {
+  if ( error ) {
+    Release();  // client closed
+  }
+  else {
+    m_socket.async_read_some(
+      boost::asio::buffer( m_rDiscard ),
+      boost::bind( &NetworkReplayServer::OnDiscard, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred ) );
+  }
+}
+
+bool NetworkReplayServer::ReadRecord( void ) {
+  return m_reader.Read( m_usRecord, m_vRecord );
+}
+
+void NetworkReplayServer::Next( void ) {
+  if ( !m_bRecord ) {
+    Close();
+    return;
+  }
+  m_vOut.clear();
+  if ( AsFastAsPossible == m_pacing ) {
+    while ( m_bRecord && ( nCoalesce > m_vOut.size() ) ) {
+      m_vOut.insert( m_vOut.end(), m_vRecord.begin(), m_vRecord.end() );
+      ++m_cntRecords;
+      m_bRecord = ReadRecord();
+    }
+    Write();
+  }
+  else {
+    m_vOut.swap( m_vRecord );
+    ++m_cntRecords;
+    boost::posix_time::ptime dtDue = m_dtStart + boost::posix_time::microseconds( m_usRecord - m_usFirst );
+    m_bRecord = ReadRecord();
+    if ( boost::posix_time::microsec_clock::universal_time() < dtDue ) {
+      m_timer.expires_at( dtDue );
+      m_timer.async_wait( boost::bind( &NetworkReplayServer::Write, this ) );
+    }
+    else {
+      Write();
+    }
+  }
+}
+
+void NetworkReplayServer::Write( void ) {
+  if ( m_vOut.empty() ) {
+    Next();
+  }
+  else {
+    boost::asio::async_write(
+      m_socket, boost::asio::buffer( m_vOut ),
+      boost::bind( &NetworkReplayServer::OnWritten, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred ) );
+  }
+}
+
+void NetworkReplayServer::OnWritten( const boost::system::error_code& error, std::size_t bytes_transferred ) {
+  m_cntBytes += bytes_transferred;
+  if ( error ) {
+    Close();  // client went away
+  }
+  else {
+    Next();
+  }
+}
+
+void NetworkReplayServer::Close( void ) {
+  m_tdElapsed = boost::posix_time::microsec_clock::universal_time() - m_dtStart;
+  // the client sees the end of the stream, and gets a moment to close its side,
+  //   closing with its commands unread would reset the connection, and lose the tail of the replay
+  boost::system::error_code error;
+  m_socket.shutdown( boost::asio::ip::tcp::socket::shutdown_send, error );
+  m_timer.expires_from_now( boost::posix_time::seconds( 1 ) );
+  m_timer.async_wait( boost::bind( &NetworkReplayServer::Release, this ) );
+}
+
+void NetworkReplayServer::Release( void ) {
+  boost::system::error_code error;
+  m_timer.cancel( error );
+  m_socket.close( error );  // the pending discard read is cancelled, and the thread runs out of work
+}
+
+} // namespace ou
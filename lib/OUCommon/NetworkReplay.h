@@ -0,0 +1,94 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+// Started 2026/10/18
+
+// stands in for a feed server: listens on a local port, and plays a capture file,
+//   as written by Network::StartCapture, to the first client to connect,
+//   then closes the connection, what the client sends is read and dropped
+//   so an unmodified client ( IQFeedProvider on port 5009 ) can be run from a recorded session
+// pacing:
+//   AsRecorded: each read goes out when it arrived, relative to the first, writes are not coalesced
+//   AsFastAsPossible: the reads are coalesced into large writes, sent as fast as the client takes them
+
+#include <string>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "NetworkCapture.h"
+
+namespace ou { // One Unified
+
+class NetworkReplayServer: boost::noncopyable {
+public:
+
+  typedef unsigned short port_t;
+
+  enum enumPacing { AsRecorded, AsFastAsPossible };
+
+  NetworkReplayServer( const std::string& sPath, port_t nPort, enumPacing pacing = AsRecorded );  // throws on a bad file
+  ~NetworkReplayServer( void );
+
+  void Start( void );  // throws when the port can't be listened on
+  void Wait( void );  // returns once the file has been played, and the connection closed, at most a second later
+
+  // available after Wait
+  std::size_t Records( void ) const { return m_cntRecords; };
+  std::size_t Bytes( void ) const { return m_cntBytes; };
+  boost::posix_time::time_duration Elapsed( void ) const { return m_tdElapsed; };  // from connection to the last write
+
+protected:
+private:
+
+  enum { nCoalesce = 65536 };  // write size when not paced
+
+  NetworkCaptureReader m_reader;
+  port_t m_nPort;
+  enumPacing m_pacing;
+
+  boost::asio::io_service m_io;
+  boost::asio::ip::tcp::acceptor m_acceptor;
+  boost::asio::ip::tcp::socket m_socket;
+  boost::asio::deadline_timer m_timer;
+  boost::thread m_thread;
+
+  std::vector<char> m_vRecord;  // read, not yet sent
+  bool m_bRecord;
+  boost::int64_t m_usRecord;
+  boost::int64_t m_usFirst;
+  std::vector<char> m_vOut;  // being written
+  char m_rDiscard[ 1024 ];
+
+  boost::posix_time::ptime m_dtStart;
+  std::size_t m_cntRecords;
+  std::size_t m_cntBytes;
+  boost::posix_time::time_duration m_tdElapsed;
+
+  void OnAccept( const boost::system::error_code& error );
+  void OnDiscard( const boost::system::error_code& error, std::size_t bytes_transferred );
+  void Next( void );
+  void Write( void );
+  void OnWritten( const boost::system::error_code& error, std::size_t bytes_transferred );
+  bool ReadRecord( void );
+  void Close( void );
+  void Release( void );
+};
+
+} // namespace ou
@@ -18,9 +18,14 @@
 #include <sstream>
 //#include <typeinfo.h>
 #include <cassert>
+#include <algorithm>
 
+#include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/tss.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/locks.hpp>
+#include <boost/lockfree/stack.hpp>
 
 // mechanism of re-usable buffers, removes the execution overhead of new/delete
 
@@ -54,6 +59,16 @@
 // most usage may be single thread mode now, as buffers are being returned to the original
 //   thread for storage (actually possibly no, cross thread returns are used)
 
+// 2026/10/18 CheckOutL/CheckInL no longer lock:
+//   each thread keeps its own cache of free buffers for each repository,
+//   a cache grown past two batches pushes a batch onto a lock free stack shared by the threads,
+//   an empty cache pops a batch from that stack before allocating,
+//   so a buffer checked out on one thread and checked in on another comes back in batches,
+//   the mutex is taken only when a thread first uses a repository, when it ends, and by Outstanding
+//   caches keep a reference to the shared stack, so a thread may end after the repository is gone,
+//   the buffers of a thread still running when the repository is destroyed are deleted when it ends
+// CheckOut/CheckIn, the unlocked versions, keep their own stack, for single threaded use
+
 namespace ou {
 
 template<typename bufferT> 
@@ -65,13 +80,52 @@ public:
   ~BufferRepository(void);
   inline void CheckIn( buffer_t Buffer );
   inline buffer_t CheckOut();  
-  void CheckInL( buffer_t Buffer );  // locked version
-  buffer_t CheckOutL();  // locked version
-  bool Outstanding( void ) { return ( cntCheckins != cntCheckouts ); };
+  void CheckInL( buffer_t Buffer );  // thread safe version, may be on a thread other than the CheckOutL
+  buffer_t CheckOutL();  // thread safe version
+  bool Outstanding( void );  // exact once the threads using the repository are quiet
 protected:
-  boost::mutex m_mutex;
   std::vector<buffer_t> m_vStack;
 private:
+
+  enum { nBatch = 32 };  // buffers moved between a thread's cache and the shared stack at a time
+
+  typedef boost::atomic<std::size_t> counter_t;
+
+  struct Batch {
+    std::size_t n;
+    buffer_t rBuffer[ nBatch ];
+  };
+
+  struct Shared;
+
+  struct Cache {  // a thread's free buffers for this repository
+    boost::shared_ptr<Shared> pShared;
+    std::vector<buffer_t> vBuffer;
+    counter_t cntCheckins, cntCheckouts;  // written by the owning thread only, read by Outstanding
+#ifdef _DEBUG
+    counter_t cntCreated, maxQsize;
+#endif
+    Cache( boost::shared_ptr<Shared> pShared_ );
+    ~Cache( void );  // on thread end, or repository destruction: buffers go to the shared stack
+    void Count( counter_t& cnt ) { cnt.store( cnt.load( boost::memory_order_relaxed ) + 1, boost::memory_order_relaxed ); };
+  };
+
+  struct Shared {  // lives until the repository and every cache are gone
+    boost::lockfree::stack<Batch> stack;
+    boost::mutex mutex;  // for vCache and the counts of the caches already gone
+    std::vector<Cache*> vCache;
+    std::size_t cntCheckins, cntCheckouts;
+#ifdef _DEBUG
+    std::size_t cntCreated, maxQsize;
+#endif
+    Shared( void );
+    ~Shared( void ) { Clear(); };
+    std::size_t Clear( void );  // deletes the buffers on the stack
+  };
+
+  boost::shared_ptr<Shared> m_pShared;
+  boost::thread_specific_ptr<Cache> m_tspCache;
+
   std::size_t cntCheckins, cntCheckouts;
 #ifdef _DEBUG
   std::size_t cntCreated, cntDestroyed, maxQsize;
@@ -79,11 +133,64 @@ private:
   bool m_bCheckingIn;
   std::string m_sType;
 #endif
+
+  Cache& GetCache( void );
 };
 
+template<typename bufferT> BufferRepository<bufferT>::Cache::Cache( boost::shared_ptr<Shared> pShared_ )
+: pShared( pShared_ ), cntCheckins( 0 ), cntCheckouts( 0 )
+#ifdef _DEBUG
+  , cntCreated( 0 ), maxQsize( 0 )
+#endif
+{
+  vBuffer.reserve( 2 * nBatch );
+  boost::mutex::scoped_lock lock( pShared->mutex );
+  pShared->vCache.push_back( this );
+}
+
+template<typename bufferT> BufferRepository<bufferT>::Cache::~Cache( void ) {
+  {
+    boost::mutex::scoped_lock lock( pShared->mutex );
+    pShared->vCache.erase( std::find( pShared->vCache.begin(), pShared->vCache.end(), this ) );
+    pShared->cntCheckins += cntCheckins.load();
+    pShared->cntCheckouts += cntCheckouts.load();
+#ifdef _DEBUG
+    pShared->cntCreated += cntCreated.load();
+    pShared->maxQsize = std::max<std::size_t>( pShared->maxQsize, maxQsize.load() );
+#endif
+  }
+  while ( !vBuffer.empty() ) {
+    Batch batch;
+    batch.n = std::min<std::size_t>( nBatch, vBuffer.size() );
+    std::copy( vBuffer.end() - batch.n, vBuffer.end(), batch.rBuffer );
+    vBuffer.resize( vBuffer.size() - batch.n );
+    pShared->stack.push( batch );
+  }
+  // the last reference to Shared may be this one, it then deletes the buffers
+}
+
+template<typename bufferT> BufferRepository<bufferT>::Shared::Shared( void )
+: stack( 16 ), cntCheckins( 0 ), cntCheckouts( 0 )
+#ifdef _DEBUG
+  , cntCreated( 0 ), maxQsize( 0 )
+#endif
+{
+}
+
+template<typename bufferT> std::size_t BufferRepository<bufferT>::Shared::Clear( void ) {
+  std::size_t cnt( 0 );
+  Batch batch;
+  while ( stack.pop( batch ) ) {
+    for ( std::size_t ix = 0; ix < batch.n; ++ix ) {
+      delete batch.rBuffer[ ix ];
+    }
+    cnt += batch.n;
+  }
+  return cnt;
+}
 
 template<typename bufferT> BufferRepository<bufferT>::BufferRepository(void) 
-: cntCheckins( 0 ), cntCheckouts( 0 )
+: m_pShared( new Shared ), cntCheckins( 0 ), cntCheckouts( 0 )
 #ifdef _DEBUG
   , cntCreated( 0 ), cntDestroyed( 0 ), maxQsize( 0 ),
   m_bCheckingOut( false ), m_bCheckingIn( false )
@@ -96,7 +203,7 @@ template<typename bufferT> BufferRepository<bufferT>::BufferRepository(void)
 
 template<typename bufferT> BufferRepository<bufferT>::~BufferRepository(void) {
   bufferT* pBuffer;
-  boost::mutex::scoped_lock lock(m_mutex);  // for the methods requiring a lock
+  m_tspCache.reset();  // this thread's cache goes to the shared stack
   while ( !m_vStack.empty() ) {
     pBuffer = m_vStack.back();
     m_vStack.pop_back();
@@ -106,6 +213,20 @@ template<typename bufferT> BufferRepository<bufferT>::~BufferRepository(void) {
 #endif
   }
 #ifdef _DEBUG
+  cntDestroyed += m_pShared->Clear();
+  {
+    boost::mutex::scoped_lock lock( m_pShared->mutex );
+    cntCreated += m_pShared->cntCreated;
+    cntCheckins += m_pShared->cntCheckins;
+    cntCheckouts += m_pShared->cntCheckouts;
+    maxQsize = std::max<std::size_t>( maxQsize, m_pShared->maxQsize );
+    for ( typename std::vector<Cache*>::iterator iter = m_pShared->vCache.begin(); m_pShared->vCache.end() != iter; ++iter ) {
+      cntCreated += (*iter)->cntCreated.load();
+      cntCheckins += (*iter)->cntCheckins.load();
+      cntCheckouts += (*iter)->cntCheckouts.load();
+      maxQsize = std::max<std::size_t>( maxQsize, (*iter)->maxQsize.load() );
+    }
+  }
   std::stringstream ss;
   ss << typeid( this ).name() << ": "
     << cntCreated << " Created, " 
@@ -122,12 +243,48 @@ template<typename bufferT> BufferRepository<bufferT>::~BufferRepository(void) {
   if ( cntCheckins != cntCheckouts ) {
 //    OutputDebugString( "  ** Checkins != Checkouts\n" );
   }
+#else
+  m_pShared->Clear();
 #endif
 }
 
+template<typename bufferT> bool BufferRepository<bufferT>::Outstanding( void ) {
+  boost::mutex::scoped_lock lock( m_pShared->mutex );
+  std::size_t nCheckins( cntCheckins + m_pShared->cntCheckins );
+  std::size_t nCheckouts( cntCheckouts + m_pShared->cntCheckouts );
+  for ( typename std::vector<Cache*>::iterator iter = m_pShared->vCache.begin(); m_pShared->vCache.end() != iter; ++iter ) {
+    nCheckins += (*iter)->cntCheckins.load( boost::memory_order_relaxed );
+    nCheckouts += (*iter)->cntCheckouts.load( boost::memory_order_relaxed );
+  }
+  return ( nCheckins != nCheckouts );
+}
+
+template<typename bufferT> typename BufferRepository<bufferT>::Cache& BufferRepository<bufferT>::GetCache( void ) {
+  Cache* pCache = m_tspCache.get();
+  // a cache of another Shared is left over from a repository which had this address before
+  if ( ( 0 == pCache ) || ( m_pShared != pCache->pShared ) ) {
+    pCache = new Cache( m_pShared );
+    m_tspCache.reset( pCache );
+  }
+  return *pCache;
+}
+
 template<typename bufferT> inline void BufferRepository<bufferT>::CheckInL(bufferT* pBuffer) {
-  boost::mutex::scoped_lock lock(m_mutex);
-  CheckIn( pBuffer );
+  Cache& cache( GetCache() );
+  if ( ( 2 * nBatch ) == cache.vBuffer.size() ) {  // the older half goes, the recently used stay
+    Batch batch;
+    batch.n = nBatch;
+    std::copy( cache.vBuffer.begin(), cache.vBuffer.begin() + nBatch, batch.rBuffer );
+    cache.vBuffer.erase( cache.vBuffer.begin(), cache.vBuffer.begin() + nBatch );
+    m_pShared->stack.push( batch );
+  }
+  cache.vBuffer.push_back( pBuffer );
+  cache.Count( cache.cntCheckins );
+#ifdef _DEBUG
+  if ( cache.maxQsize.load( boost::memory_order_relaxed ) < cache.vBuffer.size() ) {
+    cache.maxQsize.store( cache.vBuffer.size(), boost::memory_order_relaxed );
+  }
+#endif
 }
 
 template<typename bufferT> inline void BufferRepository<bufferT>::CheckIn(bufferT* pBuffer) {
@@ -144,8 +301,26 @@ template<typename bufferT> inline void BufferRepository<bufferT>::CheckIn(buffer
 }
 
 template<typename bufferT> inline bufferT* BufferRepository<bufferT>::CheckOutL() {
-  boost::mutex::scoped_lock lock(m_mutex);
-  return CheckOut();
+  Cache& cache( GetCache() );
+  bufferT* pBuffer;
+  if ( cache.vBuffer.empty() ) {
+    Batch batch;
+    if ( m_pShared->stack.pop( batch ) ) {
+      cache.vBuffer.assign( batch.rBuffer, batch.rBuffer + batch.n );
+    }
+  }
+  if ( cache.vBuffer.empty() ) {
+    pBuffer = new bufferT();
+#ifdef _DEBUG
+    cache.Count( cache.cntCreated );
+#endif
+  }
+  else {
+    pBuffer = cache.vBuffer.back();
+    cache.vBuffer.pop_back();
+  }
+  cache.Count( cache.cntCheckouts );
+  return pBuffer;
 }
 
 template<typename bufferT> inline bufferT* BufferRepository<bufferT>::CheckOut() {
@@ -171,4 +346,4 @@ template<typename bufferT> inline bufferT* BufferRepository<bufferT>::CheckOut()
   return pBuffer;
 }
 
-} // ou
\ No newline at end of file
+} // ou
\ No newline at end of file
@@ -0,0 +1,220 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+// Started 2026/10/18
+
+#pragma once
+
+// vector-like container which grows in fixed size blocks
+//   elements are never moved once constructed, so references and pointers stay valid
+//   as the container grows, and push_back never copies existing elements
+//   index access is O(1): block table lookup then offset within block
+//   iterators are (container, index) pairs, so they also survive growth
+//   release_front frees whole blocks from the front for rolling retention,
+//     remaining elements keep their addresses, indexes shift down by the count released
+// not thread safe, same as std::vector
+
+#include <new>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <cstddef>
+#include <cassert>
+
+namespace ou { // One Unified
+
+template<typename T, std::size_t nBlockSize = 4096>
+class SegmentedVector {
+public:
+
+  static_assert( ( 0 < nBlockSize ) && ( 0 == ( nBlockSize & ( nBlockSize - 1 ) ) ), "nBlockSize must be a power of two" );
+
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+
+  template<typename C, typename V>  // C: container (maybe const), V: value (maybe const)
+  class iterator_base: public std::iterator<std::random_access_iterator_tag, V, difference_type> {
+    friend class SegmentedVector<T,nBlockSize>;
+    template<typename C2, typename V2> friend class iterator_base;
+  public:
+    iterator_base( void ): m_pContainer( 0 ), m_ix( 0 ) {}
+    iterator_base( C* pContainer, size_type ix ): m_pContainer( pContainer ), m_ix( ix ) {}
+    template<typename C2, typename V2>
+    iterator_base( const iterator_base<C2,V2>& rhs ): m_pContainer( rhs.m_pContainer ), m_ix( rhs.m_ix ) {} // iterator -> const_iterator
+
+    V& operator*() const { return (*m_pContainer)[ m_ix ]; }
+    V* operator->() const { return &(*m_pContainer)[ m_ix ]; }
+    V& operator[]( difference_type n ) const { return (*m_pContainer)[ m_ix + n ]; }
+
+    iterator_base& operator++() { ++m_ix; return *this; }
+    iterator_base operator++( int ) { iterator_base tmp( *this ); ++m_ix; return tmp; }
+    iterator_base& operator--() { --m_ix; return *this; }
+    iterator_base operator--( int ) { iterator_base tmp( *this ); --m_ix; return tmp; }
+    iterator_base& operator+=( difference_type n ) { m_ix += n; return *this; }
+    iterator_base& operator-=( difference_type n ) { m_ix -= n; return *this; }
+    iterator_base operator+( difference_type n ) const { return iterator_base( m_pContainer, m_ix + n ); }
+    iterator_base operator-( difference_type n ) const { return iterator_base( m_pContainer, m_ix - n ); }
+    friend iterator_base operator+( difference_type n, const iterator_base& iter ) { return iter + n; }
+
+    template<typename C2, typename V2>
+    difference_type operator-( const iterator_base<C2,V2>& rhs ) const { return (difference_type) m_ix - (difference_type) rhs.m_ix; }
+
+    template<typename C2, typename V2>
+    bool operator==( const iterator_base<C2,V2>& rhs ) const { return m_ix == rhs.m_ix; }
+    template<typename C2, typename V2>
+    bool operator!=( const iterator_base<C2,V2>& rhs ) const { return m_ix != rhs.m_ix; }
+    template<typename C2, typename V2>
+    bool operator<( const iterator_base<C2,V2>& rhs ) const { return m_ix < rhs.m_ix; }
+    template<typename C2, typename V2>
+    bool operator>( const iterator_base<C2,V2>& rhs ) const { return m_ix > rhs.m_ix; }
+    template<typename C2, typename V2>
+    bool operator<=( const iterator_base<C2,V2>& rhs ) const { return m_ix <= rhs.m_ix; }
+    template<typename C2, typename V2>
+    bool operator>=( const iterator_base<C2,V2>& rhs ) const { return m_ix >= rhs.m_ix; }
+
+    size_type index( void ) const { return m_ix; }
+
+  private:
+    C* m_pContainer;
+    size_type m_ix;
+  };
+
+  typedef iterator_base<SegmentedVector, T> iterator;
+  typedef iterator_base<const SegmentedVector, const T> const_iterator;
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  SegmentedVector( void ): m_nSize( 0 ) {}
+  SegmentedVector( const SegmentedVector& rhs ): m_nSize( 0 ) { assign( rhs.begin(), rhs.end() ); }
+  ~SegmentedVector( void ) { clear(); }
+
+  SegmentedVector& operator=( const SegmentedVector& rhs ) {
+    if ( this != &rhs ) {
+      clear();
+      assign( rhs.begin(), rhs.end() );
+    }
+    return *this;
+  }
+
+  template<typename InputIterator>
+  void assign( InputIterator first, InputIterator last ) {
+    clear();
+    while ( first != last ) {
+      push_back( *first );
+      ++first;
+    }
+  }
+
+  size_type size( void ) const { return m_nSize; }
+  bool empty( void ) const { return 0 == m_nSize; }
+  size_type capacity( void ) const { return m_vBlock.size() * nBlockSize; }
+  static size_type block_size( void ) { return nBlockSize; }
+
+  // pre-sizes the block table, blocks themselves are still allocated on demand
+  void reserve( size_type n ) { m_vBlock.reserve( ( n + nBlockSize - 1 ) / nBlockSize ); }
+
+  reference operator[]( size_type ix ) { return m_vBlock[ ix / nBlockSize ][ ix % nBlockSize ]; }
+  const_reference operator[]( size_type ix ) const { return m_vBlock[ ix / nBlockSize ][ ix % nBlockSize ]; }
+
+  reference at( size_type ix ) {
+    if ( ix >= m_nSize ) throw std::out_of_range( "SegmentedVector::at" );
+    return (*this)[ ix ];
+  }
+  const_reference at( size_type ix ) const {
+    if ( ix >= m_nSize ) throw std::out_of_range( "SegmentedVector::at" );
+    return (*this)[ ix ];
+  }
+
+  reference front( void ) { assert( 0 != m_nSize ); return (*this)[ 0 ]; }
+  const_reference front( void ) const { assert( 0 != m_nSize ); return (*this)[ 0 ]; }
+  reference back( void ) { assert( 0 != m_nSize ); return (*this)[ m_nSize - 1 ]; }
+  const_reference back( void ) const { assert( 0 != m_nSize ); return (*this)[ m_nSize - 1 ]; }
+
+  iterator begin( void ) { return iterator( this, 0 ); }
+  iterator end( void ) { return iterator( this, m_nSize ); }
+  const_iterator begin( void ) const { return const_iterator( this, 0 ); }
+  const_iterator end( void ) const { return const_iterator( this, m_nSize ); }
+  const_iterator cbegin( void ) const { return const_iterator( this, 0 ); }
+  const_iterator cend( void ) const { return const_iterator( this, m_nSize ); }
+  reverse_iterator rbegin( void ) { return reverse_iterator( end() ); }
+  reverse_iterator rend( void ) { return reverse_iterator( begin() ); }
+  const_reverse_iterator rbegin( void ) const { return const_reverse_iterator( end() ); }
+  const_reverse_iterator rend( void ) const { return const_reverse_iterator( begin() ); }
+
+  void push_back( const T& value ) {
+    const size_type ixBlock( m_nSize / nBlockSize );
+    if ( ixBlock == m_vBlock.size() ) {
+      m_vBlock.push_back( static_cast<T*>( ::operator new( nBlockSize * sizeof( T ) ) ) );  // only the table of pointers ever reallocates
+    }
+    new( m_vBlock[ ixBlock ] + ( m_nSize % nBlockSize ) ) T( value );
+    ++m_nSize;
+  }
+
+  void pop_back( void ) {
+    assert( 0 != m_nSize );
+    --m_nSize;
+    (*this)[ m_nSize ].~T();
+  }
+
+  // not a cheap operation, elements after pos are shuffled up by one
+  iterator insert( const_iterator pos, const T& value ) {
+    const size_type ix( pos.m_ix );
+    assert( ix <= m_nSize );
+    push_back( value );
+    std::rotate( begin() + ix, end() - 1, end() );
+    return begin() + ix;
+  }
+
+  void resize( size_type n ) {
+    while ( m_nSize > n ) pop_back();
+    while ( m_nSize < n ) push_back( T() );
+  }
+
+  void clear( void ) {
+    while ( 0 != m_nSize ) pop_back();
+    for ( typename vBlock_t::iterator iter = m_vBlock.begin(); m_vBlock.end() != iter; ++iter ) {
+      ::operator delete( *iter );
+    }
+    m_vBlock.clear();
+  }
+
+  // destroy and free whole blocks lying entirely before ix,
+  //   returns the number of elements released, which is the amount by which indexes shift
+  size_type release_front( size_type ix ) {
+    assert( ix <= m_nSize );
+    const size_type nBlocks( ix / nBlockSize );
+    for ( size_type ixBlock = 0; ixBlock < nBlocks; ++ixBlock ) {
+      T* p( m_vBlock[ ixBlock ] );
+      for ( size_type ixElement = 0; ixElement < nBlockSize; ++ixElement ) p[ ixElement ].~T();
+      ::operator delete( p );
+    }
+    m_vBlock.erase( m_vBlock.begin(), m_vBlock.begin() + nBlocks );
+    const size_type nReleased( nBlocks * nBlockSize );
+    m_nSize -= nReleased;
+    return nReleased;
+  }
+
+protected:
+private:
+  typedef std::vector<T*> vBlock_t;
+  vBlock_t m_vBlock;
+  size_type m_nSize;
+};
+
+} // namespace ou
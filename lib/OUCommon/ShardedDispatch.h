@@ -0,0 +1,152 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// hands items from one producer thread to a fixed set of worker threads, the shards
+//   the producer picks the shard, items posted to a shard are handled in order, on its thread,
+//   so keying the shard on something ( a symbol ) keeps that key's items in order
+//   each shard has a bounded single producer / single consumer lock free queue,
+//     when a shard's queue is full, Post waits for room, which holds back the producer
+//   an idle worker spins briefly, then sleeps until the producer posts to it
+
+#include <vector>
+#include <cassert>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <OUCommon/FastDelegate.h>
+
+namespace ou { // One Unified
+
+template <typename itemT>  // itemT is a pointer or some other small value
+class ShardedDispatch: boost::noncopyable {
+public:
+
+  typedef fastdelegate::FastDelegate1<itemT> OnItem_t;
+
+  ShardedDispatch( unsigned int nShards, OnItem_t handler, std::size_t nQueueSize = 4096 );
+  ~ShardedDispatch( void ); // items already posted are handled before the workers end
+
+  unsigned int Shards( void ) const { return static_cast<unsigned int>( m_vShard.size() ); };
+
+  void Post( unsigned int ixShard, itemT item ); // producer thread only
+  void Drain( void ); // producer thread only, returns once every item posted so far has been handled
+
+protected:
+private:
+
+  struct Shard {
+    boost::lockfree::spsc_queue<itemT> queue;
+    boost::uint64_t nPosted; // producer only
+    boost::atomic<boost::uint64_t> nHandled;
+    boost::atomic<bool> bWaiting;
+    boost::mutex mutex;
+    boost::condition_variable cond;
+    boost::thread thread;
+    Shard( std::size_t nQueueSize ): queue( nQueueSize ), nPosted( 0 ), nHandled( 0 ), bWaiting( false ) {};
+  };
+  typedef boost::shared_ptr<Shard> pShard_t;
+  typedef std::vector<pShard_t> vShard_t;
+
+  OnItem_t m_handler;
+  vShard_t m_vShard;
+  boost::atomic<bool> m_bStop;
+
+  void Run( Shard& shard );
+};
+
+template <typename itemT>
+ShardedDispatch<itemT>::ShardedDispatch( unsigned int nShards, OnItem_t handler, std::size_t nQueueSize )
+: m_handler( handler ), m_bStop( false )
+{
+  assert( 0 < nShards );
+  for ( unsigned int ix = 0; ix < nShards; ++ix ) {
+    m_vShard.push_back( pShard_t( new Shard( nQueueSize ) ) );
+  }
+  for ( typename vShard_t::iterator iter = m_vShard.begin(); m_vShard.end() != iter; ++iter ) {
+    (*iter)->thread = boost::thread( &ShardedDispatch<itemT>::Run, this, boost::ref( **iter ) );
+  }
+}
+
+template <typename itemT>
+ShardedDispatch<itemT>::~ShardedDispatch( void ) {
+  m_bStop.store( true );
+  for ( typename vShard_t::iterator iter = m_vShard.begin(); m_vShard.end() != iter; ++iter ) {
+    boost::lock_guard<boost::mutex> lock( (*iter)->mutex );
+    (*iter)->cond.notify_one();
+  }
+  for ( typename vShard_t::iterator iter = m_vShard.begin(); m_vShard.end() != iter; ++iter ) {
+    (*iter)->thread.join();
+  }
+}
+
+template <typename itemT>
+void ShardedDispatch<itemT>::Post( unsigned int ixShard, itemT item ) {
+  Shard& shard( *m_vShard[ ixShard ] );
+  while ( !shard.queue.push( item ) ) {
+    boost::this_thread::yield();  // full, the shard is behind
+  }
+  ++shard.nPosted;
+  boost::atomic_thread_fence( boost::memory_order_seq_cst ); // pairs with the fence in Run, one side sees the other
+  if ( shard.bWaiting.load( boost::memory_order_relaxed ) ) {
+    boost::lock_guard<boost::mutex> lock( shard.mutex );
+    shard.cond.notify_one();
+  }
+}
+
+template <typename itemT>
+void ShardedDispatch<itemT>::Drain( void ) {
+  for ( typename vShard_t::iterator iter = m_vShard.begin(); m_vShard.end() != iter; ++iter ) {
+    while ( (*iter)->nPosted != (*iter)->nHandled.load( boost::memory_order_acquire ) ) {
+      boost::this_thread::yield();
+    }
+  }
+}
+
+template <typename itemT>
+void ShardedDispatch<itemT>::Run( Shard& shard ) {
+  static const unsigned int nSpin( 1000 );
+  itemT item;
+  while ( true ) {
+    if ( shard.queue.pop( item ) ) {
+      m_handler( item );
+      shard.nHandled.fetch_add( 1, boost::memory_order_release );
+      continue;
+    }
+    unsigned int cnt( 0 );
+    while ( ( nSpin > cnt ) && ( 0 == shard.queue.read_available() ) ) ++cnt;
+    if ( nSpin > cnt ) continue;
+    boost::unique_lock<boost::mutex> lock( shard.mutex );
+    shard.bWaiting.store( true, boost::memory_order_relaxed );
+    boost::atomic_thread_fence( boost::memory_order_seq_cst );
+    while ( ( 0 == shard.queue.read_available() ) && !m_bStop.load() ) {
+      shard.cond.wait( lock );
+    }
+    shard.bWaiting.store( false, boost::memory_order_relaxed );
+    if ( ( 0 == shard.queue.read_available() ) && m_bStop.load() ) break;
+  }
+}
+
+} // namespace ou
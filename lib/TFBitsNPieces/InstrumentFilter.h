@@ -15,7 +15,11 @@
 
 // started 2013/09/19
 
+#include <vector>
+
 #include <boost/function.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/filesystem/operations.hpp>
 #include <boost/phoenix/core/argument.hpp>
 #include <boost/phoenix/bind/bind_member_function.hpp>
 
@@ -26,11 +30,20 @@ using namespace boost::gregorian;
 #include <TFHDF5TimeSeries/HDF5DataManager.h>
 #include <TFHDF5TimeSeries/HDF5IterateGroups.h>
 #include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+#include <TFHDF5TimeSeries/HDF5Catalog.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesStore.h>
+
+#include <TFTimeSeries/DatedDatumPod.h>
+#include <TFTimeSeries/FlatFileTimeSeries.h>
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
 // currently assumes daily bars are being scanned, will need to generalize if other types are being used.
+// 2026/10/18 when the file's catalog covers the path, the series are enumerated from the catalog, 
+//   and those with too few rows, or no rows between the dates, are passed over without being opened
+// 2026/10/18 series are read through TimeSeriesStore: from the flat file of the series under sFlatFileRoot,
+//   when one is given and the file is there, otherwise from the hdf5 dataset
 
 template<typename S, typename TS> // S=shared data structure, TS=time series type to be used
 class InstrumentFilter {
@@ -39,7 +52,7 @@ public:
   typedef boost::function<bool (S&, const std::string&, TS&)> cbFilter_t; // used for filtering on fields in the Time Series
   typedef boost::function<void (S&, const std::string&, TS&)> cbResult_t;  // send the chosen filtered results back
   InstrumentFilter( const std::string& sPath, ptime dtBegin, ptime dtEnd, typename TS::size_type, 
-    cbUseGroup_t, cbFilter_t, cbResult_t );
+    cbUseGroup_t, cbFilter_t, cbResult_t, const std::string& sFlatFileRoot = "" );
   ~InstrumentFilter( void ) {};
   void Run( void );
 protected:
@@ -48,6 +61,8 @@ private:
   S m_struct;
   typename TS::size_type m_nRequiredDays;
   std::string m_sRootPath;
+  std::string m_sGroup; // group of the last catalog entry
+  std::string m_sFlatFileRoot;
 
   ptime m_dtDate1;
   ptime m_dtDate2;
@@ -60,16 +75,17 @@ private:
 
   void HandleGroup( const std::string& sPath, const std::string& sObject );
   void HandleObject( const std::string& sPath, const std::string& sObject );
+  void HandleEntry( const ou::tf::HDF5Catalog::Entry& entry );
 };
 
 template<typename S, typename TS>
 InstrumentFilter<S,TS>::InstrumentFilter( 
   const std::string& sPath, ptime dtBegin, ptime dtEnd, typename TS::size_type nRequiredDays, 
-  cbUseGroup_t cbUseGroup, cbFilter_t cbFilter, cbResult_t cbResult ) 
+  cbUseGroup_t cbUseGroup, cbFilter_t cbFilter, cbResult_t cbResult, const std::string& sFlatFileRoot ) 
   : m_cbUseGroup( cbUseGroup ), m_cbFilter( cbFilter ), m_cbResult( cbResult ), 
     m_dtDate1( dtBegin ), m_dtDate2( dtEnd ),
     m_dm( ou::tf::HDF5DataManager::RO ),
-  m_bSendThroughFilter( false ), m_nRequiredDays( nRequiredDays ), m_sRootPath( sPath )
+  m_bSendThroughFilter( false ), m_nRequiredDays( nRequiredDays ), m_sRootPath( sPath ), m_sFlatFileRoot( sFlatFileRoot )
 {
 
   if ( dtBegin >= dtEnd ) {
@@ -81,11 +97,34 @@ InstrumentFilter<S,TS>::InstrumentFilter(
 template<typename S, typename TS>
 void InstrumentFilter<S,TS>::Run( void ) {
   namespace args = boost::phoenix::placeholders;
-  ou::tf::hdf5::IterateGroups ig( 
-    m_sRootPath, 
-    boost::phoenix::bind( &InstrumentFilter<S,TS>::HandleGroup, this, args::arg1, args::arg2 ), 
-    boost::phoenix::bind( &InstrumentFilter<S,TS>::HandleObject, this, args::arg1, args::arg2 ) 
-    );
+  ou::tf::HDF5Catalog catalog( m_dm );
+  std::string sRoot( m_sRootPath );
+  if ( sRoot.empty() || ( '/' != sRoot[ sRoot.size() - 1 ] ) ) sRoot.append( "/" );
+  if ( catalog.Covers( sRoot ) ) {
+    m_sGroup = sRoot;
+    catalog.Select( sRoot, boost::phoenix::bind( &InstrumentFilter<S,TS>::HandleEntry, this, args::arg1 ) );
+  }
+  else {
+    ou::tf::hdf5::IterateGroups ig( 
+      m_sRootPath, 
+      boost::phoenix::bind( &InstrumentFilter<S,TS>::HandleGroup, this, args::arg1, args::arg2 ), 
+      boost::phoenix::bind( &InstrumentFilter<S,TS>::HandleObject, this, args::arg1, args::arg2 ) 
+      );
+  }
+}
+
+template<typename S, typename TS>
+void InstrumentFilter<S,TS>::HandleEntry( const ou::tf::HDF5Catalog::Entry& entry ) {
+  // groups are presented as IterateGroups would: path with a trailing '/', and name
+  const std::string sGroup( entry.sPath.substr( 0, entry.sPath.size() - entry.sName.size() ) );
+  if ( sGroup != m_sGroup ) {
+    m_sGroup = sGroup;
+    std::string::size_type ix = sGroup.rfind( '/', sGroup.size() - 2 );
+    HandleGroup( sGroup, sGroup.substr( ix + 1, sGroup.size() - ix - 2 ) );
+  }
+  if ( m_bSendThroughFilter && ( m_nRequiredDays <= entry.nRows ) && entry.Covers( m_dtDate1, m_dtDate2 ) ) {
+    HandleObject( entry.sPath, entry.sName );
+  }
 }
 
 template<typename S, typename TS>
@@ -96,15 +135,21 @@ void InstrumentFilter<S,TS>::HandleGroup( const std::string& sPath, const std::s
 template<typename S, typename TS>
 void InstrumentFilter<S,TS>::HandleObject( const std::string& sPath, const std::string& sObject ) {
   if ( m_bSendThroughFilter ) {
-    typename ou::tf::HDF5TimeSeriesContainer<typename TS::datum_t> tsRepository( m_dm, sPath );
-    typename ou::tf::HDF5TimeSeriesContainer<typename TS::datum_t>::iterator begin, end;
-    begin = std::lower_bound( tsRepository.begin(), tsRepository.end(), m_dtDate1 );
-    end = lower_bound( begin, tsRepository.end(), m_dtDate2 ); 
-    hsize_t cnt = end - begin;
-    if ( m_nRequiredDays <= cnt ) {
+    typedef typename ou::tf::pod::Of<typename TS::datum_t>::type pod_t;
+    boost::scoped_ptr<ou::tf::TimeSeriesStore<pod_t> > pStore;
+    if ( !m_sFlatFileRoot.empty() ) {
+      const std::string sFileName( ou::tf::FlatFile::FileName( m_sFlatFileRoot, pod_t::Signature(), sObject ) );
+      if ( boost::filesystem::exists( sFileName ) ) pStore.reset( new ou::tf::FlatFileTimeSeries<pod_t>( sFileName ) );
+    }
+    if ( 0 == pStore.get() ) pStore.reset( new ou::tf::HDF5TimeSeriesStore<pod_t>( m_dm, sPath ) );
+    std::vector<pod_t> v;
+    pStore->Read( m_dtDate1, m_dtDate2, v );
+    if ( m_nRequiredDays <= v.size() ) {
       TS timeseries;
-      timeseries.Resize( cnt );
-      tsRepository.Read( begin, end, &timeseries );
+      timeseries.Reserve( v.size() );
+      for ( typename std::vector<pod_t>::const_iterator iter = v.begin(); v.end() != iter; ++iter ) {
+        timeseries.Append( iter->ToDatedDatum() );
+      }
       bool b = m_cbFilter( m_struct, sObject, timeseries );
       if ( b ) {
         m_cbResult( m_struct, sObject, timeseries );
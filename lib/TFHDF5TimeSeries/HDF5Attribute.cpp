@@ -14,6 +14,7 @@
 
 //#include "StdAfx.h"
 
+#include "HDF5Catalog.h"
 #include "HDF5Attribute.h"
 
 namespace ou { // One Unified
@@ -32,34 +33,38 @@ const char szSignificantDigits[] = "SignificantDigits";
 const char szSignature[] = "Signature";
 
  HDF5Attributes::HDF5Attributes( HDF5DataManager& dm ) 
- : m_pDataSet( NULL ), m_dm( dm )
+ : m_pDataSet( NULL ), m_dm( dm ), m_bModified( false )
 {
 }
 
-HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath ): m_dm( dm ) {
+HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath ): m_dm( dm ), m_bModified( false ) {
   OpenDataSet( sPath );
 }
 
-HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath, InstrumentType::enumInstrumentTypes typeInst ): m_dm( dm ) {
+HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath, InstrumentType::enumInstrumentTypes typeInst ): m_dm( dm ), m_bModified( false ) {
   OpenDataSet( sPath );
   SetInstrumentType( typeInst );
 }
 
-HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath, const structOption& option ): m_dm( dm ) {
+HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath, const structOption& option ): m_dm( dm ), m_bModified( false ) {
   OpenDataSet( sPath );
   SetOptionAttributes( option );
 }
 
-HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath, const structFuture& future ): m_dm( dm ) {
+HDF5Attributes::HDF5Attributes( HDF5DataManager& dm, const std::string& sPath, const structFuture& future ): m_dm( dm ), m_bModified( false ) {
   OpenDataSet( sPath );
   SetFutureAttributes( future );
 }
 
 HDF5Attributes::~HDF5Attributes(void) {
   CloseDataSet();
+  if ( m_bModified ) {
+    HDF5Catalog::UpdateAttributes( m_dm, m_sPath );
+  }
 }
 
 void HDF5Attributes::OpenDataSet( const std::string& sPath ) {
+  m_sPath = sPath;
   m_pDataSet = new H5::DataSet( m_dm.GetH5File()->openDataSet( sPath.c_str() ) );
 }
 
@@ -71,6 +76,7 @@ void HDF5Attributes::CloseDataSet ( void ) {
 }
 
 void HDF5Attributes::SetInstrumentType( InstrumentType::enumInstrumentTypes typeInstrument ) {
+  m_bModified = true;
   H5::DataSpace dspace;
   H5::Attribute attribute( m_pDataSet->createAttribute( szInstrumentType, H5::PredType::NATIVE_INT8, dspace ) );
   attribute.write( H5::PredType::NATIVE_INT8, &typeInstrument );
@@ -78,7 +84,7 @@ void HDF5Attributes::SetInstrumentType( InstrumentType::enumInstrumentTypes type
 }
 
 InstrumentType::enumInstrumentTypes HDF5Attributes::GetInstrumentType( void ) {
-  InstrumentType::enumInstrumentTypes typeInstrument;
+  InstrumentType::enumInstrumentTypes typeInstrument( InstrumentType::Unknown ); // the attribute fills the low byte
   H5::Attribute attribute( m_pDataSet->openAttribute( szInstrumentType ) );
   attribute.read(H5::PredType::NATIVE_INT8, &typeInstrument );
   attribute.close();
@@ -86,6 +92,7 @@ InstrumentType::enumInstrumentTypes HDF5Attributes::GetInstrumentType( void ) {
 }
 
 void HDF5Attributes::SetSignature( boost::uint64_t sig ) {
+  m_bModified = true;
   H5::DataSpace dspace;
   H5::Attribute attribute( m_pDataSet->createAttribute( szSignature, H5::PredType::NATIVE_UINT64, dspace ) );
   attribute.write( H5::PredType::NATIVE_UINT64, &sig );
@@ -101,6 +108,7 @@ boost::uint64_t HDF5Attributes::GetSignature( void ) {
 }
 
 void HDF5Attributes::SetProviderType( keytypes::eidProvider_t id ) {
+  m_bModified = true;
   H5::DataSpace dspace;
   H5::Attribute attribute( m_pDataSet->createAttribute( szProviderType, H5::PredType::NATIVE_UINT16, dspace ) );
   attribute.write( H5::PredType::NATIVE_UINT16, &id );
@@ -108,7 +116,7 @@ void HDF5Attributes::SetProviderType( keytypes::eidProvider_t id ) {
 }
 
 keytypes::eidProvider_t HDF5Attributes::GetProviderType( void ) {
-  keytypes::eidProvider_t id;
+  keytypes::eidProvider_t id( keytypes::EProviderUnknown ); // the attribute fills the low two bytes
   H5::Attribute attribute( m_pDataSet->openAttribute( szProviderType ) );
   attribute.read(H5::PredType::NATIVE_UINT16, &id );
   attribute.close();
@@ -116,6 +124,7 @@ keytypes::eidProvider_t HDF5Attributes::GetProviderType( void ) {
 }
 
 void HDF5Attributes::SetSignificantDigits( unsigned char sd ) {
+  m_bModified = true;
   H5::DataSpace dspace;
   H5::Attribute attribute( m_pDataSet->createAttribute( szSignificantDigits, H5::PredType::NATIVE_UINT8, dspace ) );
   attribute.write( H5::PredType::NATIVE_UINT8, &sd );
@@ -131,6 +140,7 @@ unsigned char HDF5Attributes::GetSignificantDigits( void ) {
 }
 
 void HDF5Attributes::SetMultiplier( unsigned short mult ) {
+  m_bModified = true;
   H5::DataSpace dspace;
   H5::Attribute attribute( m_pDataSet->createAttribute( szMultiplier, H5::PredType::NATIVE_UINT16, dspace ) );
   attribute.write( H5::PredType::NATIVE_UINT16, &mult );
@@ -146,6 +156,7 @@ unsigned short HDF5Attributes::GetMultiplier( void ) {
 }
 
 void HDF5Attributes::SetOptionAttributes( const structOption& option ) {
+  m_bModified = true;
 
   SetInstrumentType( InstrumentType::Option );
 
@@ -197,6 +208,7 @@ void HDF5Attributes::GetOptionAttributes( structOption* option ) {
 }
 
 void HDF5Attributes::SetFutureAttributes( const structFuture& future ) {
+  m_bModified = true;
 
   SetInstrumentType( InstrumentType::Future );
 
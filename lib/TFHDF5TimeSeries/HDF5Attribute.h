@@ -83,6 +83,8 @@ protected:
 private:
   HDF5DataManager& m_dm;
   H5::DataSet *m_pDataSet;
+  std::string m_sPath;
+  bool m_bModified; // the catalog is told when done
 };
 
 } // namespace tf
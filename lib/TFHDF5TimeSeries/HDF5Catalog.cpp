@@ -0,0 +1,680 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <map>
+#include <set>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+
+#include <TFTimeSeries/DatedDatumPod.h>
+
+#include "HDF5Catalog.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+
+  const char szCatalog[] = "/catalog";
+  const char szComplete[] = "CompleteGroups";  // attribute of the catalog, the complete groups, one per line
+
+  const std::size_t c_nPath = 256;
+  const hsize_t c_nChunk = 64;
+
+  const boost::int64_t usNull = std::numeric_limits<boost::int64_t>::min();  // not_a_date_time
+
+  const boost::posix_time::ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+
+  // a row of the catalog dataset
+  struct Record {
+    char szPath[ c_nPath ];
+    boost::uint64_t nSignature;
+    boost::uint64_t nRows;
+    boost::int64_t usFirst;  // microseconds from the epoch
+    boost::int64_t usLast;
+    double dblStrike;
+    boost::uint16_t nProvider;
+    boost::uint16_t nYear;
+    boost::uint16_t nMonth;
+    boost::uint16_t nDay;
+    boost::uint16_t nMultiplier;
+    boost::uint8_t nInstrumentType;
+    boost::uint8_t nSide;
+    boost::uint8_t nSignificantDigits;
+    boost::uint8_t fAttributes;
+  };
+
+  H5::CompType* DefineRecordType( void ) {
+    H5::CompType* pComp = new H5::CompType( sizeof( Record ) );
+    pComp->insertMember( "Path",              HOFFSET( Record, szPath ),             H5::StrType( H5::PredType::C_S1, c_nPath ) );
+    pComp->insertMember( "Signature",         HOFFSET( Record, nSignature ),         H5::PredType::NATIVE_UINT64 );
+    pComp->insertMember( "Rows",              HOFFSET( Record, nRows ),              H5::PredType::NATIVE_UINT64 );
+    pComp->insertMember( "First",             HOFFSET( Record, usFirst ),            H5::PredType::NATIVE_INT64 );
+    pComp->insertMember( "Last",              HOFFSET( Record, usLast ),             H5::PredType::NATIVE_INT64 );
+    pComp->insertMember( "Strike",            HOFFSET( Record, dblStrike ),          H5::PredType::NATIVE_DOUBLE );
+    pComp->insertMember( "ProviderType",      HOFFSET( Record, nProvider ),          H5::PredType::NATIVE_UINT16 );
+    pComp->insertMember( "Year",              HOFFSET( Record, nYear ),              H5::PredType::NATIVE_UINT16 );
+    pComp->insertMember( "Month",             HOFFSET( Record, nMonth ),             H5::PredType::NATIVE_UINT16 );
+    pComp->insertMember( "Day",               HOFFSET( Record, nDay ),               H5::PredType::NATIVE_UINT16 );
+    pComp->insertMember( "Multiplier",        HOFFSET( Record, nMultiplier ),        H5::PredType::NATIVE_UINT16 );
+    pComp->insertMember( "InstrumentType",    HOFFSET( Record, nInstrumentType ),    H5::PredType::NATIVE_UINT8 );
+    pComp->insertMember( "Side",              HOFFSET( Record, nSide ),              H5::PredType::NATIVE_UINT8 );
+    pComp->insertMember( "SignificantDigits", HOFFSET( Record, nSignificantDigits ), H5::PredType::NATIVE_UINT8 );
+    pComp->insertMember( "Attributes",        HOFFSET( Record, fAttributes ),        H5::PredType::NATIVE_UINT8 );
+    return pComp;
+  }
+
+  boost::int64_t ToMicroseconds( const boost::posix_time::ptime& dt ) {
+    return dt.is_special() ? usNull : ( dt - dtEpoch ).total_microseconds();
+  }
+
+  boost::posix_time::ptime FromMicroseconds( boost::int64_t us ) {
+    return ( usNull == us ) ? boost::posix_time::ptime() : dtEpoch + boost::posix_time::microseconds( us );
+  }
+
+  void ClearRecord( Record& record, const std::string& sPath ) {
+    std::memset( &record, 0, sizeof( Record ) );
+    std::strncpy( record.szPath, sPath.c_str(), c_nPath - 1 );
+    record.usFirst = record.usLast = usNull;
+  }
+
+  void RecordToEntry( const Record& record, HDF5Catalog::Entry& entry ) {
+    entry.sPath.assign( record.szPath, strnlen( record.szPath, c_nPath ) );
+    std::string::size_type ix = entry.sPath.rfind( '/' );
+    entry.sName = ( std::string::npos == ix ) ? entry.sPath : entry.sPath.substr( ix + 1 );
+    entry.nSignature = record.nSignature;
+    entry.nRows = record.nRows;
+    entry.dtFirst = FromMicroseconds( record.usFirst );
+    entry.dtLast = FromMicroseconds( record.usLast );
+    entry.fAttributes = record.fAttributes;
+    entry.eInstrumentType = static_cast<InstrumentType::enumInstrumentTypes>( record.nInstrumentType );
+    entry.idProvider = static_cast<keytypes::eidProvider_t>( record.nProvider );
+    entry.option.dblStrike = record.dblStrike;
+    entry.option.nYear = record.nYear;
+    entry.option.nMonth = record.nMonth;
+    entry.option.nDay = record.nDay;
+    entry.option.eSide = static_cast<OptionSide::enumOptionSide>( record.nSide );
+    entry.nMultiplier = record.nMultiplier;
+    entry.nSignificantDigits = record.nSignificantDigits;
+  }
+
+  // is the dataset a time series: one dimensional, of a compound type with a DateTime member
+  bool IsTimeSeries( H5::DataSet& dataset, hsize_t& nRows ) {
+    if ( H5T_COMPOUND != dataset.getTypeClass() ) return false;
+    H5::CompType type( dataset );
+    bool bDateTime( false );
+    for ( int ix = 0; ix < type.getNmembers(); ++ix ) {
+      if ( "DateTime" == type.getMemberName( ix ) ) {
+        bDateTime = true;
+        break;
+      }
+    }
+    type.close();
+    if ( !bDateTime ) return false;
+    H5::DataSpace dspace( dataset.getSpace() );
+    const bool bSimple = ( 1 == dspace.getSimpleExtentNdims() );
+    if ( bSimple ) dspace.getSimpleExtentDims( &nRows );
+    dspace.close();
+    return bSimple;
+  }
+
+  // the DateTime member of one row, only that member is read
+  boost::posix_time::ptime ReadDateTime( H5::DataSet& dataset, hsize_t ix ) {
+    H5::CompType type( sizeof( boost::int64_t ) );
+    type.insertMember( "DateTime", 0, H5::PredType::NATIVE_LLONG );
+    hsize_t one( 1 );
+    H5::DataSpace dsMemory( 1, &one );
+    H5::DataSpace dsDisk( dataset.getSpace() );
+    dsDisk.selectHyperslab( H5S_SELECT_SET, &one, &ix );
+    boost::int64_t nRaw;
+    dataset.read( &nRaw, type, dsMemory, dsDisk );
+    dsDisk.close();
+    dsMemory.close();
+    type.close();
+    return pod::FromEpoch( pod::StorageToEpoch( nRaw ) );
+  }
+
+  void ReadRows( H5::DataSet& dataset, hsize_t nRows, Record& record ) {
+    record.nRows = nRows;
+    if ( 0 == nRows ) {
+      record.usFirst = record.usLast = usNull;
+    }
+    else {
+      record.usFirst = ToMicroseconds( ReadDateTime( dataset, 0 ) );
+      record.usLast = ToMicroseconds( ReadDateTime( dataset, nRows - 1 ) );
+    }
+  }
+
+  void ReadAttributes( HDF5DataManager& dm, const std::string& sPath, H5::DataSet& dataset, Record& record ) {
+    HDF5Attributes attributes( dm, sPath );
+    record.nSignature = dataset.attrExists( "Signature" ) ? attributes.GetSignature() : 0;
+    record.fAttributes = 0;
+    if ( dataset.attrExists( "InstrumentType" ) ) {
+      record.nInstrumentType = attributes.GetInstrumentType();
+      record.fAttributes |= HDF5Catalog::aInstrumentType;
+    }
+    if ( dataset.attrExists( "ProviderType" ) ) {
+      record.nProvider = attributes.GetProviderType();
+      record.fAttributes |= HDF5Catalog::aProviderType;
+    }
+    if ( dataset.attrExists( "Strike" ) ) {
+      HDF5Attributes::structOption option;
+      attributes.GetOptionAttributes( &option );
+      record.dblStrike = option.dblStrike;
+      record.nSide = option.eSide;
+      record.nYear = option.nYear;
+      record.nMonth = option.nMonth;
+      record.nDay = option.nDay;
+      record.fAttributes |= HDF5Catalog::aOption;
+    }
+    else {
+      if ( dataset.attrExists( "Year" ) ) {
+        HDF5Attributes::structFuture future;
+        attributes.GetFutureAttributes( &future );
+        record.nYear = future.nYear;
+        record.nMonth = future.nMonth;
+        record.nDay = future.nDay;
+        record.fAttributes |= HDF5Catalog::aFuture;
+      }
+    }
+    if ( dataset.attrExists( "Multiplier" ) ) {
+      record.nMultiplier = attributes.GetMultiplier();
+      record.fAttributes |= HDF5Catalog::aMultiplier;
+    }
+    if ( dataset.attrExists( "SignificantDigits" ) ) {
+      record.nSignificantDigits = attributes.GetSignificantDigits();
+      record.fAttributes |= HDF5Catalog::aSignificantDigits;
+    }
+  }
+
+  bool CatalogExists( HDF5DataManager& dm ) {
+    return 0 < H5Lexists( dm.GetH5File()->getId(), szCatalog, H5P_DEFAULT );
+  }
+
+  std::string GroupName( const std::string& sGroup ) { // without a trailing separator, other than for the root
+    std::string s( sGroup.empty() ? "/" : sGroup );
+    while ( ( 1 < s.size() ) && ( '/' == s[ s.size() - 1 ] ) ) s.erase( s.size() - 1 );
+    return s;
+  }
+
+  bool InGroup( const std::string& sGroup, const std::string& sPath ) { // sGroup as from GroupName
+    if ( "/" == sGroup ) return true;
+    if ( 0 != sPath.compare( 0, sGroup.size(), sGroup ) ) return false;
+    return ( sPath.size() == sGroup.size() ) || ( '/' == sPath[ sGroup.size() ] );
+  }
+
+  void ReadComplete( H5::DataSet& dataset, std::vector<std::string>& vGroup ) {
+    vGroup.clear();
+    if ( !dataset.attrExists( szComplete ) ) return;
+    H5::Attribute attribute( dataset.openAttribute( szComplete ) );
+    H5::StrType type( attribute.getStrType() );
+    std::string sGroups;
+    attribute.read( type, sGroups );
+    type.close();
+    attribute.close();
+    std::string::size_type ixBegin( 0 );
+    while ( ixBegin < sGroups.size() ) {
+      std::string::size_type ixEnd = sGroups.find( '\n', ixBegin );
+      if ( std::string::npos == ixEnd ) ixEnd = sGroups.size();
+      if ( ixBegin < ixEnd ) vGroup.push_back( sGroups.substr( ixBegin, ixEnd - ixBegin ) );
+      ixBegin = ixEnd + 1;
+    }
+  }
+
+  void WriteComplete( H5::DataSet& dataset, const std::vector<std::string>& vGroup ) {
+    if ( dataset.attrExists( szComplete ) ) dataset.removeAttr( szComplete );
+    if ( vGroup.empty() ) return;
+    std::string sGroups;
+    for ( std::vector<std::string>::const_iterator iter = vGroup.begin(); vGroup.end() != iter; ++iter ) {
+      sGroups += *iter;
+      sGroups += '\n';
+    }
+    H5::StrType type( H5::PredType::C_S1, sGroups.size() );
+    H5::DataSpace dspace( H5S_SCALAR );
+    H5::Attribute attribute( dataset.createAttribute( szComplete, type, dspace ) );
+    attribute.write( type, sGroups );
+    attribute.close();
+    dspace.close();
+    type.close();
+  }
+
+  // where each path is in the catalog dataset, shared by all writers in the process
+  //   checked against the dataset before it is used, so it is reloaded if the file changes under it
+  class Registry {
+  public:
+
+    Registry( void ): m_bLoaded( false ), m_nRows( 0 ), m_pType( DefineRecordType() ) {};
+
+    boost::mutex& Mutex( void ) { return m_mutex; };
+
+    // f modifies the record of the path, which is created, cleared, when there is none
+    template<typename F>
+    void Modify( HDF5DataManager& dm, const std::string& sPath, F f ) {
+      if ( c_nPath <= sPath.size() ) { // not catalogued
+        Incomplete( dm, sPath );
+        return;
+      }
+      H5::DataSet dataset( Open( dm ) );
+      hsize_t ixRow;
+      Record record;
+      bool bFound = Find( dataset, sPath, ixRow, record );
+      if ( !bFound ) {
+        ClearRecord( record, sPath );
+        ixRow = m_nRows;
+      }
+      f( record );
+      Write( dataset, ixRow, record );
+      dataset.close();
+    }
+
+    // the rows of paths below sGroup, except those in setKeep, are cleared
+    void Drop( HDF5DataManager& dm, const std::string& sGroup, const std::set<std::string>& setKeep ) {
+      if ( !CatalogExists( dm ) ) return;
+      H5::DataSet dataset( Open( dm ) );
+      Load( dataset );
+      Record record;
+      ClearRecord( record, "" );
+      for ( mapRow_t::iterator iter = m_mapRow.begin(); m_mapRow.end() != iter; ) {
+        if ( ( 0 == iter->first.compare( 0, sGroup.size(), sGroup ) ) && ( setKeep.end() == setKeep.find( iter->first ) ) ) {
+          Write( dataset, iter->second, record );
+          m_mapRow.erase( iter++ );
+        }
+        else ++iter;
+      }
+      dataset.close();
+    }
+
+    // the group, and so the groups below it, are complete
+    void Complete( HDF5DataManager& dm, const std::string& sGroup ) {
+      const std::string sName( GroupName( sGroup ) );
+      H5::DataSet dataset( Open( dm ) );
+      std::vector<std::string> vGroup;
+      ReadComplete( dataset, vGroup );
+      std::vector<std::string> vKeep;
+      for ( std::vector<std::string>::const_iterator iter = vGroup.begin(); vGroup.end() != iter; ++iter ) {
+        if ( InGroup( *iter, sName ) ) { // already complete
+          dataset.close();
+          return;
+        }
+        if ( !InGroup( sName, *iter ) ) vKeep.push_back( *iter );
+      }
+      vKeep.push_back( sName );
+      WriteComplete( dataset, vKeep );
+      dataset.close();
+    }
+
+    // the groups holding the path are no longer complete
+    void Incomplete( HDF5DataManager& dm, const std::string& sPath ) {
+      if ( !CatalogExists( dm ) ) return;
+      H5::DataSet dataset( Open( dm ) );
+      std::vector<std::string> vGroup;
+      ReadComplete( dataset, vGroup );
+      std::vector<std::string> vKeep;
+      for ( std::vector<std::string>::const_iterator iter = vGroup.begin(); vGroup.end() != iter; ++iter ) {
+        if ( !InGroup( *iter, sPath ) ) vKeep.push_back( *iter );
+      }
+      if ( vKeep.size() != vGroup.size() ) WriteComplete( dataset, vKeep );
+      dataset.close();
+    }
+
+    void ReadAll( H5::DataSet& dataset, std::vector<Record>& v ) {
+      H5::DataSpace dspace( dataset.getSpace() );
+      hsize_t nRows;
+      dspace.getSimpleExtentDims( &nRows );
+      v.resize( nRows );
+      if ( 0 < nRows ) {
+        H5::DataSpace dsMemory( 1, &nRows );
+        dataset.read( &v[ 0 ], *m_pType, dsMemory, dspace );
+        dsMemory.close();
+      }
+      dspace.close();
+    }
+
+  protected:
+  private:
+
+    typedef std::map<std::string, hsize_t> mapRow_t;
+
+    boost::mutex m_mutex;
+    bool m_bLoaded;
+    hsize_t m_nRows;
+    mapRow_t m_mapRow;
+    H5::CompType* m_pType;
+
+    H5::DataSet Open( HDF5DataManager& dm ) {
+      if ( CatalogExists( dm ) ) return dm.GetH5File()->openDataSet( szCatalog );
+      hsize_t nSize( 0 );
+      hsize_t nMax( H5S_UNLIMITED );
+      H5::DataSpace dspace( 1, &nSize, &nMax );
+      H5::DSetCreatPropList pl;
+      pl.setChunk( 1, &c_nChunk );
+      H5::DataSet dataset( dm.GetH5File()->createDataSet( szCatalog, *m_pType, dspace, pl ) );
+      pl.close();
+      dspace.close();
+      m_bLoaded = false;
+      return dataset;
+    }
+
+    void Load( H5::DataSet& dataset ) {
+      std::vector<Record> v;
+      ReadAll( dataset, v );
+      m_mapRow.clear();
+      for ( hsize_t ix = 0; ix < v.size(); ++ix ) {
+        if ( 0 != v[ ix ].szPath[ 0 ] ) {
+          m_mapRow[ std::string( v[ ix ].szPath, strnlen( v[ ix ].szPath, c_nPath ) ) ] = ix;
+        }
+      }
+      m_nRows = v.size();
+      m_bLoaded = true;
+    }
+
+    bool Find( H5::DataSet& dataset, const std::string& sPath, hsize_t& ixRow, Record& record ) {
+      H5::DataSpace dspace( dataset.getSpace() );
+      hsize_t nRows;
+      dspace.getSimpleExtentDims( &nRows );
+      dspace.close();
+      if ( !m_bLoaded || ( nRows != m_nRows ) ) Load( dataset );
+      for ( int nAttempt = 0; nAttempt < 2; ++nAttempt ) {
+        mapRow_t::const_iterator iter = m_mapRow.find( sPath );
+        if ( m_mapRow.end() == iter ) return false;
+        ixRow = iter->second;
+        Read( dataset, ixRow, record );
+        if ( 0 == std::strncmp( record.szPath, sPath.c_str(), c_nPath ) ) return true;
+        Load( dataset ); // written by someone else
+      }
+      return false;
+    }
+
+    void Read( H5::DataSet& dataset, hsize_t ixRow, Record& record ) {
+      hsize_t one( 1 );
+      H5::DataSpace dsMemory( 1, &one );
+      H5::DataSpace dsDisk( dataset.getSpace() );
+      dsDisk.selectHyperslab( H5S_SELECT_SET, &one, &ixRow );
+      dataset.read( &record, *m_pType, dsMemory, dsDisk );
+      dsDisk.close();
+      dsMemory.close();
+    }
+
+    void Write( H5::DataSet& dataset, hsize_t ixRow, const Record& record ) {
+      if ( ixRow >= m_nRows ) {
+        hsize_t nSize( ixRow + 1 );
+        dataset.extend( &nSize );
+        m_nRows = nSize;
+      }
+      hsize_t one( 1 );
+      H5::DataSpace dsMemory( 1, &one );
+      H5::DataSpace dsDisk( dataset.getSpace() );
+      dsDisk.selectHyperslab( H5S_SELECT_SET, &one, &ixRow );
+      dataset.write( &record, *m_pType, dsMemory, dsDisk );
+      dsDisk.close();
+      dsMemory.close();
+      if ( 0 != record.szPath[ 0 ] ) {
+        m_mapRow[ std::string( record.szPath, strnlen( record.szPath, c_nPath ) ) ] = ixRow;
+      }
+    }
+
+  };
+
+  Registry& GetRegistry( void ) {
+    static Registry* pRegistry( new Registry );  // not destroyed, the hdf5 library may be gone by then
+    return *pRegistry;
+  }
+
+  struct SetRows {
+    hsize_t nRows;
+    boost::int64_t usFirst, usLast;
+    SetRows( hsize_t nRows_, const boost::posix_time::ptime& dtFirst, const boost::posix_time::ptime& dtLast )
+      : nRows( nRows_ ), usFirst( ToMicroseconds( dtFirst ) ), usLast( ToMicroseconds( dtLast ) ) {};
+    void operator()( Record& record ) const {
+      record.nRows = nRows;
+      record.usFirst = usFirst;
+      record.usLast = usLast;
+    }
+  };
+
+  struct SetFromDataSet {
+    HDF5DataManager& dm;
+    const std::string& sPath;
+    H5::DataSet& dataset;
+    hsize_t nRows;
+    bool bRows;
+    SetFromDataSet( HDF5DataManager& dm_, const std::string& sPath_, H5::DataSet& dataset_, hsize_t nRows_, bool bRows_ )
+      : dm( dm_ ), sPath( sPath_ ), dataset( dataset_ ), nRows( nRows_ ), bRows( bRows_ ) {};
+    void operator()( Record& record ) const {
+      if ( bRows || ( usNull == record.usFirst ) ) ReadRows( dataset, nRows, record ); // new, or empty, entries get rows
+      ReadAttributes( dm, sPath, dataset, record );
+    }
+  };
+
+  // true when the path is a time series, and was catalogued
+  bool UpdateFromDataSet( HDF5DataManager& dm, const std::string& sPath, bool bRows ) {
+    bool bCatalogued( false );
+    H5::DataSet dataset( dm.GetH5File()->openDataSet( sPath ) );
+    hsize_t nRows( 0 );
+    if ( IsTimeSeries( dataset, nRows ) ) {
+      GetRegistry().Modify( dm, sPath, SetFromDataSet( dm, sPath, dataset, nRows, bRows ) );
+      bCatalogued = true;
+    }
+    dataset.close();
+    return bCatalogued;
+  }
+
+  herr_t CollectName( hid_t /* group */, const char* szName, void* pNames ) {
+    reinterpret_cast<std::vector<std::string>*>( pNames )->push_back( szName );
+    return 0;
+  }
+
+  // datasets below the group, the walk is made with the caller's file,
+  //   hdf5::IterateGroups opens the file again for each group, which upsets a file open for writing
+  void CollectPaths( HDF5DataManager& dm, const std::string& sGroup, std::vector<std::string>& vPath ) {
+    std::vector<std::string> vName;
+    int idx = 0;
+    dm.GetH5File()->iterateElems( sGroup, &idx, &CollectName, &vName );
+    const std::string sPrefix( ( '/' == sGroup[ sGroup.size() - 1 ] ) ? sGroup : sGroup + '/' );
+    for ( std::vector<std::string>::const_iterator iter = vName.begin(); vName.end() != iter; ++iter ) {
+      const std::string sPath( sPrefix + *iter );
+      H5G_stat_t stats;
+      dm.GetH5File()->getObjinfo( sPath, stats );
+      switch ( stats.type ) {
+        case H5G_DATASET:
+          vPath.push_back( sPath );
+          break;
+        case H5G_GROUP:
+          CollectPaths( dm, sPath, vPath );
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  // the path could not be recorded, so its groups can't be enumerated from the catalog
+  void Forget( Registry& registry, HDF5DataManager& dm, const std::string& sPath ) {
+    try {
+      registry.Incomplete( dm, sPath );
+    }
+    catch ( H5::Exception& e ) {
+      std::cout << "HDF5Catalog " << sPath << ": " << e.getDetailMsg() << std::endl;
+    }
+  }
+
+  bool EntryPathLess( const HDF5Catalog::Entry& entry, const std::string& sPath ) {
+    return entry.sPath < sPath;
+  }
+
+  bool EntryLess( const HDF5Catalog::Entry& lhs, const HDF5Catalog::Entry& rhs ) {
+    return lhs.sPath < rhs.sPath;
+  }
+
+} // namespace anonymous
+
+HDF5Catalog::Entry::Entry( void )
+: nSignature( 0 ), nRows( 0 ), fAttributes( 0 ), eInstrumentType( InstrumentType::Unknown ),
+  idProvider( keytypes::EProviderUnknown ), nMultiplier( 0 ), nSignificantDigits( 0 )
+{
+}
+
+bool HDF5Catalog::Entry::Covers( const boost::posix_time::ptime& dtBegin, const boost::posix_time::ptime& dtEnd ) const {
+  if ( 0 == nRows ) return false;
+  if ( dtFirst.is_special() || dtLast.is_special() ) return true; // unknown, let the caller look
+  return ( dtLast >= dtBegin ) && ( dtFirst < dtEnd );
+}
+
+HDF5Catalog::HDF5Catalog( HDF5DataManager& dm )
+: m_dm( dm )
+{
+  Reload();
+}
+
+HDF5Catalog::~HDF5Catalog( void ) {
+}
+
+void HDF5Catalog::Reload( void ) {
+  m_vEntry.clear();
+  m_vComplete.clear();
+  try {
+    Registry& registry( GetRegistry() );
+    boost::lock_guard<boost::mutex> guard( registry.Mutex() );
+    if ( CatalogExists( m_dm ) ) {
+      H5::DataSet dataset( m_dm.GetH5File()->openDataSet( szCatalog ) );
+      std::vector<Record> v;
+      registry.ReadAll( dataset, v );
+      ReadComplete( dataset, m_vComplete );
+      dataset.close();
+      m_vEntry.reserve( v.size() );
+      for ( std::vector<Record>::const_iterator iter = v.begin(); v.end() != iter; ++iter ) {
+        if ( 0 != iter->szPath[ 0 ] ) {
+          m_vEntry.push_back( Entry() );
+          RecordToEntry( *iter, m_vEntry.back() );
+        }
+      }
+      std::sort( m_vEntry.begin(), m_vEntry.end(), EntryLess );
+    }
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5Catalog::Reload " << e.getDetailMsg() << std::endl;
+    m_vEntry.clear();
+    m_vComplete.clear();
+  }
+}
+
+const HDF5Catalog::Entry* HDF5Catalog::Find( const std::string& sPath ) const {
+  vEntry_t::const_iterator iter = std::lower_bound( m_vEntry.begin(), m_vEntry.end(), sPath, EntryPathLess );
+  if ( ( m_vEntry.end() != iter ) && ( sPath == iter->sPath ) ) return &( *iter );
+  return 0;
+}
+
+bool HDF5Catalog::Covers( const std::string& sGroup ) const {
+  const std::string sName( GroupName( sGroup ) );
+  for ( std::vector<std::string>::const_iterator iter = m_vComplete.begin(); m_vComplete.end() != iter; ++iter ) {
+    if ( InGroup( *iter, sName ) ) return true;
+  }
+  return false;
+}
+
+void HDF5Catalog::Select( const std::string& sGroup, cbEntry_t f, boost::uint64_t nSignature,
+  const boost::posix_time::ptime& dtBegin, const boost::posix_time::ptime& dtEnd ) const {
+  const bool bAnyTime( dtBegin.is_not_a_date_time() && dtEnd.is_not_a_date_time() );
+  vEntry_t::const_iterator iter = std::lower_bound( m_vEntry.begin(), m_vEntry.end(), sGroup, EntryPathLess );
+  for ( ; ( m_vEntry.end() != iter ) && ( 0 == iter->sPath.compare( 0, sGroup.size(), sGroup ) ); ++iter ) {
+    if ( ( 0 != nSignature ) && ( nSignature != iter->nSignature ) ) continue;
+    if ( !bAnyTime && !iter->Covers( dtBegin, dtEnd ) ) continue;
+    f( *iter );
+  }
+}
+
+void HDF5Catalog::Paths( HDF5DataManager& dm, const std::string& sGroup, std::vector<std::string>& vPath ) {
+  CollectPaths( dm, sGroup, vPath );
+}
+
+unsigned int HDF5Catalog::Rebuild( HDF5DataManager& dm, const std::string& sGroup ) {
+  std::vector<std::string> vPath;
+  try {
+    CollectPaths( dm, sGroup, vPath );
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5Catalog::Rebuild " << sGroup << ": " << e.getDetailMsg() << std::endl;
+    return 0;
+  }
+  std::set<std::string> setCatalogued;
+  bool bComplete( true );
+  Registry& registry( GetRegistry() );
+  boost::lock_guard<boost::mutex> guard( registry.Mutex() );
+  for ( std::vector<std::string>::const_iterator iter = vPath.begin(); vPath.end() != iter; ++iter ) {
+    if ( szCatalog == *iter ) continue;
+    if ( c_nPath <= iter->size() ) bComplete = false; // can't be catalogued, if it is a time series
+    try {
+      if ( UpdateFromDataSet( dm, *iter, true ) ) setCatalogued.insert( *iter );
+    }
+    catch ( H5::Exception& e ) {
+      bComplete = false;
+      std::cout << "HDF5Catalog::Rebuild " << *iter << ": " << e.getDetailMsg() << std::endl;
+    }
+  }
+  try {
+    registry.Drop( dm, sGroup, setCatalogued );
+    if ( bComplete ) registry.Complete( dm, sGroup );
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5Catalog::Rebuild " << e.getDetailMsg() << std::endl;
+  }
+  return setCatalogued.size();
+}
+
+void HDF5Catalog::Update( HDF5DataManager& dm, const std::string& sPath ) {
+  Registry& registry( GetRegistry() );
+  boost::lock_guard<boost::mutex> guard( registry.Mutex() );
+  try {
+    UpdateFromDataSet( dm, sPath, true );
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5Catalog::Update " << sPath << ": " << e.getDetailMsg() << std::endl;
+    Forget( registry, dm, sPath );
+  }
+}
+
+void HDF5Catalog::UpdateRows( HDF5DataManager& dm, const std::string& sPath, hsize_t nRows,
+  const boost::posix_time::ptime& dtFirst, const boost::posix_time::ptime& dtLast ) {
+  Registry& registry( GetRegistry() );
+  boost::lock_guard<boost::mutex> guard( registry.Mutex() );
+  try {
+    registry.Modify( dm, sPath, SetRows( nRows, dtFirst, dtLast ) );
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5Catalog::UpdateRows " << sPath << ": " << e.getDetailMsg() << std::endl;
+    Forget( registry, dm, sPath );
+  }
+}
+
+void HDF5Catalog::UpdateAttributes( HDF5DataManager& dm, const std::string& sPath ) {
+  Registry& registry( GetRegistry() );
+  boost::lock_guard<boost::mutex> guard( registry.Mutex() );
+  try {
+    UpdateFromDataSet( dm, sPath, false );
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5Catalog::UpdateAttributes " << sPath << ": " << e.getDetailMsg() << std::endl;
+    Forget( registry, dm, sPath );
+  }
+}
+
+} // namespace tf
+} // namespace ou
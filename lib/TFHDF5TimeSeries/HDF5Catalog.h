@@ -0,0 +1,109 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// catalog of the time series in the hdf5 file, kept in the file as the dataset '/catalog':
+//   one row per time series dataset: path, signature, row count, first and last time, and
+//   the attributes set through HDF5Attributes
+// maintained as the file is written:
+//   HDF5TimeSeriesAccessor::Write updates rows and times, HDF5Attributes updates attributes
+//   datasets written before the catalog existed, or by other means, are added with Rebuild
+// a group is complete once Rebuild has catalogued it, the groups are kept with the catalog,
+//   only complete groups are enumerated from the catalog, others need walking the file,
+//   a dataset the catalog failed to record takes completeness away from the groups above it
+// HDF5Catalog loads the whole catalog into memory, so a universe is enumerated, and
+//   series without rows in a date range are passed over, without opening a dataset
+// paths are limited to 255 characters, longer ones are not catalogued
+
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/function.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "HDF5DataManager.h"
+#include "HDF5Attribute.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class HDF5Catalog {
+public:
+
+  enum enumAttribute { // bits of Entry::fAttributes, which attributes the dataset has
+    aInstrumentType = 1, aProviderType = 2, aOption = 4, aFuture = 8, aMultiplier = 16, aSignificantDigits = 32 };
+
+  struct Entry {
+    std::string sPath;  // of the dataset
+    std::string sName;  // last part of the path, usually the symbol
+    boost::uint64_t nSignature; // 0 when the dataset has none
+    hsize_t nRows;
+    boost::posix_time::ptime dtFirst; // not_a_date_time when there are no rows
+    boost::posix_time::ptime dtLast;
+    unsigned int fAttributes; // enumAttribute
+    InstrumentType::enumInstrumentTypes eInstrumentType;
+    keytypes::eidProvider_t idProvider;
+    HDF5Attributes::structOption option; // year, month, day are also the future's
+    unsigned short nMultiplier;
+    unsigned char nSignificantDigits;
+    Entry( void );
+    bool Has( enumAttribute attribute ) const { return 0 != ( fAttributes & attribute ); };
+    bool Covers( const boost::posix_time::ptime& dtBegin, const boost::posix_time::ptime& dtEnd ) const; // has rows in [dtBegin, dtEnd)
+  };
+
+  typedef std::vector<Entry> vEntry_t;
+  typedef boost::function<void (const Entry&)> cbEntry_t;
+
+  explicit HDF5Catalog( HDF5DataManager& dm ); // loads the catalog, empty when the file has none
+  ~HDF5Catalog( void );
+
+  void Reload( void );
+
+  bool Empty( void ) const { return m_vEntry.empty(); };
+  const vEntry_t& Entries( void ) const { return m_vEntry; }; // sorted by path
+  const Entry* Find( const std::string& sPath ) const; // 0 if not catalogued
+  bool Covers( const std::string& sGroup ) const; // every time series below the group is catalogued, it lies in a complete group
+
+  // the datasets below the group, found by walking the file with dm, for when the catalog doesn't cover it
+  static void Paths( HDF5DataManager& dm, const std::string& sGroup, std::vector<std::string>& vPath );
+
+  // entries below sGroup, of the signature ( 0 for any ),
+  //   with rows in [dtBegin, dtEnd) ( any rows when both are not_a_date_time ), in path order
+  void Select( const std::string& sGroup, cbEntry_t f, boost::uint64_t nSignature = 0,
+    const boost::posix_time::ptime& dtBegin = boost::posix_time::ptime(),
+    const boost::posix_time::ptime& dtEnd = boost::posix_time::ptime() ) const;
+
+  // maintenance, dm needs to be read/write
+
+  // catalogue every time series below the group, and drop entries for datasets which have gone,
+  //   when every dataset was catalogued, the group is then complete
+  static unsigned int Rebuild( HDF5DataManager& dm, const std::string& sGroup = "/" ); // returns datasets catalogued
+  static void Update( HDF5DataManager& dm, const std::string& sPath ); // rows, times and attributes re-read from the dataset
+  static void UpdateRows( HDF5DataManager& dm, const std::string& sPath, hsize_t nRows,
+    const boost::posix_time::ptime& dtFirst, const boost::posix_time::ptime& dtLast ); // by writers, which know these
+  static void UpdateAttributes( HDF5DataManager& dm, const std::string& sPath ); // attributes re-read from the dataset
+
+protected:
+private:
+  HDF5DataManager& m_dm;
+  vEntry_t m_vEntry;
+  std::vector<std::string> m_vComplete; // groups
+};
+
+} // namespace tf
+} // namespace ou
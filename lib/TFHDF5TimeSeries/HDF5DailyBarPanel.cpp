@@ -0,0 +1,338 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <TFTimeSeries/DatedDatumPod.h>
+
+#include "HDF5Catalog.h"
+#include "HDF5TimeSeriesStore.h"
+#include "HDF5DailyBarPanel.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+
+  const std::size_t c_nSymbol = 64;
+  const hsize_t c_nChunkList = 256;        // rows of 'days' and 'symbols'
+  const hsize_t c_nChunkSymbols = 64;      // a chunk of a field is 64 symbols x 256 days, 128KB
+  const hsize_t c_nChunkDays = 256;
+
+  const DailyBarPanel::size_type c_nBatch = 1 << 20;  // bars staged before they are merged
+
+  const char* const szField[ DailyBarPanel::nFields ] = { "open", "high", "low", "close", "volume" };
+
+  const boost::int64_t usNull = std::numeric_limits<boost::int64_t>::min();  // not_a_date_time
+
+  const boost::posix_time::ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+
+  // a row of 'symbols'
+  struct Record {
+    char szSymbol[ c_nSymbol ];
+    boost::int64_t usThrough;  // microseconds from the epoch
+  };
+
+  H5::CompType DefineRecordType( void ) {
+    H5::CompType type( sizeof( Record ) );
+    type.insertMember( "Symbol",  HOFFSET( Record, szSymbol ),  H5::StrType( H5::PredType::C_S1, c_nSymbol ) );
+    type.insertMember( "Through", HOFFSET( Record, usThrough ), H5::PredType::NATIVE_INT64 );
+    return type;
+  }
+
+  boost::int64_t ToMicroseconds( const boost::posix_time::ptime& dt ) {
+    return dt.is_special() ? usNull : ( dt - dtEpoch ).total_microseconds();
+  }
+
+  boost::posix_time::ptime FromMicroseconds( boost::int64_t us ) {
+    return ( usNull == us ) ? boost::posix_time::ptime() : dtEpoch + boost::posix_time::microseconds( us );
+  }
+
+  struct Series {
+    std::string sPath;
+    std::string sName;
+    boost::posix_time::ptime dtLast;  // not_a_date_time when not known
+  };
+  typedef std::vector<Series> vSeries_t;
+
+  struct CollectEntry {
+    vSeries_t& v;
+    explicit CollectEntry( vSeries_t& v_ ): v( v_ ) {};
+    void operator()( const HDF5Catalog::Entry& entry ) const {
+      if ( ( 0 != entry.nSignature ) && ( pod::Bar::Signature() != entry.nSignature ) ) return;
+      Series series;
+      series.sPath = entry.sPath;
+      series.sName = entry.sName;
+      if ( !entry.dtFirst.is_special() ) series.dtLast = entry.dtLast;
+      v.push_back( series );
+    }
+  };
+
+  hsize_t Rows( H5::DataSet& dataset ) {
+    H5::DataSpace dspace( dataset.getSpace() );
+    hsize_t nRows;
+    dspace.getSimpleExtentDims( &nRows );
+    dspace.close();
+    return nRows;
+  }
+
+  // a one dimensional, extendible, dataset, opened when it exists, created otherwise
+  H5::DataSet OpenList( HDF5DataManager& dm, const std::string& sPath, const H5::DataType& type, bool bExists ) {
+    if ( bExists ) return dm.GetH5File()->openDataSet( sPath );
+    hsize_t nSize( 0 );
+    hsize_t nMax( H5S_UNLIMITED );
+    H5::DataSpace dspace( 1, &nSize, &nMax );
+    H5::DSetCreatPropList pl;
+    pl.setChunk( 1, &c_nChunkList );
+    H5::DataSet dataset( dm.GetH5File()->createDataSet( sPath, type, dspace, pl ) );
+    pl.close();
+    dspace.close();
+    return dataset;
+  }
+
+  template<typename T>
+  void WriteList( H5::DataSet& dataset, const H5::DataType& type, const std::vector<T>& v ) {
+    hsize_t nSize( v.size() );
+    if ( Rows( dataset ) < nSize ) dataset.extend( &nSize );
+    if ( 0 == nSize ) return;
+    H5::DataSpace dsMemory( 1, &nSize );
+    H5::DataSpace dsDisk( dataset.getSpace() );
+    hsize_t ix( 0 );
+    dsDisk.selectHyperslab( H5S_SELECT_SET, &nSize, &ix );
+    dataset.write( &v[ 0 ], type, dsMemory, dsDisk );
+    dsDisk.close();
+    dsMemory.close();
+  }
+
+  // symbols [ixSymbol, ixSymbol + nSymbols) x rows [ixRow, ixRow + nRows) of the panel's field, to or from the dataset
+  //   ixOffset is the row in the dataset of the panel's first row
+  void Transfer( H5::DataSet& dataset, DailyBarPanel& panel, DailyBarPanel::enumField field,
+    hsize_t ixSymbol, hsize_t nSymbols, hsize_t ixRow, hsize_t nRows, hsize_t ixOffset, bool bWrite )
+  {
+    if ( ( 0 == nSymbols ) || ( 0 == nRows ) ) return;
+    hsize_t dimMemory[ 2 ] = { panel.Symbols(), panel.Stride() };
+    hsize_t count[ 2 ] = { nSymbols, nRows };
+    hsize_t startMemory[ 2 ] = { ixSymbol, ixRow };
+    hsize_t startDisk[ 2 ] = { ixSymbol, ixRow + ixOffset };
+    H5::DataSpace dsMemory( 2, dimMemory );
+    dsMemory.selectHyperslab( H5S_SELECT_SET, count, startMemory );
+    H5::DataSpace dsDisk( dataset.getSpace() );
+    dsDisk.selectHyperslab( H5S_SELECT_SET, count, startDisk );
+    if ( bWrite ) dataset.write( panel.Data( field ), H5::PredType::NATIVE_DOUBLE, dsMemory, dsDisk );
+    else dataset.read( panel.Data( field ), H5::PredType::NATIVE_DOUBLE, dsMemory, dsDisk );
+    dsDisk.close();
+    dsMemory.close();
+  }
+
+} // namespace anonymous
+
+HDF5DailyBarPanel::HDF5DailyBarPanel( HDF5DataManager& dm, DailyBarPanel& panel, const std::string& sSource )
+: m_dm( dm ), m_panel( panel ),
+  m_sSource( ( '/' == sSource[ sSource.size() - 1 ] ) ? sSource : sSource + '/' ),
+  m_sGroup( "/panel" + m_sSource ),
+  m_bWindow( false )
+{
+}
+
+HDF5DailyBarPanel::~HDF5DailyBarPanel( void ) {
+}
+
+// each part of the path is looked at, so a missing group isn't an hdf5 error
+bool HDF5DailyBarPanel::Exists( const std::string& sName ) const {
+  const std::string sPath( Path( sName ) );
+  std::string::size_type ix = sPath.find( '/', 1 );
+  for ( ; ; ix = sPath.find( '/', ix + 1 ) ) {
+    const std::string sPart( sPath.substr( 0, ix ) );
+    if ( 0 >= H5Lexists( m_dm.GetH5File()->getId(), sPart.c_str(), H5P_DEFAULT ) ) return false;
+    if ( std::string::npos == ix ) break;
+  }
+  return true;
+}
+
+bool HDF5DailyBarPanel::Load( const boost::gregorian::date& dateBegin ) {
+
+  m_panel.Clear();
+  m_dateBegin = dateBegin;
+  m_bWindow = false;
+
+  if ( !Exists( "symbols" ) ) return false;
+
+  H5::DataSet dsDays( m_dm.GetH5File()->openDataSet( Path( "days" ) ) );
+  DailyBarPanel::vDay_t vDay( Rows( dsDays ) );
+  if ( !vDay.empty() ) dsDays.read( &vDay[ 0 ], H5::PredType::NATIVE_INT32 );
+  dsDays.close();
+
+  H5::DataSet dsSymbols( m_dm.GetH5File()->openDataSet( Path( "symbols" ) ) );
+  std::vector<Record> vRecord( Rows( dsSymbols ) );
+  if ( !vRecord.empty() ) dsSymbols.read( &vRecord[ 0 ], DefineRecordType() );
+  dsSymbols.close();
+
+  DailyBarPanel::vSymbol_t vSymbol( vRecord.size() );
+  DailyBarPanel::vThrough_t vThrough( vRecord.size() );
+  for ( std::size_t ix = 0; ix < vRecord.size(); ++ix ) {
+    vSymbol[ ix ].assign( vRecord[ ix ].szSymbol, strnlen( vRecord[ ix ].szSymbol, c_nSymbol ) );
+    vThrough[ ix ] = FromMicroseconds( vRecord[ ix ].usThrough );
+  }
+
+  hsize_t ixOffset( 0 );
+  if ( !dateBegin.is_special() ) {
+    ixOffset = std::lower_bound( vDay.begin(), vDay.end(), DailyBarPanel::ToDay( dateBegin ) ) - vDay.begin();
+    vDay.erase( vDay.begin(), vDay.begin() + ixOffset );
+    m_bWindow = ( 0 < ixOffset );
+  }
+
+  m_panel.Reset( vDay, vSymbol, vThrough );
+  for ( int ix = 0; ix < DailyBarPanel::nFields; ++ix ) {
+    H5::DataSet dataset( m_dm.GetH5File()->openDataSet( Path( szField[ ix ] ) ) );
+    Transfer( dataset, m_panel, static_cast<DailyBarPanel::enumField>( ix ), 0, m_panel.Symbols(), 0, m_panel.Dates(), ixOffset, false );
+    dataset.close();
+  }
+  m_panel.Extents();
+  m_panel.Mark();
+
+  return true;
+}
+
+unsigned int HDF5DailyBarPanel::Update( void ) {
+
+  vSeries_t vSeries;
+  HDF5Catalog catalog( m_dm );
+  if ( catalog.Covers( m_sSource ) ) {
+    catalog.Select( m_sSource, CollectEntry( vSeries ) );
+  }
+  else {
+    std::vector<std::string> vPath;
+    try {
+      HDF5Catalog::Paths( m_dm, m_sSource, vPath );
+    }
+    catch ( H5::Exception& e ) {
+      std::cout << "HDF5DailyBarPanel::Update " << m_sSource << ": " << e.getDetailMsg() << std::endl;
+    }
+    for ( std::vector<std::string>::const_iterator iter = vPath.begin(); vPath.end() != iter; ++iter ) {
+      Series series;
+      series.sPath = *iter;
+      series.sName = iter->substr( iter->rfind( '/' ) + 1 );
+      vSeries.push_back( series );
+    }
+  }
+
+  unsigned int nSymbols( 0 );
+  for ( vSeries_t::const_iterator iter = vSeries.begin(); vSeries.end() != iter; ++iter ) {
+    if ( c_nSymbol <= iter->sName.size() ) continue;
+    if ( Fold( iter->sPath, iter->sName, iter->dtLast ) ) ++nSymbols;
+    if ( c_nBatch <= m_panel.Staged() ) m_panel.Merge();
+  }
+  m_panel.Merge();
+
+  return nSymbols;
+}
+
+// the bars of the dataset after the symbol's Through(), staged in the panel
+bool HDF5DailyBarPanel::Fold( const std::string& sPath, const std::string& sSymbol, const boost::posix_time::ptime& dtLast ) {
+  const DailyBarPanel::size_type ixSymbol = m_panel.FindSymbol( sSymbol );
+  const boost::posix_time::ptime dtThrough( ( DailyBarPanel::npos == ixSymbol ) ? boost::posix_time::ptime() : m_panel.Through( ixSymbol ) );
+  if ( !dtThrough.is_special() && !dtLast.is_special() && ( dtLast <= dtThrough ) ) return false; // nothing new, known from the catalog
+  try {
+    HDF5TimeSeriesStore<pod::Bar> store( m_dm, sPath );
+    boost::posix_time::ptime dtFrom;
+    if ( !dtThrough.is_special() ) dtFrom = dtThrough + boost::posix_time::microseconds( 1 );
+    if ( !m_dateBegin.is_special() && ( dtFrom.is_special() || ( dtFrom < boost::posix_time::ptime( m_dateBegin ) ) ) ) {
+      dtFrom = boost::posix_time::ptime( m_dateBegin );
+    }
+    const HDF5TimeSeriesStore<pod::Bar>::size_type ixBegin = dtFrom.is_special() ? 0 : store.LowerBound( dtFrom );
+    const HDF5TimeSeriesStore<pod::Bar>::size_type size = store.Size();
+    if ( ixBegin >= size ) return false;
+    std::vector<pod::Bar> v( size - ixBegin );
+    store.Read( ixBegin, v.size(), &v[ 0 ] );
+    m_panel.Add( sSymbol, &v[ 0 ], &v[ 0 ] + v.size(), v.back().DateTime() );
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5DailyBarPanel::Update " << sPath << ": " << e.getDetailMsg() << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void HDF5DailyBarPanel::Save( void ) {
+
+  if ( m_bWindow ) throw std::runtime_error( "HDF5DailyBarPanel::Save: panel was loaded from a date on" );
+
+  m_panel.Merge();
+
+  const bool bExists = Exists( "symbols" );
+  if ( !bExists ) m_dm.AddGroup( m_sGroup );
+
+  const H5::CompType typeRecord( DefineRecordType() );
+  H5::DataSet dsDays( OpenList( m_dm, Path( "days" ), H5::PredType::NATIVE_INT32, bExists ) );
+  H5::DataSet dsSymbols( OpenList( m_dm, Path( "symbols" ), typeRecord, bExists ) );
+  if ( ( Rows( dsDays ) != m_panel.MarkedDates() ) || ( Rows( dsSymbols ) != m_panel.MarkedSymbols() ) ) {
+    dsSymbols.close();
+    dsDays.close();
+    throw std::runtime_error( "HDF5DailyBarPanel::Save: panel in the file has changed, it needs to be loaded first" );
+  }
+
+  WriteList( dsDays, H5::PredType::NATIVE_INT32, m_panel.Days() );
+  dsDays.close();
+
+  std::vector<Record> vRecord( m_panel.Symbols() );
+  for ( DailyBarPanel::size_type ix = 0; ix < m_panel.Symbols(); ++ix ) {
+    std::memset( &vRecord[ ix ], 0, sizeof( Record ) );
+    std::strncpy( vRecord[ ix ].szSymbol, m_panel.Symbol( ix ).c_str(), c_nSymbol - 1 );
+    vRecord[ ix ].usThrough = ToMicroseconds( m_panel.Through( ix ) );
+  }
+  WriteList( dsSymbols, typeRecord, vRecord );
+  dsSymbols.close();
+
+  const hsize_t nSymbols = m_panel.Symbols();
+  const hsize_t nDates = m_panel.Dates();
+  const hsize_t nMarked = m_panel.MarkedSymbols();
+  const hsize_t ixDirty = m_panel.DirtyRow();
+  for ( int ix = 0; ix < DailyBarPanel::nFields; ++ix ) {
+    H5::DataSet dataset;
+    if ( bExists ) {
+      dataset = m_dm.GetH5File()->openDataSet( Path( szField[ ix ] ) );
+    }
+    else {
+      hsize_t dim[ 2 ] = { 0, 0 };
+      hsize_t dimMax[ 2 ] = { H5S_UNLIMITED, H5S_UNLIMITED };
+      hsize_t dimChunk[ 2 ] = { c_nChunkSymbols, c_nChunkDays };
+      const double dblFill = std::numeric_limits<double>::quiet_NaN();
+      H5::DataSpace dspace( 2, dim, dimMax );
+      H5::DSetCreatPropList pl;
+      pl.setChunk( 2, dimChunk );
+      pl.setFillValue( H5::PredType::NATIVE_DOUBLE, &dblFill );
+      dataset = m_dm.GetH5File()->createDataSet( Path( szField[ ix ] ), H5::PredType::NATIVE_DOUBLE, dspace, pl );
+      pl.close();
+      dspace.close();
+    }
+    hsize_t dim[ 2 ] = { nSymbols, nDates };
+    dataset.extend( dim );
+    const DailyBarPanel::enumField field = static_cast<DailyBarPanel::enumField>( ix );
+    Transfer( dataset, m_panel, field, 0, nMarked, ixDirty, nDates - ixDirty, 0, true );  // changed rows of the stored symbols
+    Transfer( dataset, m_panel, field, nMarked, nSymbols - nMarked, 0, nDates, 0, true ); // new symbols
+    dataset.close();
+  }
+
+  m_panel.Mark();
+}
+
+} // namespace tf
+} // namespace ou
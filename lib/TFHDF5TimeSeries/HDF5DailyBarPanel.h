@@ -0,0 +1,72 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// keeps a DailyBarPanel in the hdf5 file, and brings it up to date from the per symbol daily bar datasets
+//   the panel of source group '/bar/86400/' is kept in the group '/panel/bar/86400/':
+//     'days'    day numbers of the date axis ( DailyBarPanel::day_t )
+//     'symbols' symbol, and the time of the last source bar folded in
+//     'open', 'high', 'low', 'close', 'volume'  symbols x days of double, NaN where there is no bar
+// Update reads, for each dataset below the source, only the bars after what the panel holds,
+//   the catalog ( HDF5Catalog ) tells which datasets have newer bars without opening them,
+//   when it doesn't cover the source, the file is walked and each dataset opened
+// Save writes only what changed since Load or the last Save: new days, new symbols, and rows from the first changed one
+// a panel loaded from a date on is for scans, it can be updated, but not saved
+
+#include <string>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <TFTimeSeries/DailyBarPanel.h>
+
+#include "HDF5DataManager.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class HDF5DailyBarPanel {
+public:
+
+  HDF5DailyBarPanel( HDF5DataManager& dm, DailyBarPanel& panel, const std::string& sSource = "/bar/86400/" );
+  ~HDF5DailyBarPanel( void );
+
+  const std::string& Group( void ) const { return m_sGroup; };
+
+  // the panel is replaced with the one in the file, from dateBegin on, false, and an empty panel, when the file has none
+  bool Load( const boost::gregorian::date& dateBegin = boost::gregorian::date() );
+
+  unsigned int Update( void ); // returns symbols with bars added to the panel
+
+  void Save( void ); // dm needs to be read/write
+
+protected:
+private:
+
+  HDF5DataManager& m_dm;
+  DailyBarPanel& m_panel;
+  const std::string m_sSource;
+  const std::string m_sGroup;
+  boost::gregorian::date m_dateBegin;
+  bool m_bWindow;  // loaded from m_dateBegin, with days before it left in the file
+
+  bool Exists( const std::string& sName ) const;
+  std::string Path( const std::string& sName ) const { return m_sGroup + sName; };
+  bool Fold( const std::string& sPath, const std::string& sSymbol, const boost::posix_time::ptime& dtLast );
+};
+
+} // namespace tf
+} // namespace ou
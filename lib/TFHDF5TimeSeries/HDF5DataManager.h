@@ -22,6 +22,20 @@
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+// raw chunk cache for a dataset as it is opened, see the note at the bottom of the file
+//   nBytes should hold at least one chunk, nSlots should be a prime about 100 times the number of chunks which fit,
+//   dblW0 near 1.0 evicts fully read chunks first, which suits forward scans
+struct HDF5ChunkCache {
+  size_t nSlots;
+  size_t nBytes;
+  double dblW0;
+  HDF5ChunkCache( void ) // leave as the library default
+    : nSlots( H5D_CHUNK_CACHE_NSLOTS_DEFAULT ), nBytes( H5D_CHUNK_CACHE_NBYTES_DEFAULT ), dblW0( H5D_CHUNK_CACHE_W0_DEFAULT ) {};
+  HDF5ChunkCache( size_t nSlots_, size_t nBytes_, double dblW0_ = 0.75 )
+    : nSlots( nSlots_ ), nBytes( nBytes_ ), dblW0( dblW0_ ) {};
+  bool IsDefault( void ) const { return ( H5D_CHUNK_CACHE_NSLOTS_DEFAULT == nSlots ) && ( H5D_CHUNK_CACHE_NBYTES_DEFAULT == nBytes ); };
+};
+
 class HDF5DataManager {
 public:
   enum enumFileOptionType{ RDWR, RO };
@@ -0,0 +1,124 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+
+#include <TFTimeSeries/DatedDatumPod.h>
+#include <TFTimeSeries/FlatFileTimeSeries.h>
+
+#include "HDF5Attribute.h"
+#include "HDF5IterateGroups.h"
+#include "HDF5TimeSeriesStore.h"
+#include "HDF5FlatFileConverter.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+HDF5FlatFileConverter::HDF5FlatFileConverter( const std::string& sRoot )
+: m_sRoot( sRoot ), m_dm( HDF5DataManager::RO )
+{
+}
+
+HDF5FlatFileConverter::~HDF5FlatFileConverter( void ) {
+}
+
+const HDF5FlatFileConverter::stats_t& HDF5FlatFileConverter::Convert( const std::string& sGroup ) {
+  HDF5IterateGroups control;
+  control.SetOnHandleGroup( MakeDelegate( this, &HDF5FlatFileConverter::HandleGroup ) );
+  control.SetOnHandleObject( MakeDelegate( this, &HDF5FlatFileConverter::HandleObject ) );
+  control.Start( sGroup );
+  return m_stats;
+}
+
+boost::uint64_t HDF5FlatFileConverter::Signature( const std::string& sPath ) {
+  boost::uint64_t signature( 0 );
+  H5::DataSet dataset( m_dm.GetH5File()->openDataSet( sPath ) );
+  const bool bSignature = dataset.attrExists( "Signature" );
+  dataset.close();
+  if ( bSignature ) {
+    HDF5Attributes attributes( m_dm, sPath );
+    signature = attributes.GetSignature();
+  }
+  else {
+    // older datasets were written without one, the group tells the type
+    if ( std::string::npos != sPath.find( "/quotes/" ) ) signature = pod::Quote::Signature();
+    else if ( std::string::npos != sPath.find( "/trades/" ) ) signature = pod::Trade::Signature();
+    else if ( std::string::npos != sPath.find( "/greeks/" ) ) signature = pod::Greek::Signature();
+    else if ( 0 == sPath.find( "/bar/" ) ) signature = pod::Bar::Signature();  // /bar/<seconds>/...
+  }
+  return signature;
+}
+
+void HDF5FlatFileConverter::HandleObject( const std::string& sPath, const std::string& sName ) {
+  const boost::uint64_t signature = Signature( sPath );
+  if ( pod::Quote::Signature() == signature ) ConvertSeries<pod::Quote>( sPath, sName );
+  else if ( pod::Trade::Signature() == signature ) ConvertSeries<pod::Trade>( sPath, sName );
+  else if ( pod::Bar::Signature() == signature ) ConvertSeries<pod::Bar>( sPath, sName );
+  else if ( pod::Greek::Signature() == signature ) ConvertSeries<pod::Greek>( sPath, sName );
+  else if ( pod::Price::Signature() == signature ) ConvertSeries<pod::Price>( sPath, sName );
+  else ++m_stats.nSkipped;
+}
+
+template<class DD>
+void HDF5FlatFileConverter::ConvertSeries( const std::string& sPath, const std::string& sName ) {
+
+  static const pod::epoch_t nDay = pod::epoch_t( 86400 ) * 1000000000;
+  static const boost::gregorian::date dateEpoch( 1970, 1, 1 );
+
+  try {
+    HDF5TimeSeriesStore<DD> store( m_dm, sPath );
+    const typename HDF5TimeSeriesStore<DD>::size_type size = store.Size();
+    std::vector<DD> v;
+    typename HDF5TimeSeriesStore<DD>::size_type ixBegin( 0 );
+    if ( !FlatFile::Daily( DD::Signature() ) ) {  // bars, the series in one file
+      v.resize( size );
+      if ( 0 < size ) store.Read( 0, size, &v[ 0 ] );
+      FlatFileTimeSeries<DD>::Write( FlatFile::FileName( m_sRoot, DD::Signature(), sName ), v.data(), v.data() + v.size() );
+      ++m_stats.nFiles;
+      m_stats.nRecords += v.size();
+      ixBegin = size;
+    }
+    while ( ixBegin < size ) {  // a day at a time
+      DD datum;
+      store.Read( ixBegin, 1, &datum );
+      pod::epoch_t nDays = datum.Epoch() / nDay;
+      if ( datum.Epoch() < nDays * nDay ) --nDays;
+      const boost::gregorian::date date = dateEpoch + boost::gregorian::days( nDays );
+      const typename HDF5TimeSeriesStore<DD>::size_type ixEnd = store.LowerBound( pod::FromEpoch( ( nDays + 1 ) * nDay ) );
+      if ( ixEnd <= ixBegin ) throw std::runtime_error( "not in time order" );
+      v.resize( ixEnd - ixBegin );
+      store.Read( ixBegin, v.size(), &v[ 0 ] );
+      FlatFileTimeSeries<DD>::Write( FlatFile::FileName( m_sRoot, DD::Signature(), date, sName ), &v[ 0 ], &v[ 0 ] + v.size() );
+      ++m_stats.nFiles;
+      m_stats.nRecords += v.size();
+      ixBegin = ixEnd;
+    }
+    ++m_stats.nSeries;
+  }
+  catch ( std::runtime_error& e ) {
+    std::cout << "HDF5FlatFileConverter::ConvertSeries " << sPath << ": " << e.what() << std::endl;
+    ++m_stats.nSkipped;
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5FlatFileConverter::ConvertSeries " << sPath << ": " << e.getDetailMsg() << std::endl;
+    ++m_stats.nSkipped;
+  }
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,69 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// copies the time series datasets below an hdf5 group into flat files (FlatFileTimeSeries)
+//   each series of ticks is split by day (utc), into <root>/<type>/<yyyymmdd>/<dataset name>.tfs
+//   a series of bars is kept whole, in <root>/bars/<dataset name>.tfs
+//   the datum type comes from the dataset's Signature attribute, or, for older datasets without one,
+//     from a 'quotes', 'trades', 'greeks' group in the path, or a path below /bar/
+//   datasets of other types are skipped
+//   an existing file for the same symbol and day, or of bars for the symbol, is replaced,
+//     so converting two groups holding series with the same name leaves the series of the second
+
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include "HDF5DataManager.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class HDF5FlatFileConverter {
+public:
+
+  struct stats_t {
+    unsigned int nSeries;  // datasets converted
+    unsigned int nSkipped; // datasets of unknown type, or which could not be read
+    unsigned int nFiles;   // files written
+    boost::uint64_t nRecords;
+    stats_t( void ): nSeries( 0 ), nSkipped( 0 ), nFiles( 0 ), nRecords( 0 ) {};
+  };
+
+  explicit HDF5FlatFileConverter( const std::string& sRoot );
+  ~HDF5FlatFileConverter( void );
+
+  const stats_t& Convert( const std::string& sGroup ); // every dataset below the group, totals accumulate across calls
+  const stats_t& Stats( void ) const { return m_stats; };
+
+protected:
+private:
+
+  const std::string m_sRoot;
+  HDF5DataManager m_dm;
+  stats_t m_stats;
+
+  void HandleGroup( const std::string& /* sPath */, const std::string& /* sName */ ) {};
+  void HandleObject( const std::string& sPath, const std::string& sName );
+
+  boost::uint64_t Signature( const std::string& sPath );
+  template<class DD> void ConvertSeries( const std::string& sPath, const std::string& sName );
+};
+
+} // namespace tf
+} // namespace ou
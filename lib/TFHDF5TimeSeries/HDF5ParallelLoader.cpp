@@ -0,0 +1,296 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/locks.hpp>
+
+#include <zlib.h>
+
+#include "HDF5ParallelLoader.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+
+  // chunks as stored on disk, with what is required to decode them
+  struct Raw {
+    struct Chunk {
+      std::vector<unsigned char> vBytes;
+      unsigned int nFilterMask; // bit set: filter was skipped for this chunk
+    };
+    struct Member {
+      std::size_t ixSource; // offset in the disk record
+      std::size_t ixDest;   // offset in the memory datum
+      std::size_t nSize;
+    };
+    hsize_t nElements;
+    hsize_t nChunkElements;
+    std::size_t nRecordSize; // disk record
+    std::vector<H5Z_filter_t> vFilter; // pipeline order
+    std::vector<Chunk> vChunk;
+    std::vector<Member> vMember;
+  };
+
+  bool Exists( H5::H5File& file, const std::string& sPath ) { // without raising, and printing, an hdf5 error
+    std::string::size_type ix = sPath.find( '/', 1 );
+    while ( true ) {
+      const std::string sPart( sPath.substr( 0, ix ) );
+      if ( 0 >= H5Lexists( file.getId(), sPart.c_str(), H5P_DEFAULT ) ) return false;
+      if ( std::string::npos == ix ) return true;
+      ix = sPath.find( '/', ix + 1 );
+    }
+  }
+
+  // lock held: map the members, and pull the chunks without passing them through the filter pipeline
+  bool FetchRaw( H5::DataSet& dataset, H5::CompType& typeMemory, hsize_t nElements, Raw& raw ) {
+#if H5_VERSION_GE(1,10,2)
+    raw.nElements = nElements;
+
+    H5::DSetCreatPropList pl( dataset.getCreatePlist() );
+    if ( H5D_CHUNKED != pl.getLayout() ) return false;
+    if ( 1 != pl.getChunk( 1, &raw.nChunkElements ) ) return false;
+    const int nFilters( pl.getNfilters() );
+    for ( int ix = 0; ix < nFilters; ++ix ) {
+      unsigned int flags;
+      size_t nValues( 0 );
+      char szName[ 64 ];
+      unsigned int filter_config;
+      H5Z_filter_t filter( pl.getFilter( ix, flags, nValues, NULL, sizeof( szName ), szName, filter_config ) );
+      if ( ( H5Z_FILTER_DEFLATE != filter ) && ( H5Z_FILTER_SHUFFLE != filter ) ) return false;
+      raw.vFilter.push_back( filter );
+    }
+
+    H5::CompType typeDisk( dataset );
+    raw.nRecordSize = typeDisk.getSize();
+    const int nMembers( typeMemory.getNmembers() );
+    for ( int ix = 0; ix < nMembers; ++ix ) {
+      const std::string sName( typeMemory.getMemberName( ix ) );
+      const int ixDisk( H5Tget_member_index( typeDisk.getId(), sName.c_str() ) );
+      if ( 0 > ixDisk ) return false;
+      H5::DataType dtMemory( typeMemory.getMemberDataType( ix ) );
+      H5::DataType dtDisk( typeDisk.getMemberDataType( ixDisk ) );
+      if ( !( dtMemory == dtDisk ) ) return false; // needs a conversion, leave it to the library
+      Raw::Member member;
+      member.ixSource = typeDisk.getMemberOffset( ixDisk );
+      member.ixDest = typeMemory.getMemberOffset( ix );
+      member.nSize = dtMemory.getSize();
+      raw.vMember.push_back( member );
+    }
+
+    const hsize_t nChunks( ( nElements + raw.nChunkElements - 1 ) / raw.nChunkElements );
+    raw.vChunk.resize( nChunks );
+    for ( hsize_t ixChunk = 0; ixChunk < nChunks; ++ixChunk ) {
+      hsize_t offset( ixChunk * raw.nChunkElements );
+      hsize_t nBytes( 0 );
+      if ( 0 > H5Dget_chunk_storage_size( dataset.getId(), &offset, &nBytes ) ) return false;
+      if ( 0 == nBytes ) return false; // not allocated, the library supplies fill values
+      Raw::Chunk& chunk( raw.vChunk[ ixChunk ] );
+      chunk.vBytes.resize( nBytes );
+      boost::uint32_t mask( 0 );
+      if ( 0 > H5Dread_chunk( dataset.getId(), H5P_DEFAULT, &offset, &mask, &chunk.vBytes[ 0 ] ) ) return false;
+      chunk.nFilterMask = mask;
+    }
+    return true;
+#else
+    return false; // direct chunk read not available
+#endif
+  }
+
+  // lock not held: reverse the filter pipeline, then copy members into place
+  bool DecodeRaw( const Raw& raw, unsigned char* pDest, std::size_t nStride ) {
+    const std::size_t nChunkBytes( raw.nChunkElements * raw.nRecordSize );
+    std::vector<unsigned char> vWork;
+    std::vector<unsigned char> vTemp;
+    for ( std::size_t ixChunk = 0; ixChunk < raw.vChunk.size(); ++ixChunk ) {
+      const Raw::Chunk& chunk( raw.vChunk[ ixChunk ] );
+      vWork = chunk.vBytes;
+      for ( int ixFilter = (int) raw.vFilter.size() - 1; 0 <= ixFilter; --ixFilter ) {
+        if ( 0 != ( chunk.nFilterMask & ( 1u << ixFilter ) ) ) continue;
+        switch ( raw.vFilter[ ixFilter ] ) {
+        case H5Z_FILTER_DEFLATE: {
+          vTemp.resize( nChunkBytes );
+          uLongf nOut( nChunkBytes );
+          if ( Z_OK != uncompress( &vTemp[ 0 ], &nOut, &vWork[ 0 ], vWork.size() ) ) return false;
+          vTemp.resize( nOut );
+          vWork.swap( vTemp );
+          }
+          break;
+        case H5Z_FILTER_SHUFFLE: { // byte j of every record was stored together
+          const std::size_t nRecords( vWork.size() / raw.nRecordSize );
+          vTemp = vWork; // keeps any trailing partial record as is
+          for ( std::size_t ixByte = 0; ixByte < raw.nRecordSize; ++ixByte ) {
+            const unsigned char* pSrc( &vWork[ ixByte * nRecords ] );
+            for ( std::size_t ixRecord = 0; ixRecord < nRecords; ++ixRecord ) {
+              vTemp[ ixRecord * raw.nRecordSize + ixByte ] = pSrc[ ixRecord ];
+            }
+          }
+          vWork.swap( vTemp );
+          }
+          break;
+        }
+      }
+      const hsize_t ixFirst( ixChunk * raw.nChunkElements );
+      const hsize_t nRecords( std::min<hsize_t>( raw.nChunkElements, raw.nElements - ixFirst ) );
+      if ( vWork.size() < nRecords * raw.nRecordSize ) return false;
+      const unsigned char* pSrc( &vWork[ 0 ] );
+      unsigned char* pDst( pDest + ixFirst * nStride );
+      for ( hsize_t ixRecord = 0; ixRecord < nRecords; ++ixRecord ) {
+        for ( std::vector<Raw::Member>::const_iterator iter = raw.vMember.begin(); raw.vMember.end() != iter; ++iter ) {
+          std::memcpy( pDst + iter->ixDest, pSrc + iter->ixSource, iter->nSize );
+        }
+        pSrc += raw.nRecordSize;
+        pDst += nStride;
+      }
+    }
+    return true;
+  }
+
+  // lock held: the usual way, the library converts
+  void ReadAll( H5::DataSet& dataset, H5::CompType& typeMemory, hsize_t nElements, void* pDest ) {
+    H5::DataSpace dsMemory( 1, &nElements );
+    H5::DataSpace dsDisk( dataset.getSpace() );
+    dataset.read( pDest, typeMemory, dsMemory, dsDisk );
+    dsDisk.close();
+    dsMemory.close();
+  }
+
+}
+
+HDF5ParallelLoader::HDF5ParallelLoader( HDF5DataManager& dm )
+: m_dm( dm ), m_ixNextJob( 0 ), m_cntDone( 0 )
+{
+}
+
+HDF5ParallelLoader::~HDF5ParallelLoader( void ) {
+  for ( std::vector<JobBase*>::iterator iter = m_vJob.begin(); m_vJob.end() != iter; ++iter ) {
+    delete *iter;
+  }
+}
+
+std::size_t HDF5ParallelLoader::Load( unsigned int nThreads, OnProgress_t progress ) {
+
+  if ( 0 == nThreads ) nThreads = boost::thread::hardware_concurrency();
+  nThreads = std::max<unsigned int>( 1, std::min<std::size_t>( nThreads, m_vJob.size() ) );
+
+  m_ixNextJob = 0;
+  m_cntDone = 0;
+
+  boost::thread_group threads;
+  for ( unsigned int ix = 0; ix < nThreads; ++ix ) {
+    threads.create_thread( boost::bind( &HDF5ParallelLoader::Worker, this ) );
+  }
+
+  {
+    boost::unique_lock<boost::mutex> lock( m_mutex );
+    std::size_t cntReported( 0 );
+    while ( cntReported < m_vJob.size() ) {
+      while ( cntReported == m_cntDone ) m_cvDone.wait( lock );
+      cntReported = m_cntDone;
+      if ( 0 != progress ) {
+        lock.unlock();
+        progress( cntReported, m_vJob.size() );
+        lock.lock();
+      }
+    }
+  }
+
+  threads.join_all();
+
+  std::size_t cntFound( 0 );
+  for ( std::vector<JobBase*>::iterator iter = m_vJob.begin(); m_vJob.end() != iter; ++iter ) {
+    if ( (*iter)->m_bFound ) ++cntFound;
+  }
+  return cntFound;
+}
+
+void HDF5ParallelLoader::Worker( void ) {
+  while ( true ) {
+    JobBase* pJob;
+    {
+      boost::lock_guard<boost::mutex> guard( m_mutex );
+      if ( m_vJob.size() <= m_ixNextJob ) break;
+      pJob = m_vJob[ m_ixNextJob++ ];
+    }
+    try {
+      Process( *pJob );
+    }
+    catch ( H5::Exception& e ) {
+      std::cout << "HDF5ParallelLoader " << pJob->m_sPath << ": " << e.getDetailMsg() << std::endl;
+      pJob->m_bFound = false;
+    }
+    catch ( std::exception& e ) {
+      std::cout << "HDF5ParallelLoader " << pJob->m_sPath << ": " << e.what() << std::endl;
+      pJob->m_bFound = false;
+    }
+    {
+      boost::lock_guard<boost::mutex> guard( m_mutex );
+      ++m_cntDone;
+    }
+    m_cvDone.notify_one();
+  }
+}
+
+void HDF5ParallelLoader::Process( JobBase& job ) {
+
+  Raw raw;
+  hsize_t nElements( 0 );
+  bool bRaw( false );
+
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutexHDF5 );
+    if ( !Exists( *m_dm.GetH5File(), job.m_sPath ) ) return;
+    H5::DataSet dataset( m_dm.GetH5File()->openDataSet( job.m_sPath ) );
+    H5::DataSpace dsDisk( dataset.getSpace() );
+    nElements = dsDisk.getSimpleExtentNpoints();
+    dsDisk.close();
+    if ( 0 != nElements ) {
+      H5::CompType* pMemory( job.DefineDataType() );
+      bRaw = FetchRaw( dataset, *pMemory, nElements, raw );
+      if ( !bRaw ) {
+        ReadAll( dataset, *pMemory, nElements, job.Allocate( nElements ) );
+      }
+      pMemory->close();
+      delete pMemory;
+    }
+    dataset.close();
+    job.m_bFound = true;
+  }
+
+  if ( bRaw ) {
+    void* pDest( job.Allocate( nElements ) ); // construction of the datums is outside the lock as well
+    if ( !DecodeRaw( raw, static_cast<unsigned char*>( pDest ), job.Stride() ) ) {
+      boost::lock_guard<boost::mutex> guard( m_mutexHDF5 );
+      H5::DataSet dataset( m_dm.GetH5File()->openDataSet( job.m_sPath ) );
+      H5::CompType* pMemory( job.DefineDataType() );
+      ReadAll( dataset, *pMemory, nElements, pDest );
+      pMemory->close();
+      delete pMemory;
+      dataset.close();
+    }
+  }
+
+  if ( 0 != nElements ) job.AfterRead( nElements );
+}
+
+} // namespace tf
+} // namespace ou
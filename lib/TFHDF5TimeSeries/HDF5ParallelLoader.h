@@ -0,0 +1,104 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// loads many series into TimeSeries concurrently:
+//   hdf5 calls are serialized, a worker holds the lock only to fetch the raw, still compressed, chunks of its series
+//   inflate, unshuffle and conversion to the memory layout then run in parallel across the workers
+// series with other filters, unallocated chunks, or members needing numeric conversion
+//   are read by the library in the usual way, under the lock
+
+#include <string>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <OUCommon/FastDelegate.h>
+using namespace fastdelegate;
+
+#include <TFTimeSeries/TimeSeries.h>
+
+#include "HDF5DataManager.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class HDF5ParallelLoader: boost::noncopyable {
+public:
+
+  typedef FastDelegate2<std::size_t, std::size_t> OnProgress_t; // series processed, series total
+
+  HDF5ParallelLoader( HDF5DataManager& dm );
+  ~HDF5ParallelLoader( void );
+
+  // series is resized and filled by Load, is left untouched if sPath is not found
+  template<class DD>
+  void Add( const std::string& sPath, TimeSeries<DD>& series ) {
+    m_vJob.push_back( new Job<DD>( sPath, series ) );
+  }
+
+  // nThreads 0 uses one per core, progress is called on the calling thread, returns series found
+  std::size_t Load( unsigned int nThreads = 0, OnProgress_t progress = 0 );
+
+protected:
+private:
+
+  class JobBase {
+  public:
+    JobBase( const std::string& sPath ): m_sPath( sPath ), m_bFound( false ) {};
+    virtual ~JobBase( void ) {};
+    const std::string m_sPath;
+    bool m_bFound;
+    virtual H5::CompType* DefineDataType( void ) const = 0;
+    virtual void* Allocate( hsize_t n ) = 0; // returns pointer to first of n contiguous datums
+    virtual std::size_t Stride( void ) const = 0;
+    virtual void AfterRead( hsize_t n ) = 0;
+  };
+
+  template<class DD>
+  class Job: public JobBase {
+  public:
+    Job( const std::string& sPath, TimeSeries<DD>& series ): JobBase( sPath ), m_series( series ) {};
+    H5::CompType* DefineDataType( void ) const { return DD::DefineDataType( NULL ); };
+    void* Allocate( hsize_t n ) {
+      m_series.Resize( n );
+      return const_cast<DD*>( &( *m_series.First() ) );
+    }
+    std::size_t Stride( void ) const { return sizeof( DD ); };
+    void AfterRead( hsize_t n ) { DatumStorage<DD>::AfterRead( const_cast<DD*>( &( *m_series.First() ) ), n ); };
+  private:
+    TimeSeries<DD>& m_series;
+  };
+
+  HDF5DataManager& m_dm;
+
+  boost::mutex m_mutexHDF5;
+
+  boost::mutex m_mutex;
+  boost::condition_variable m_cvDone;
+  std::vector<JobBase*> m_vJob;
+  std::size_t m_ixNextJob;
+  std::size_t m_cntDone;
+
+  void Worker( void );
+  void Process( JobBase& );
+};
+
+} // namespace tf
+} // namespace ou
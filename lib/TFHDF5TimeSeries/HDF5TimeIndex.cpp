@@ -0,0 +1,185 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <algorithm>
+
+#include "HDF5TimeIndex.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+
+  const char szTimeIndex[] = "TimeIndex";
+
+  // attribute layout, an array of int64
+  enum { ixVersion = 0, ixWidth, ixOrigin, ixMin, ixMax, ixRows, ixFirstRow };
+
+  const ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+
+  boost::int64_t FloorDiv( boost::int64_t n, boost::int64_t d ) {
+    boost::int64_t q = n / d;
+    if ( ( 0 != ( n % d ) ) && ( n < 0 ) ) --q;
+    return q;
+  }
+
+}
+
+HDF5TimeIndex::HDF5TimeIndex( void ) {
+  Clear();
+}
+
+void HDF5TimeIndex::Clear( void ) {
+  m_nWidth = c_nMinWidth;
+  m_nOrigin = 0;
+  m_usMin = m_usMax = 0;
+  m_nRows = 0;
+  m_vFirstRow.clear();
+}
+
+boost::int64_t HDF5TimeIndex::Microseconds( const ptime& dt ) {
+  return ( dt - dtEpoch ).total_microseconds();
+}
+
+boost::int64_t HDF5TimeIndex::Bucket( boost::int64_t us ) const {
+  return FloorDiv( us, m_nWidth * 1000000 );
+}
+
+ptime HDF5TimeIndex::Min( void ) const {
+  return dtEpoch + boost::posix_time::microseconds( m_usMin );
+}
+
+ptime HDF5TimeIndex::Max( void ) const {
+  return dtEpoch + boost::posix_time::microseconds( m_usMax );
+}
+
+void HDF5TimeIndex::Widen( void ) {
+  // bucket j of the wider index starts with bucket 2 * ( origin + j ) of the current one
+  const boost::int64_t nOrigin = FloorDiv( m_nOrigin, 2 );
+  const boost::int64_t nLast = FloorDiv( m_nOrigin + (boost::int64_t) m_vFirstRow.size() - 1, 2 );
+  std::vector<hsize_t> v( nLast - nOrigin + 1 );
+  for ( std::size_t ix = 0; ix < v.size(); ++ix ) {
+    boost::int64_t ixOld = 2 * ( nOrigin + (boost::int64_t) ix ) - m_nOrigin;
+    v[ ix ] = m_vFirstRow[ std::max<boost::int64_t>( 0, ixOld ) ];
+  }
+  m_vFirstRow.swap( v );
+  m_nOrigin = nOrigin;
+  m_nWidth *= 2;
+}
+
+bool HDF5TimeIndex::Append( const ptime& dt ) {
+  const boost::int64_t us = Microseconds( dt );
+  if ( 0 == m_nRows ) {
+    Clear();
+    m_nOrigin = Bucket( us );
+    m_usMin = us;
+  }
+  else {
+    if ( us < m_usMax ) { // out of order, the index can't describe the series
+      Clear();
+      return false;
+    }
+  }
+  while ( (boost::int64_t) c_nMaxBuckets < ( Bucket( us ) - m_nOrigin + 1 ) ) {
+    Widen();
+  }
+  const boost::int64_t nBucket = Bucket( us );
+  while ( ( m_nOrigin + (boost::int64_t) m_vFirstRow.size() ) <= nBucket ) {
+    m_vFirstRow.push_back( m_nRows );  // empty buckets start with this row as well
+  }
+  m_usMax = us;
+  ++m_nRows;
+  return true;
+}
+
+void HDF5TimeIndex::Truncate( hsize_t nRows, const ptime& dtLast ) {
+  if ( nRows >= m_nRows ) return;
+  if ( 0 == nRows ) {
+    Clear();
+  }
+  else {
+    m_usMax = Microseconds( dtLast );
+    m_vFirstRow.resize( Bucket( m_usMax ) - m_nOrigin + 1 );
+    m_nRows = nRows;
+  }
+}
+
+void HDF5TimeIndex::Bracket( const ptime& dt, hsize_t& ixLo, hsize_t& ixHi ) const {
+  const boost::int64_t us = Microseconds( dt );
+  if ( ( 0 == m_nRows ) || ( us <= m_usMin ) ) {
+    ixLo = ixHi = 0;
+  }
+  else {
+    if ( us > m_usMax ) {
+      ixLo = ixHi = m_nRows;
+    }
+    else {
+      const std::size_t ix = Bucket( us ) - m_nOrigin;
+      assert( ix < m_vFirstRow.size() );
+      ixLo = m_vFirstRow[ ix ];
+      ixHi = ( ( ix + 1 ) < m_vFirstRow.size() ) ? m_vFirstRow[ ix + 1 ] : m_nRows;
+    }
+  }
+}
+
+bool HDF5TimeIndex::Load( H5::DataSet& dataset ) {
+  Clear();
+  if ( !dataset.attrExists( szTimeIndex ) ) return false;
+  H5::Attribute attribute( dataset.openAttribute( szTimeIndex ) );
+  H5::DataSpace dspace( attribute.getSpace() );
+  std::vector<boost::int64_t> v( dspace.getSimpleExtentNpoints() );
+  dspace.close();
+  bool bValid( false );
+  if ( ixFirstRow <= v.size() ) {
+    attribute.read( H5::PredType::NATIVE_INT64, &v[ 0 ] );
+    bValid = ( c_nVersion == v[ ixVersion ] ) && ( c_nMinWidth <= v[ ixWidth ] ) && ( 0 < v[ ixRows ] );
+  }
+  attribute.close();
+  if ( bValid ) {
+    m_nWidth = v[ ixWidth ];
+    m_nOrigin = v[ ixOrigin ];
+    m_usMin = v[ ixMin ];
+    m_usMax = v[ ixMax ];
+    m_nRows = v[ ixRows ];
+    m_vFirstRow.assign( v.begin() + ixFirstRow, v.end() );
+  }
+  return bValid;
+}
+
+void HDF5TimeIndex::Save( H5::DataSet& dataset ) const {
+  if ( dataset.attrExists( szTimeIndex ) ) {
+    dataset.removeAttr( szTimeIndex );  // attributes can't be resized
+  }
+  if ( 0 != m_nRows ) {
+    std::vector<boost::int64_t> v( ixFirstRow );
+    v[ ixVersion ] = c_nVersion;
+    v[ ixWidth ] = m_nWidth;
+    v[ ixOrigin ] = m_nOrigin;
+    v[ ixMin ] = m_usMin;
+    v[ ixMax ] = m_usMax;
+    v[ ixRows ] = m_nRows;
+    v.insert( v.end(), m_vFirstRow.begin(), m_vFirstRow.end() );
+    hsize_t dim = v.size();
+    H5::DataSpace dspace( 1, &dim );
+    H5::Attribute attribute( dataset.createAttribute( szTimeIndex, H5::PredType::NATIVE_INT64, dspace ) );
+    attribute.write( H5::PredType::NATIVE_INT64, &v[ 0 ] );
+    attribute.close();
+    dspace.close();
+  }
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,83 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// time index kept with a time series dataset, as the attribute 'TimeIndex'
+//   the series is divided into fixed width buckets of time, starting at one second,
+//   the index holds the first row at or after the start of each bucket,
+//   so the rows holding a time are found without touching the dataset
+// the bucket width is doubled as the span of the series grows, keeping the attribute
+//   to at most 2048 buckets: a 16 hour day ends up with 32 second buckets
+// rows appended by writers which do not maintain the index are not covered,
+//   RowsCovered() tells how far the index reaches, searches beyond are left to the caller
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "HDF5DataManager.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+using boost::posix_time::ptime;
+
+class HDF5TimeIndex {
+public:
+
+  HDF5TimeIndex( void );
+  ~HDF5TimeIndex( void ) {};
+
+  void Clear( void );
+
+  bool Load( H5::DataSet& ); // false if there is no index
+  void Save( H5::DataSet& ) const;  // dataset needs to be read/write
+
+  hsize_t RowsCovered( void ) const { return m_nRows; };
+  bool Empty( void ) const { return 0 == m_nRows; };
+  ptime Min( void ) const; // first time indexed
+  ptime Max( void ) const; // last time indexed
+
+  // rows are added in order, and times need to be non decreasing, returns false, and clears, otherwise
+  bool Append( const ptime& dt ); // indexes row RowsCovered()
+  void Truncate( hsize_t nRows, const ptime& dtLast ); // keep rows [0,nRows), dtLast is the time of row nRows - 1
+
+  // lower bound of dt in the indexed rows lies in [ixLo, ixHi],
+  //   ixHi == RowsCovered() when dt is after Max() or within the last bucket
+  void Bracket( const ptime& dt, hsize_t& ixLo, hsize_t& ixHi ) const;
+
+protected:
+private:
+
+  static const boost::int64_t c_nVersion = 1;
+  static const boost::int64_t c_nMinWidth = 1;  // seconds
+  static const std::size_t c_nMaxBuckets = 2048;
+
+  boost::int64_t m_nWidth;  // seconds per bucket
+  boost::int64_t m_nOrigin; // bucket number, from the epoch, of the first bucket
+  boost::int64_t m_usMin, m_usMax;  // microseconds from the epoch
+  hsize_t m_nRows;
+  std::vector<hsize_t> m_vFirstRow; // one entry per bucket
+
+  static boost::int64_t Microseconds( const ptime& dt );
+  boost::int64_t Bucket( boost::int64_t us ) const; // bucket number, from the epoch
+  void Widen( void );  // double the width
+};
+
+} // namespace tf
+} // namespace ou
@@ -15,10 +15,14 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include <TFTimeSeries/DatedDatum.h>
 
 #include "HDF5DataManager.h"
+#include "HDF5TimeIndex.h"
+#include "HDF5Catalog.h"
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
@@ -29,22 +33,74 @@ namespace tf { // TradeFrame
 //  know about the container, and the container issues the iterator
 
 // class DD needs to be composed from the CDatedDatum class for access to ptime element
+// 2026/10/18 the memory type, the disk dataspace, and the single element memory dataspace are built 
+//   once per accessor rather than once per Read, single element reads are what lower_bound probes with
+//   single element reads also get a type conversion buffer sized to one element, the library otherwise
+//   allocates its default 1MB conversion buffer for every read, which was most of the cost of a probe
+// 2026/10/18 Fetch serves elements from a window of consecutive elements, aligned to the dataset's chunks,
+//   so a sequential scan makes one read per window, rather than one per element
+//   LowerBound bisects by window: each step reads one window, and once the target lies within the
+//   window in memory, the search finishes there, log2( n / window ) + 1 reads rather than log2( n )
+// 2026/10/18 Write maintains the dataset's time index (HDF5TimeIndex), LowerBound uses it to narrow
+//   the search to the rows of one bucket before touching the dataset, BuildTimeIndex indexes older datasets
+// 2026/10/18 Write keeps the dataset's row count and first and last times in the file's catalog (HDF5Catalog)
+// 2026/10/18 the index, and the catalog row, are kept up to date in memory as rows are written,
+//   and saved by Flush, which the destructor calls, so a writer appending many small batches saves them once,
+//   the first write of an accessor goes to the catalog straight away, so a new dataset is never left out of it
 template<class DD> class HDF5TimeSeriesAccessor {
 public:
-  explicit HDF5TimeSeriesAccessor<DD>( HDF5DataManager& dm, const std::string &sPathName );
+  explicit HDF5TimeSeriesAccessor<DD>( HDF5DataManager& dm, const std::string &sPathName, const HDF5ChunkCache& cache = HDF5ChunkCache() );
   virtual ~HDF5TimeSeriesAccessor<DD>( void );
   typedef hsize_t size_type;
   size_type size() const { return m_curElementCount; };
   void Read( hsize_t index, DD* );
   void Read( hsize_t ixStart, hsize_t count, H5::DataSpace *pMemoryDataSpace, DD* pDatedDatum );
   void Write( hsize_t ixStart, size_t count, const DD* );
+  // Fetch and LowerBound throw the H5::Exception of a window which could not be read
+  const DD& Fetch( hsize_t index ); // valid until the next Fetch, LowerBound, or Write
+  hsize_t LowerBound( hsize_t ixBegin, hsize_t ixEnd, const ptime& dt ); // first at or after dt, ixEnd if none
+  void SetWindowSize( hsize_t nWindow ); // defaults to the dataset's chunk size
+  hsize_t GetWindowSize( void ) const { return m_nWindow; };
+  const HDF5TimeIndex& TimeIndex( void ); // loaded on first use
+  void BuildTimeIndex( void ); // index a dataset written without one, dm needs to be read/write
+  void Flush( void ); // save the index and the catalog row, if writes changed them
+  struct counters_t {
+    size_type nReads;  // calls
+    size_type nElementsRead;
+    size_type nWrites;
+    size_type nElementsWritten;
+    counters_t( void ): nReads( 0 ), nElementsRead( 0 ), nWrites( 0 ), nElementsWritten( 0 ) {};
+  };
+  const counters_t& Counters( void ) const { return m_counters; };
 protected:
   std::string m_sPathName;
   H5::DataSet* m_pDiskDataSet;
   H5::CompType* m_pDiskCompType;
+  H5::CompType* m_pMemCompType;
+  H5::DataSpace* m_pDiskDataSpace;  // current extent, selections are made on this
+  H5::DataSpace* m_pSingleDataSpace; // one element, in memory
+  H5::DSetMemXferPropList* m_pSingleXfer; // one element conversion buffers
+  std::vector<unsigned char> m_vConvert;
+  std::vector<unsigned char> m_vBackground;
   size_type m_curElementCount, m_maxElementCount;
+  counters_t m_counters;
+  std::vector<DD> m_vWindow;
+  hsize_t m_nWindow;  // window size
+  hsize_t m_ixWindow; // index of first element in the window
+  hsize_t m_cntWindow; // elements loaded, 0 when invalid
+  H5::DSetMemXferPropList* m_pWindowXfer; // window sized conversion buffers, built on first use
+  std::vector<unsigned char> m_vWindowConvert;
+  std::vector<unsigned char> m_vWindowBackground;
+  HDF5TimeIndex m_index;
+  bool m_bIndexLoaded;
+  bool m_bIndexChanged; // since it was saved
+  bool m_bCatalogued; // the catalog row was written by this accessor
+  bool m_bCatalogChanged; // since it was written
   virtual void SetNewSize( size_type size ) {};
   void UpdateElementCount( void );
+  void LoadWindow( hsize_t index );
+  void UpdateTimeIndex( hsize_t ixStart, size_t count, const DD* );
+  void UpdateCatalog( void );
 private:
   HDF5DataManager& m_dm;
   HDF5TimeSeriesAccessor( const HDF5TimeSeriesAccessor& ); // copy constructor not implemented
@@ -52,29 +108,59 @@ private:
 };
 
 template<class DD> void HDF5TimeSeriesAccessor<DD>::UpdateElementCount( void ) {
-  H5::DataSpace *pDiskDataSpace;
-  pDiskDataSpace = new H5::DataSpace( m_pDiskDataSet->getSpace() );
-  pDiskDataSpace->getSimpleExtentDims( &m_curElementCount, &m_maxElementCount  );  //current, max
-  pDiskDataSpace->close();
-  delete pDiskDataSpace;
+  if ( NULL != m_pDiskDataSpace ) {
+    m_pDiskDataSpace->close();
+    delete m_pDiskDataSpace;
+  }
+  m_pDiskDataSpace = new H5::DataSpace( m_pDiskDataSet->getSpace() );
+  m_pDiskDataSpace->getSimpleExtentDims( &m_curElementCount, &m_maxElementCount  );  //current, max
+  m_cntWindow = 0;  // last window may have been partial
   SetNewSize( m_curElementCount );
 }
 
-template<class DD> HDF5TimeSeriesAccessor<DD>::HDF5TimeSeriesAccessor( HDF5DataManager& dm, const std::string &sPathName):
+template<class DD> HDF5TimeSeriesAccessor<DD>::HDF5TimeSeriesAccessor( HDF5DataManager& dm, const std::string &sPathName, const HDF5ChunkCache& cache ):
   m_dm( dm ),
-  m_sPathName( sPathName ) {
+  m_sPathName( sPathName ),
+  m_pDiskDataSet( NULL ), m_pDiskCompType( NULL ), m_pMemCompType( NULL ),
+  m_pDiskDataSpace( NULL ), m_pSingleDataSpace( NULL ), m_pSingleXfer( NULL ),
+  m_nWindow( 1024 ), m_ixWindow( 0 ), m_cntWindow( 0 ), m_pWindowXfer( NULL ),
+  m_bIndexLoaded( false ), m_bIndexChanged( false ), m_bCatalogued( false ), m_bCatalogChanged( false ) {
 
   try {
-    m_pDiskDataSet = new H5::DataSet( m_dm.GetH5File()->openDataSet( m_sPathName.c_str() ) );
+    H5::DSetAccPropList pl;
+    if ( !cache.IsDefault() ) {
+      pl.setChunkCache( cache.nSlots, cache.nBytes, cache.dblW0 );
+    }
+    m_pDiskDataSet = new H5::DataSet( m_dm.GetH5File()->openDataSet( m_sPathName.c_str(), pl ) );
+    pl.close();
     m_pDiskCompType = new H5::CompType( *m_pDiskDataSet );
 
-    H5::CompType *pMemCompType = DD::DefineDataType( NULL );
-    if ( ( pMemCompType->getNmembers() != m_pDiskCompType->getNmembers() ) ) { // can't do size as drive datatypes are packed, need instead to check member names
+    m_pMemCompType = DD::DefineDataType( NULL );
+    if ( ( m_pMemCompType->getNmembers() != m_pDiskCompType->getNmembers() ) ) { // can't do size as drive datatypes are packed, need instead to check member names
       //|| ( pMemCompType->getSize()     != m_pDiskCompType->getSize() ) ) { // works as Quote, Trade, Bar  have different member count (but MarketDepth has same count as Quote
+      m_pMemCompType->close();
+      delete m_pMemCompType;
+      m_pDiskCompType->close();
+      delete m_pDiskCompType;
+      m_pDiskDataSet->close();
+      delete m_pDiskDataSet;
       throw std::runtime_error( "HDF5TimeSeriesAccessor<DD>::HDF5TimeSeriesAccessor CompType doesn't match" );
     }
-    pMemCompType->close();
-    delete pMemCompType;
+
+    hsize_t dim = 1;
+    m_pSingleDataSpace = new H5::DataSpace( 1, &dim );
+    const size_t nBuffer( std::max<size_t>( m_pMemCompType->getSize(), m_pDiskCompType->getSize() ) );
+    m_vConvert.resize( nBuffer );
+    m_vBackground.resize( nBuffer );
+    m_pSingleXfer = new H5::DSetMemXferPropList;
+    m_pSingleXfer->setBuffer( nBuffer, &m_vConvert[0], &m_vBackground[0] );
+
+    H5::DSetCreatPropList plCreate( m_pDiskDataSet->getCreatePlist() );
+    if ( H5D_CHUNKED == plCreate.getLayout() ) {
+      hsize_t nChunk;
+      if ( 1 == plCreate.getChunk( 1, &nChunk ) ) m_nWindow = nChunk; // a window then costs one chunk
+    }
+    plCreate.close();
 
     UpdateElementCount();
   }
@@ -90,6 +176,19 @@ template<class DD> HDF5TimeSeriesAccessor<DD>::HDF5TimeSeriesAccessor( HDF5DataM
 }
 
 template<class DD> HDF5TimeSeriesAccessor<DD>::~HDF5TimeSeriesAccessor() {
+  Flush();
+  m_pDiskDataSpace->close();
+  delete m_pDiskDataSpace;
+  m_pSingleDataSpace->close();
+  delete m_pSingleDataSpace;
+  m_pSingleXfer->close();
+  delete m_pSingleXfer;
+  if ( NULL != m_pWindowXfer ) {
+    m_pWindowXfer->close();
+    delete m_pWindowXfer;
+  }
+  m_pMemCompType->close();
+  delete m_pMemCompType;
   m_pDiskCompType->close();
   delete m_pDiskCompType;
   //m_pDiskDataSet->flush( H5F_SCOPE_LOCAL );
@@ -101,27 +200,14 @@ template<class DD> void HDF5TimeSeriesAccessor<DD>::Read( hsize_t ixSource, DD*
   // store the retrieved value in pDatedDatum
   assert( ixSource < m_curElementCount );
   try {
-    hsize_t dim = 1;
     hsize_t coord1[] = { ixSource };  // index on disk
-    hsize_t coord2[] = { 0 };      // only one item in memory
     try {
-      H5::CompType *pComp = pDatedDatum->DefineDataType();
-
-      H5::DataSpace MemoryDataspace(1, &dim ); // create one element dataspace to get requested element of dataset
-      MemoryDataspace.selectElements( H5S_SELECT_SET, 1, coord2 );
-
-      H5::DataSpace *pDiskDataSpaceSelection = new H5::DataSpace( m_pDiskDataSet->getSpace() );
-      pDiskDataSpaceSelection->selectElements( H5S_SELECT_SET, 1, coord1 );
-
-      m_pDiskDataSet->read( pDatedDatum, *pComp, MemoryDataspace, *pDiskDataSpaceSelection );
+      m_pDiskDataSpace->selectElements( H5S_SELECT_SET, 1, coord1 );
 
-      pDiskDataSpaceSelection->close();
-      delete pDiskDataSpaceSelection;
-
-      MemoryDataspace.close();
-
-      pComp->close();
-      delete pComp;
+      m_pDiskDataSet->read( pDatedDatum, *m_pMemCompType, *m_pSingleDataSpace, *m_pDiskDataSpace, *m_pSingleXfer );
+      DatumStorage<DD>::AfterRead( pDatedDatum, 1 );
+      ++m_counters.nReads;
+      ++m_counters.nElementsRead;
 
       //cout << "read from index " << ixSource << endl;
     }
@@ -139,24 +225,18 @@ template <class DD> void HDF5TimeSeriesAccessor<DD>::Read( hsize_t ixStart, hsiz
   try {
     hsize_t dim[] = { count };
     try {
-      H5::DataSpace *pDiskDataSpaceSelection = new H5::DataSpace( m_pDiskDataSet->getSpace() );
-      pDiskDataSpaceSelection->selectHyperslab( H5S_SELECT_SET, &dim[0], &ixStart, 0, 0 );
+      m_pDiskDataSpace->selectHyperslab( H5S_SELECT_SET, &dim[0], &ixStart, 0, 0 );
 
       H5::DSetMemXferPropList pl;
       bool b = pl.getPreserve();
       pl.setPreserve( true );
 
-      H5::CompType *pComp = pDatedDatum->DefineDataType();
-
-      m_pDiskDataSet->read( pDatedDatum, *pComp, *pMemoryDataSpace, *pDiskDataSpaceSelection, pl );
-
-      pComp->close();
-      delete pComp;
+      m_pDiskDataSet->read( pDatedDatum, *m_pMemCompType, *pMemoryDataSpace, *m_pDiskDataSpace, pl );
+      DatumStorage<DD>::AfterRead( pDatedDatum, count );
+      ++m_counters.nReads;
+      m_counters.nElementsRead += count;
 
       pl.close();
-
-      pDiskDataSpaceSelection->close();
-      delete pDiskDataSpaceSelection;
     }
     catch ( H5::Exception e ) {
       std::cout << "HDF5TimeSeriesAccessor<DD>::Read H5::Exception " << e.getDetailMsg() << std::endl;
@@ -174,8 +254,6 @@ template<class DD> void HDF5TimeSeriesAccessor<DD>::Write( hsize_t ixStart, size
     hsize_t oldElementCount = m_curElementCount;  // keep for later comparison
     hsize_t dim[] = { count };
     try {
-      H5::CompType *pComp = pDatedDatum->DefineDataType();
-
       H5::DataSpace MemoryDataspace(1, dim ); // rank, dimensions
       MemoryDataspace.selectAll();
 
@@ -185,18 +263,25 @@ template<class DD> void HDF5TimeSeriesAccessor<DD>::Write( hsize_t ixStart, size
         UpdateElementCount();
       }
 
-      H5::DataSpace *pDiskDataSpaceSelection = new H5::DataSpace( m_pDiskDataSet->getSpace() );
-      pDiskDataSpaceSelection->selectHyperslab( H5S_SELECT_SET, &dim[0], &ixStart, 0, 0 );
+      m_pDiskDataSpace->selectHyperslab( H5S_SELECT_SET, &dim[0], &ixStart, 0, 0 );
 
-      m_pDiskDataSet->write( pDatedDatum, *pComp, MemoryDataspace, *pDiskDataSpaceSelection );
-
-      pDiskDataSpaceSelection->close();
-      delete pDiskDataSpaceSelection;
+      if ( DatumStorage<DD>::bConvert ) { // disk image differs from memory image, convert a copy
+        std::vector<DD> vConverted( pDatedDatum, pDatedDatum + count );
+        DatumStorage<DD>::BeforeWrite( &vConverted[0], count );
+        m_pDiskDataSet->write( &vConverted[0], *m_pMemCompType, MemoryDataspace, *m_pDiskDataSpace );
+      }
+      else {
+        m_pDiskDataSet->write( pDatedDatum, *m_pMemCompType, MemoryDataspace, *m_pDiskDataSpace );
+      }
+      ++m_counters.nWrites;
+      m_counters.nElementsWritten += count;
+      m_cntWindow = 0;
 
       MemoryDataspace.close();
 
-      pComp->close();
-      delete pComp;
+      UpdateTimeIndex( ixStart, count, pDatedDatum );
+      if ( m_bCatalogued ) m_bCatalogChanged = true;
+      else UpdateCatalog();
 
       if ( m_curElementCount == oldElementCount ) {
         //cout << "Dataset did not expand" << endl;
@@ -204,6 +289,7 @@ template<class DD> void HDF5TimeSeriesAccessor<DD>::Write( hsize_t ixStart, size
       //cout << "Wrote " << count << ", total " << m_curElementCount << endl;
     }
     catch ( H5::Exception e ) {
+      m_cntWindow = 0;
       std::cout << "HDF5TimeSeriesAccessor<DD>::Write H5::Exception " << e.getDetailMsg() << std::endl;
       e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
     }
@@ -213,5 +299,172 @@ template<class DD> void HDF5TimeSeriesAccessor<DD>::Write( hsize_t ixStart, size
   }
 }
 
+template<class DD> const HDF5TimeIndex& HDF5TimeSeriesAccessor<DD>::TimeIndex( void ) {
+  if ( !m_bIndexLoaded ) {
+    m_bIndexLoaded = true;
+    try {
+      m_index.Load( *m_pDiskDataSet );
+    }
+    catch ( H5::Exception e ) {
+      m_index.Clear();
+    }
+    if ( m_index.RowsCovered() > m_curElementCount ) { // not for this dataset
+      m_index.Clear();
+    }
+  }
+  return m_index;
+}
+
+template<class DD> void HDF5TimeSeriesAccessor<DD>::UpdateTimeIndex( hsize_t ixStart, size_t count, const DD* pDatedDatum ) {
+  // called once the elements are on disk
+  TimeIndex();
+  if ( ixStart < m_index.RowsCovered() ) { // over writing indexed rows
+    if ( 0 == ixStart ) m_index.Clear();
+    else m_index.Truncate( ixStart, Fetch( ixStart - 1 ).DateTime() );
+  }
+  if ( ixStart == m_index.RowsCovered() ) {
+    for ( size_t ix = 0; ix < count; ++ix ) {
+      if ( !m_index.Append( pDatedDatum[ ix ].DateTime() ) ) break;  // out of order, no index
+    }
+    m_bIndexChanged = true;
+  }
+  // otherwise rows follow which the index never covered, it stays as it is
+}
+
+template<class DD> void HDF5TimeSeriesAccessor<DD>::Flush( void ) {
+  try {
+    if ( m_bIndexChanged ) {
+      m_bIndexChanged = false;
+      m_index.Save( *m_pDiskDataSet );
+    }
+    if ( m_bCatalogChanged ) UpdateCatalog();
+  }
+  catch ( H5::Exception e ) {
+    std::cout << "HDF5TimeSeriesAccessor<DD>::Flush H5::Exception " << e.getDetailMsg() << std::endl;
+    e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
+  }
+}
+
+template<class DD> void HDF5TimeSeriesAccessor<DD>::UpdateCatalog( void ) {
+  // called once the elements are on disk, and the index is up to date
+  ptime dtFirst, dtLast;
+  if ( 0 < m_curElementCount ) {
+    if ( m_curElementCount == m_index.RowsCovered() ) {
+      dtFirst = m_index.Min();
+      dtLast = m_index.Max();
+    }
+    else {
+      dtFirst = Fetch( 0 ).DateTime();
+      dtLast = Fetch( m_curElementCount - 1 ).DateTime();
+    }
+  }
+  HDF5Catalog::UpdateRows( m_dm, m_sPathName, m_curElementCount, dtFirst, dtLast );
+  m_bCatalogued = true;
+  m_bCatalogChanged = false;
+}
+
+template<class DD> void HDF5TimeSeriesAccessor<DD>::BuildTimeIndex( void ) {
+  try {
+    m_index.Clear();
+    for ( hsize_t ix = 0; ix < m_curElementCount; ++ix ) {
+      if ( !m_index.Append( Fetch( ix ).DateTime() ) ) break;
+    }
+    m_index.Save( *m_pDiskDataSet );
+    m_bIndexLoaded = true;
+    m_bIndexChanged = false;
+  }
+  catch ( H5::Exception e ) {
+    std::cout << "HDF5TimeSeriesAccessor<DD>::BuildTimeIndex H5::Exception " << e.getDetailMsg() << std::endl;
+    e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
+  }
+}
+
+template<class DD> void HDF5TimeSeriesAccessor<DD>::SetWindowSize( hsize_t nWindow ) {
+  assert( 0 < nWindow );
+  m_nWindow = nWindow;
+  m_cntWindow = 0;
+  std::vector<DD>().swap( m_vWindow );
+  if ( NULL != m_pWindowXfer ) {
+    m_pWindowXfer->close();
+    delete m_pWindowXfer;
+    m_pWindowXfer = NULL;
+  }
+}
+
+template<class DD> void HDF5TimeSeriesAccessor<DD>::LoadWindow( hsize_t index ) {
+  assert( index < m_curElementCount );
+  m_ixWindow = index - ( index % m_nWindow );
+  hsize_t cnt = std::min<hsize_t>( m_nWindow, m_curElementCount - m_ixWindow );
+  if ( m_vWindow.size() < cnt ) m_vWindow.resize( m_nWindow );
+  if ( NULL == m_pWindowXfer ) {
+    const size_t nBuffer( m_nWindow * m_vConvert.size() );
+    m_vWindowConvert.resize( nBuffer );
+    m_vWindowBackground.resize( nBuffer );
+    m_pWindowXfer = new H5::DSetMemXferPropList;
+    m_pWindowXfer->setBuffer( nBuffer, &m_vWindowConvert[0], &m_vWindowBackground[0] );
+  }
+  m_cntWindow = 0;
+  try {
+    H5::DataSpace dsMemory( 1, &cnt );
+    m_pDiskDataSpace->selectHyperslab( H5S_SELECT_SET, &cnt, &m_ixWindow, 0, 0 );
+    m_pDiskDataSet->read( &m_vWindow[0], *m_pMemCompType, dsMemory, *m_pDiskDataSpace, *m_pWindowXfer );
+    DatumStorage<DD>::AfterRead( &m_vWindow[0], cnt );
+    ++m_counters.nReads;
+    m_counters.nElementsRead += cnt;
+    dsMemory.close();
+    m_cntWindow = cnt;
+  }
+  catch ( H5::Exception e ) {
+    std::cout << "HDF5TimeSeriesAccessor<DD>::LoadWindow H5::Exception " << e.getDetailMsg() << std::endl;
+    e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
+    throw;  // 2026/10/18 the window is left empty, Fetch and LowerBound have nothing to return
+  }
+}
+
+template<class DD> const DD& HDF5TimeSeriesAccessor<DD>::Fetch( hsize_t index ) {
+  if ( ( index < m_ixWindow ) || ( index >= ( m_ixWindow + m_cntWindow ) ) ) {
+    LoadWindow( index );
+  }
+  return m_vWindow[ index - m_ixWindow ];
+}
+
+template<class DD> hsize_t HDF5TimeSeriesAccessor<DD>::LowerBound( hsize_t ixBegin, hsize_t ixEnd, const ptime& dt ) {
+  assert( ixBegin <= ixEnd );
+  assert( ixEnd <= m_curElementCount );
+  if ( ( ixBegin < ixEnd ) && !TimeIndex().Empty() ) {
+    hsize_t ixLo, ixHi;
+    m_index.Bracket( dt, ixLo, ixHi );
+    if ( m_index.RowsCovered() == ixHi ) ixHi = m_curElementCount; // any rows not indexed follow
+    if ( ixEnd <= ixLo ) return ixEnd;
+    if ( ixBegin >= ixHi ) return ixBegin;
+    ixBegin = std::max<hsize_t>( ixBegin, ixLo );
+    ixEnd = std::min<hsize_t>( ixEnd, ixHi );
+  }
+  while ( ixBegin < ixEnd ) {
+    Fetch( ixBegin + ( ixEnd - ixBegin ) / 2 ); // the window holding the midpoint
+    const hsize_t ixLo = std::max<hsize_t>( ixBegin, m_ixWindow );
+    const hsize_t ixHi = std::min<hsize_t>( ixEnd, m_ixWindow + m_cntWindow );
+    if ( !( m_vWindow[ ixLo - m_ixWindow ].DateTime() < dt ) ) {
+      ixEnd = ixLo; // at or before the start of what is in the window
+    }
+    else {
+      if ( m_vWindow[ ixHi - 1 - m_ixWindow ].DateTime() < dt ) {
+        ixBegin = ixHi; // after the end of what is in the window
+      }
+      else { // within the window, ixLo is before dt, ixHi - 1 is at or after dt
+        hsize_t lo = ixLo + 1;
+        hsize_t hi = ixHi - 1;
+        while ( lo < hi ) {
+          const hsize_t mid = lo + ( hi - lo ) / 2;
+          if ( m_vWindow[ mid - m_ixWindow ].DateTime() < dt ) lo = mid + 1;
+          else hi = mid;
+        }
+        return lo;
+      }
+    }
+  }
+  return ixBegin;
+}
+
 } // namespace tf
 } // namespace ou
@@ -0,0 +1,168 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <boost/bind.hpp>
+#include <boost/thread/thread_time.hpp>
+
+#include "HDF5TimeSeriesAppender.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+HDF5AppenderBase::HDF5AppenderBase( HDF5AppendWriter& writer )
+: m_writer( writer ), m_bQueued( false )
+{
+  m_writer.Register( this );
+}
+
+HDF5AppenderBase::~HDF5AppenderBase( void ) {
+}
+
+void HDF5AppenderBase::Queue( void ) {
+  m_writer.Queue( this );
+}
+
+void HDF5AppenderBase::Unregister( void ) {
+  m_writer.Unregister( this );
+}
+
+void HDF5AppenderBase::Flush( void ) {
+  boost::lock_guard<boost::mutex> guard( m_writer.MutexHDF5() );
+  Write( true );
+  m_writer.FlushFile();
+}
+
+//
+// =================
+//
+
+HDF5AppendWriter::HDF5AppendWriter( unsigned int nFlushSeconds )
+: m_dm( HDF5DataManager::RDWR ), m_nFlushSeconds( nFlushSeconds ), m_pInProgress( 0 ), m_bStop( false )
+{
+  assert( 0 < nFlushSeconds );
+  m_thread = boost::thread( boost::bind( &HDF5AppendWriter::Process, this ) );
+}
+
+HDF5AppendWriter::~HDF5AppendWriter( void ) {
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutex );
+    assert( m_vAppender.empty() );
+    m_bStop = true;
+  }
+  m_cvRequest.notify_one();
+  m_thread.join();
+}
+
+void HDF5AppendWriter::Register( HDF5AppenderBase* pAppender ) {
+  boost::lock_guard<boost::mutex> guard( m_mutex );
+  m_vAppender.push_back( pAppender );
+}
+
+void HDF5AppendWriter::Unregister( HDF5AppenderBase* pAppender ) {
+  boost::unique_lock<boost::mutex> lock( m_mutex );
+  std::vector<HDF5AppenderBase*>::iterator iterAppender = std::find( m_vAppender.begin(), m_vAppender.end(), pAppender );
+  assert( m_vAppender.end() != iterAppender );
+  m_vAppender.erase( iterAppender );
+  if ( pAppender->m_bQueued ) {
+    std::deque<HDF5AppenderBase*>::iterator iter = std::find( m_dequeRequest.begin(), m_dequeRequest.end(), pAppender );
+    if ( m_dequeRequest.end() != iter ) {
+      m_dequeRequest.erase( iter );
+    }
+    pAppender->m_bQueued = false;
+  }
+  while ( m_pInProgress == pAppender ) {
+    m_cvComplete.wait( lock );
+  }
+}
+
+void HDF5AppendWriter::Queue( HDF5AppenderBase* pAppender ) {
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutex );
+    if ( pAppender->m_bQueued ) return; // the write will take the new batch as well
+    pAppender->m_bQueued = true;
+    m_dequeRequest.push_back( pAppender );
+  }
+  m_cvRequest.notify_one();
+}
+
+void HDF5AppendWriter::FlushFile( void ) {
+  try {
+    m_dm.GetH5File()->flush( H5F_SCOPE_GLOBAL );
+  }
+  catch ( H5::Exception e ) {
+    std::cout << "HDF5AppendWriter::FlushFile " << e.getDetailMsg() << std::endl;
+  }
+}
+
+void HDF5AppendWriter::Flush( void ) {
+  // the hdf5 lock is taken first: an appender unregistering meanwhile waits on it before it is destroyed
+  boost::lock_guard<boost::mutex> guardHDF5( m_mutexHDF5 );
+  std::vector<HDF5AppenderBase*> vAppender;
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutex );
+    vAppender = m_vAppender;
+  }
+  for ( std::vector<HDF5AppenderBase*>::iterator iter = vAppender.begin(); vAppender.end() != iter; ++iter ) {
+    ( *iter )->Write( true );
+  }
+  FlushFile();
+}
+
+void HDF5AppendWriter::Process( void ) {
+  boost::system_time dtFlush = boost::get_system_time() + boost::posix_time::seconds( m_nFlushSeconds );
+  while ( true ) {
+    HDF5AppenderBase* pAppender( 0 );
+    bool bTimer( false );
+    {
+      boost::unique_lock<boost::mutex> lock( m_mutex );
+      while ( m_dequeRequest.empty() && !m_bStop ) {
+        if ( !m_cvRequest.timed_wait( lock, dtFlush ) ) break;
+      }
+      bTimer = ( dtFlush <= boost::get_system_time() ); // checked even when busy, so quiet series get written
+      if ( !bTimer ) {
+        if ( m_dequeRequest.empty() ) break;  // stopping
+        pAppender = m_dequeRequest.front();
+        m_dequeRequest.pop_front();
+        pAppender->m_bQueued = false;
+        m_pInProgress = pAppender;
+      }
+    }
+    if ( bTimer ) {
+      Flush();
+      dtFlush = boost::get_system_time() + boost::posix_time::seconds( m_nFlushSeconds );
+    }
+    else {
+      bool bIdle;
+      {
+        boost::lock_guard<boost::mutex> guard( m_mutexHDF5 );
+        pAppender->Write( false );
+        {
+          boost::lock_guard<boost::mutex> guard( m_mutex );
+          bIdle = m_dequeRequest.empty();
+        }
+        if ( bIdle ) FlushFile();  // at the end of each round
+      }
+      {
+        boost::lock_guard<boost::mutex> guard( m_mutex );
+        m_pInProgress = 0;
+      }
+      m_cvComplete.notify_all();
+    }
+  }
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,260 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// writes datums to disk as they arrive, rather than holding a whole session for HDF5WriteTimeSeries:
+//   HDF5TimeSeriesAppender::Append is called from the feed thread, datums are gathered into batches of
+//     the dataset's chunk size, a full batch is handed to the writer, which appends it to the dataset
+//   HDF5AppendWriter runs one background thread for all its appenders, it also writes partial batches
+//     on a timer, and flushes the file after each round of writes,
+//     so a crash loses at most the datums gathered since the last round
+//   every hdf5 call made on behalf of the appenders is serialized through the writer
+//   the dataset's time index, and its catalog row, are saved with the partial batches, on the timer, and on Flush
+//   batches which fail to write are kept, and tried again with the next write, up to a limit,
+//     beyond which the oldest are dropped, and counted
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include <boost/noncopyable.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <OUCommon/FastDelegate.h>
+using namespace fastdelegate;
+
+#include "HDF5DataManager.h"
+#include "HDF5WriteTimeSeries.h"
+#include "HDF5TimeSeriesContainer.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class HDF5AppendWriter;
+
+class HDF5AppenderBase {
+  friend class HDF5AppendWriter;
+public:
+  HDF5AppenderBase( HDF5AppendWriter& writer );
+  virtual ~HDF5AppenderBase( void );
+protected:
+  HDF5AppendWriter& m_writer;
+  void Queue( void ); // a batch is ready
+  void Flush( void ); // write everything gathered so far, returns once it is on disk
+  void Unregister( void ); // called first in the destructor of the derived class
+  virtual void Write( bool bPartial ) = 0; // hdf5 lock is held by caller, partial batches written when bPartial
+private:
+  bool m_bQueued;  // guarded by the writer
+};
+
+class HDF5AppendWriter: boost::noncopyable {
+  friend class HDF5AppenderBase;
+public:
+
+  HDF5AppendWriter( unsigned int nFlushSeconds = 5 );
+  ~HDF5AppendWriter( void ); // appenders need to be destroyed first
+
+  HDF5DataManager& DataManager( void ) { return m_dm; };
+  boost::mutex& MutexHDF5( void ) { return m_mutexHDF5; };
+
+  void Flush( void ); // write what every appender has gathered, returns once it is on disk
+
+protected:
+private:
+
+  HDF5DataManager m_dm;
+
+  const unsigned int m_nFlushSeconds;
+
+  boost::mutex m_mutexHDF5;
+
+  boost::mutex m_mutex;
+  boost::condition_variable m_cvRequest;
+  boost::condition_variable m_cvComplete;
+  std::vector<HDF5AppenderBase*> m_vAppender;
+  std::deque<HDF5AppenderBase*> m_dequeRequest;
+  HDF5AppenderBase* m_pInProgress;
+  bool m_bStop;
+
+  boost::thread m_thread;
+
+  void Register( HDF5AppenderBase* );
+  void Unregister( HDF5AppenderBase* );
+  void Queue( HDF5AppenderBase* );
+  void FlushFile( void ); // hdf5 lock is held by caller
+
+  void Process( void );
+};
+
+//
+// =================
+//
+
+template<class DD>
+class HDF5TimeSeriesAppender: public HDF5AppenderBase {
+public:
+
+  typedef hsize_t size_type;
+  typedef FastDelegate2<HDF5DataManager&, const std::string&> OnCreated_t; // set attributes here, on the writer thread
+
+  // dataset is created, if needed, with the first write, shuffled and deflated, in chunks of nBatch
+  HDF5TimeSeriesAppender( HDF5AppendWriter& writer, const std::string& sPathName,
+    size_type nBatch = 256, int nDeflate = 5, OnCreated_t OnCreated = 0 );
+  virtual ~HDF5TimeSeriesAppender( void ); // writes what remains
+
+  const std::string& PathName( void ) const { return m_sPathName; };
+
+  void Append( const DD& datum ); // datums need to be in time order
+  void Flush( void ) { HDF5AppenderBase::Flush(); };
+
+  size_type Written( void ) const { return m_nWritten; }; // as of the last write
+  size_type Dropped( void ) const { return m_nDropped; }; // datums given up on after failed writes
+
+protected:
+  void Write( bool bPartial );
+private:
+
+  typedef std::vector<DD> vBatch_t;
+
+  static const std::size_t c_nRetained = 16; // failed batches kept for the next write
+
+  const std::string m_sPathName;
+  const size_type m_nBatch;
+  const int m_nDeflate;
+  OnCreated_t OnCreated;
+
+  boost::mutex m_mutex;
+  vBatch_t m_vFilling;
+  std::deque<vBatch_t> m_dequeFull;
+  std::vector<vBatch_t> m_vSpare; // written batches, reused
+
+  HDF5TimeSeriesContainer<DD>* m_pContainer; // writer thread
+  size_type m_nWritten;
+  size_type m_nDropped;
+};
+
+template<class DD>
+HDF5TimeSeriesAppender<DD>::HDF5TimeSeriesAppender(
+  HDF5AppendWriter& writer, const std::string& sPathName, size_type nBatch, int nDeflate, OnCreated_t OnCreated_ )
+: HDF5AppenderBase( writer ), m_sPathName( sPathName ), m_nBatch( nBatch ), m_nDeflate( nDeflate ), OnCreated( OnCreated_ ),
+  m_pContainer( 0 ), m_nWritten( 0 ), m_nDropped( 0 )
+{
+  assert( 0 < nBatch );
+  m_vFilling.reserve( m_nBatch );
+}
+
+template<class DD>
+HDF5TimeSeriesAppender<DD>::~HDF5TimeSeriesAppender( void ) {
+  Unregister();
+  HDF5AppenderBase::Flush();
+  boost::lock_guard<boost::mutex> guard( m_writer.MutexHDF5() );
+  delete m_pContainer;
+}
+
+template<class DD>
+void HDF5TimeSeriesAppender<DD>::Append( const DD& datum ) {
+  bool bFull( false );
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutex );
+    m_vFilling.push_back( datum );
+    if ( m_nBatch <= m_vFilling.size() ) {
+      m_dequeFull.push_back( vBatch_t() );
+      m_dequeFull.back().swap( m_vFilling );
+      if ( m_vSpare.empty() ) {
+        m_vFilling.reserve( m_nBatch );
+      }
+      else {
+        m_vFilling.swap( m_vSpare.back() );
+        m_vSpare.pop_back();
+      }
+      bFull = true;
+    }
+  }
+  if ( bFull ) Queue();
+}
+
+template<class DD>
+void HDF5TimeSeriesAppender<DD>::Write( bool bPartial ) {
+
+  std::deque<vBatch_t> dequeWrite;
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutex );
+    dequeWrite.swap( m_dequeFull );
+    if ( bPartial && !m_vFilling.empty() ) {
+      dequeWrite.push_back( vBatch_t() );
+      dequeWrite.back().swap( m_vFilling );
+      m_vFilling.reserve( m_nBatch );
+    }
+  }
+
+  if ( dequeWrite.empty() ) return;
+
+  typename std::deque<vBatch_t>::iterator iterFailed = dequeWrite.begin(); // first batch not written
+  try {
+    if ( 0 == m_pContainer ) {
+      HDF5WriteTimeSeries<TimeSeries<DD> > wts( m_writer.DataManager(), true, true, m_nDeflate, m_nBatch );
+      bool bCreated = wts.CreateDataSet( m_sPathName );
+      m_pContainer = new HDF5TimeSeriesContainer<DD>( m_writer.DataManager(), m_sPathName );
+      if ( bCreated && ( 0 != OnCreated ) ) OnCreated( m_writer.DataManager(), m_sPathName );
+    }
+    for ( ; dequeWrite.end() != iterFailed; ++iterFailed ) {
+      const DD* p = &( *iterFailed )[ 0 ];
+      m_pContainer->Append( p, p + iterFailed->size() );
+      m_nWritten += iterFailed->size();
+    }
+    if ( bPartial ) m_pContainer->Flush();
+  }
+  catch ( std::runtime_error& e ) {
+    std::cout << "HDF5TimeSeriesAppender<DD>::Write " << m_sPathName << ": " << e.what() << std::endl;
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "HDF5TimeSeriesAppender<DD>::Write " << m_sPathName << ": " << e.getDetailMsg() << std::endl;
+  }
+
+  boost::lock_guard<boost::mutex> guard( m_mutex );
+  if ( dequeWrite.end() != iterFailed ) { // retained ahead of what arrived meanwhile, to keep time order
+    std::deque<vBatch_t> dequeRetained;
+    for ( typename std::deque<vBatch_t>::iterator iter = iterFailed; dequeWrite.end() != iter; ++iter ) {
+      dequeRetained.push_back( vBatch_t() );
+      dequeRetained.back().swap( *iter );
+    }
+    for ( typename std::deque<vBatch_t>::iterator iter = m_dequeFull.begin(); m_dequeFull.end() != iter; ++iter ) {
+      dequeRetained.push_back( vBatch_t() );
+      dequeRetained.back().swap( *iter );
+    }
+    while ( c_nRetained < dequeRetained.size() ) {
+      m_nDropped += dequeRetained.front().size();
+      dequeRetained.pop_front();
+    }
+    m_dequeFull.swap( dequeRetained );
+    dequeWrite.erase( iterFailed, dequeWrite.end() );
+  }
+  for ( typename std::deque<vBatch_t>::iterator iter = dequeWrite.begin(); dequeWrite.end() != iter; ++iter ) {
+    if ( m_vSpare.size() < 2 ) {
+      iter->clear();
+      m_vSpare.push_back( vBatch_t() );
+      m_vSpare.back().swap( *iter );
+    }
+  }
+}
+
+} // namespace tf
+} // namespace ou
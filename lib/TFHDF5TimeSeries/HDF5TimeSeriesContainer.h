@@ -31,24 +31,26 @@ namespace tf { // TradeFrame
 // DD is expecting type derived from DatedDatum
 template<class DD> class HDF5TimeSeriesContainer: public HDF5TimeSeriesAccessor<DD> {
 public:
-  HDF5TimeSeriesContainer<DD>( HDF5DataManager& dm, const std::string& sPathName );
+  HDF5TimeSeriesContainer<DD>( HDF5DataManager& dm, const std::string& sPathName, const HDF5ChunkCache& cache = HDF5ChunkCache() );
   virtual ~HDF5TimeSeriesContainer<DD>( void );
   //typedef HDF5TimeSeriesIterator<T> const_iterator;
   typedef HDF5TimeSeriesIterator<DD> iterator;
   typedef typename HDF5TimeSeriesAccessor<DD>::size_type size_type;
   iterator begin();
   const iterator &end();
+  iterator LowerBound( const iterator& _begin, const iterator& _end, const ptime& dt ); // fewer reads than std::lower_bound
   //void Read( const iterator &_begin, const iterator &_end, T* _dest ); 
   void Read( iterator &_begin, iterator &_end, typename ou::tf::TimeSeries<DD>* _dest ); 
   void Write( const DD* _begin, const DD* _end );
+  void Append( const DD* _begin, const DD* _end ); // after the last element, equal times are kept, not over written
 protected:
   iterator* m_end;
   virtual void SetNewSize( size_type newsize );
 private:
 };
 
-template<class DD> HDF5TimeSeriesContainer<DD>::HDF5TimeSeriesContainer( HDF5DataManager& dm, const std::string& sPathName ):
-  HDF5TimeSeriesAccessor<DD>( dm, sPathName ) {
+template<class DD> HDF5TimeSeriesContainer<DD>::HDF5TimeSeriesContainer( HDF5DataManager& dm, const std::string& sPathName, const HDF5ChunkCache& cache ):
+  HDF5TimeSeriesAccessor<DD>( dm, sPathName, cache ) {
     m_end = new iterator( this, this->size() );
 }
 
@@ -70,6 +72,12 @@ template<class DD> const typename HDF5TimeSeriesContainer<DD>::iterator &HDF5Tim
   return* m_end;
 }
 
+template<class DD> typename HDF5TimeSeriesContainer<DD>::iterator HDF5TimeSeriesContainer<DD>::LowerBound( 
+  const iterator& _begin, const iterator& _end, const ptime& dt ) {
+  iterator result( this, HDF5TimeSeriesAccessor<DD>::LowerBound( _begin.m_ItemIndex, _end.m_ItemIndex, dt ) );
+  return result;
+}
+
 template<class DD> void HDF5TimeSeriesContainer<DD>::SetNewSize( size_type newsize ) {
   delete m_end;
   m_end = new iterator( this, newsize );
@@ -88,10 +96,16 @@ template<class DD> void HDF5TimeSeriesContainer<DD>::Read( iterator& _begin, ite
 template<class DD> void HDF5TimeSeriesContainer<DD>::Write( const DD* _begin, const DD* _end ) {
   size_t cnt = _end - _begin;
   if ( cnt > 0 ) {
-    std::pair<HDF5TimeSeriesContainer<DD>::iterator, HDF5TimeSeriesContainer<DD>::iterator> p;
-    p = equal_range( begin(), end(), *_begin );
-    // whether we found something or not, p.first is insertion point
-    HDF5TimeSeriesAccessor<DD>::Write( p.first.m_ItemIndex, cnt, _begin );
+    // whether we found something or not, the lower bound is the insertion point
+    hsize_t ix = HDF5TimeSeriesAccessor<DD>::LowerBound( 0, this->size(), _begin->DateTime() );
+    HDF5TimeSeriesAccessor<DD>::Write( ix, cnt, _begin );
+  }
+}
+
+template<class DD> void HDF5TimeSeriesContainer<DD>::Append( const DD* _begin, const DD* _end ) {
+  size_t cnt = _end - _begin;
+  if ( cnt > 0 ) {
+    HDF5TimeSeriesAccessor<DD>::Write( this->size(), cnt, _begin );
   }
 }
 
@@ -47,6 +47,8 @@ public:
   HDF5TimeSeriesIterator<DD>& operator=( const HDF5TimeSeriesIterator<DD>& other );
   HDF5TimeSeriesIterator<DD>& operator++(); // pre-increment
   HDF5TimeSeriesIterator<DD>  operator++( int ); // post-increment
+  HDF5TimeSeriesIterator<DD>& operator--(); // pre-decrement, random access iterators need these too
+  HDF5TimeSeriesIterator<DD>  operator--( int ); // post-decrement
   HDF5TimeSeriesIterator<DD>& operator+=( const hsize_t inc );
   HDF5TimeSeriesIterator<DD>& operator-=( const hsize_t inc );
   HDF5TimeSeriesIterator<DD>  operator-( const hsize_t val );
@@ -135,6 +137,23 @@ HDF5TimeSeriesIterator<DD> HDF5TimeSeriesIterator<DD>::operator++( int ) { // po
   return( result ); 
 }
 
+template<class DD> 
+HDF5TimeSeriesIterator<DD>& HDF5TimeSeriesIterator<DD>::operator--() { // pre-decrement
+  assert( m_bValidIndex );
+  assert( 0 < m_ItemIndex );
+  --m_ItemIndex;
+  return( *this );
+}
+
+template<class DD> 
+HDF5TimeSeriesIterator<DD> HDF5TimeSeriesIterator<DD>::operator--( int ) { // post-decrement
+  HDF5TimeSeriesIterator<DD> result( *this );
+  assert( m_bValidIndex );
+  assert( 0 < m_ItemIndex );
+  --m_ItemIndex;
+  return( result );
+}
+
 template<class DD> 
 HDF5TimeSeriesIterator<DD>& HDF5TimeSeriesIterator<DD>::operator+=( const hsize_t inc ) { // plus assignment
   assert( m_bValidIndex );
@@ -192,7 +211,7 @@ template<class DD>
 typename HDF5TimeSeriesIterator<DD>::base_iterator::reference HDF5TimeSeriesIterator<DD>::operator*() {
   assert( m_bValidIndex );
   assert( m_ItemIndex < m_pAccessor->size() );
-  m_pAccessor->Read( m_ItemIndex, &m_DD );
+  m_DD = m_pAccessor->Fetch( m_ItemIndex );  // from the accessor's window, read a window at a time
   return m_DD;
 }
 
@@ -0,0 +1,62 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// TimeSeriesStore over a dataset in the hdf5 file, the counterpart of FlatFileTimeSeries
+//   DD is a pod datum, converted from the hdf5 image as it is read (DatumStorage<>)
+//   not Shared(): the accessor keeps a window and buffers, one instance per thread
+
+#include <TFTimeSeries/TimeSeriesStore.h>
+
+#include "HDF5DataManager.h"
+#include "HDF5TimeSeriesAccessor.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+template<class DD>
+class HDF5TimeSeriesStore: public TimeSeriesStore<DD> {
+public:
+
+  typedef typename TimeSeriesStore<DD>::size_type size_type;
+
+  HDF5TimeSeriesStore( HDF5DataManager& dm, const std::string& sPathName, const HDF5ChunkCache& cache = HDF5ChunkCache() )
+    : m_accessor( dm, sPathName, cache ) {};
+  virtual ~HDF5TimeSeriesStore( void ) {};
+
+  HDF5TimeSeriesAccessor<DD>& Accessor( void ) { return m_accessor; };
+
+  size_type Size( void ) { return m_accessor.size(); };
+  bool Shared( void ) const { return false; };
+  void Read( size_type ixStart, size_type count, DD* p ) {
+    if ( 0 < count ) {
+      hsize_t dim = count;
+      H5::DataSpace dsMemory( 1, &dim );
+      m_accessor.Read( ixStart, count, &dsMemory, p );
+      dsMemory.close();
+    }
+  }
+  size_type LowerBound( const boost::posix_time::ptime& dt ) { return m_accessor.LowerBound( 0, m_accessor.size(), dt ); };
+  using TimeSeriesStore<DD>::Read;
+
+protected:
+private:
+  HDF5TimeSeriesAccessor<DD> m_accessor;
+};
+
+} // namespace tf
+} // namespace ou
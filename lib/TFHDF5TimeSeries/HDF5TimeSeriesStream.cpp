@@ -0,0 +1,120 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <iostream>
+
+#include <boost/bind.hpp>
+
+#include "HDF5TimeSeriesStream.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+HDF5StreamLoader::HDF5StreamLoader( HDF5DataManager::enumFileOptionType fot )
+: m_dm( fot ), m_pInProgress( 0 ), m_bStop( false )
+{
+  m_thread = boost::thread( boost::bind( &HDF5StreamLoader::Process, this ) );
+}
+
+HDF5StreamLoader::~HDF5StreamLoader( void ) {
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutex );
+    assert( m_dequeRequest.empty() );
+    m_bStop = true;
+  }
+  m_cvRequest.notify_one();
+  m_thread.join();
+}
+
+void HDF5StreamLoader::Request( HDF5StreamBase* pStream ) {
+  {
+    boost::lock_guard<boost::mutex> guard( m_mutex );
+    assert( !pStream->m_bPending );
+    pStream->m_bPending = true;
+    m_dequeRequest.push_back( pStream );
+  }
+  m_cvRequest.notify_one();
+}
+
+void HDF5StreamLoader::Wait( HDF5StreamBase* pStream ) {
+  boost::unique_lock<boost::mutex> lock( m_mutex );
+  if ( pStream->m_bPending && ( m_pInProgress != pStream ) ) {
+    // consumer has caught up with the read ahead, move it to the front of the queue
+    std::deque<HDF5StreamBase*>::iterator iter = std::find( m_dequeRequest.begin(), m_dequeRequest.end(), pStream );
+    if ( m_dequeRequest.end() != iter ) {
+      m_dequeRequest.erase( iter );
+      m_dequeRequest.push_front( pStream );
+    }
+  }
+  while ( pStream->m_bPending ) {
+    m_cvComplete.wait( lock );
+  }
+}
+
+void HDF5StreamLoader::Cancel( HDF5StreamBase* pStream ) {
+  boost::unique_lock<boost::mutex> lock( m_mutex );
+  if ( pStream->m_bPending && ( m_pInProgress != pStream ) ) {
+    std::deque<HDF5StreamBase*>::iterator iter = std::find( m_dequeRequest.begin(), m_dequeRequest.end(), pStream );
+    if ( m_dequeRequest.end() != iter ) {
+      m_dequeRequest.erase( iter );
+    }
+    pStream->m_bPending = false;
+  }
+  while ( pStream->m_bPending ) {
+    m_cvComplete.wait( lock );
+  }
+}
+
+void HDF5StreamLoader::Process( void ) {
+  while ( true ) {
+    HDF5StreamBase* pStream;
+    {
+      boost::unique_lock<boost::mutex> lock( m_mutex );
+      while ( m_dequeRequest.empty() && !m_bStop ) {
+        m_cvRequest.wait( lock );
+      }
+      if ( m_dequeRequest.empty() ) break;  // stopping
+      pStream = m_dequeRequest.front();
+      m_dequeRequest.pop_front();
+      m_pInProgress = pStream;
+    }
+    bool bFailed( false );
+    {
+      boost::lock_guard<boost::mutex> guard( m_mutexHDF5 );
+      try {
+        pStream->ReadAhead();
+      }
+      catch ( H5::Exception& e ) {
+        std::cout << "HDF5StreamLoader::Process " << e.getDetailMsg() << std::endl;
+        bFailed = true;
+      }
+      catch ( std::exception& e ) {
+        std::cout << "HDF5StreamLoader::Process " << e.what() << std::endl;
+        bFailed = true;
+      }
+    }
+    {
+      boost::lock_guard<boost::mutex> guard( m_mutex );
+      m_pInProgress = 0;
+      if ( bFailed ) pStream->m_bFailed = true;
+      pStream->m_bPending = false;
+    }
+    m_cvComplete.notify_all();
+  }
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,261 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// streams a dataset in fixed size chunks rather than loading it whole:
+//   each stream holds the chunk being consumed plus one chunk read ahead,
+//   so memory is bounded by 2 x chunk size x number of streams
+// HDF5StreamLoader runs one background thread which does the read ahead for all its streams,
+//   every hdf5 call made on behalf of the streams is serialized through the loader,
+//   as the hdf5 library is not assumed to have been built thread safe
+// a read ahead which fails marks its stream as failed, the stream then ends with the datums it had,
+//   a stream which can't be opened, or can't read its first chunk, throws runtime_error from its constructor
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <TFTimeSeries/MergeDatedDatumCarrier.h>
+
+#include "HDF5DataManager.h"
+#include "HDF5TimeSeriesAccessor.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class HDF5StreamLoader;
+
+class HDF5StreamBase {
+  friend class HDF5StreamLoader;
+public:
+  HDF5StreamBase( void ): m_bPending( false ), m_bFailed( false ) {};
+  virtual ~HDF5StreamBase( void ) {};
+  bool Failed( void ) const { return m_bFailed; }; // by the consumer, once a read ahead was waited for
+protected:
+  virtual void ReadAhead( void ) = 0; // hdf5 lock is held by caller
+private:
+  bool m_bPending;  // guarded by the loader
+  bool m_bFailed;  // set by the loader, before the pending read ahead completes
+};
+
+class HDF5StreamLoader: boost::noncopyable {
+public:
+
+  HDF5StreamLoader( HDF5DataManager::enumFileOptionType fot = HDF5DataManager::RO ); // RDWR if others will write while streaming
+  ~HDF5StreamLoader( void );  // streams need to be destroyed first
+
+  HDF5DataManager& DataManager( void ) { return m_dm; };
+  boost::mutex& MutexHDF5( void ) { return m_mutexHDF5; };
+
+  void Request( HDF5StreamBase* ); // queue a read ahead
+  void Wait( HDF5StreamBase* ); // block until the requested read ahead is complete
+  void Cancel( HDF5StreamBase* ); // remove from queue, or wait for a read in progress
+
+protected:
+private:
+
+  HDF5DataManager m_dm;
+
+  boost::mutex m_mutexHDF5;
+
+  boost::mutex m_mutex;
+  boost::condition_variable m_cvRequest;
+  boost::condition_variable m_cvComplete;
+  std::deque<HDF5StreamBase*> m_dequeRequest;
+  HDF5StreamBase* m_pInProgress;
+  bool m_bStop;
+
+  boost::thread m_thread;
+
+  void Process( void );
+};
+
+//
+// =================
+//
+
+template<class DD>
+class HDF5TimeSeriesStream: public HDF5StreamBase {
+public:
+
+  typedef hsize_t size_type;
+
+  HDF5TimeSeriesStream( HDF5StreamLoader& loader, const std::string& sPathName, size_type nChunkSize );
+  virtual ~HDF5TimeSeriesStream( void );
+
+  size_type Size( void ) const { return m_nSize; }; // whole dataset
+  const ptime& FirstDateTime( void ) const { return m_dtFirst; }; // of the whole dataset, not_a_date_time when empty
+  const ptime& LastDateTime( void ) const { return m_dtLast; };
+
+  const DD* First( void ) const { return ( 0 == m_nCurrent ) ? 0 : &m_vCurrent[ 0 ]; }; // once only, on construction
+  const DD* Next( void );
+
+protected:
+  void ReadAhead( void );
+private:
+
+  HDF5StreamLoader& m_loader;
+  boost::scoped_ptr<HDF5TimeSeriesAccessor<DD> > m_pAccessor;  // released with the hdf5 lock held
+
+  size_type m_nSize;
+  size_type m_nChunkSize;
+  size_type m_ixNextRead;  // next disk index for read ahead
+
+  ptime m_dtFirst;
+  ptime m_dtLast;
+
+  std::vector<DD> m_vCurrent;
+  size_type m_nCurrent;
+  size_type m_ixCurrent;
+
+  std::vector<DD> m_vAhead;  // belongs to the loader while a request is pending
+  size_type m_nAhead;
+  bool m_bRequested;
+
+  void Advance( void ); // ahead becomes current, and request the next
+};
+
+template<class DD>
+HDF5TimeSeriesStream<DD>::HDF5TimeSeriesStream( HDF5StreamLoader& loader, const std::string& sPathName, size_type nChunkSize )
+: HDF5StreamBase(), m_loader( loader ), m_pAccessor( 0 ),
+  m_nSize( 0 ), m_nChunkSize( nChunkSize ), m_ixNextRead( 0 ),
+  m_nCurrent( 0 ), m_ixCurrent( 0 ), m_nAhead( 0 ), m_bRequested( false )
+{
+  assert( 0 < nChunkSize );
+  boost::lock_guard<boost::mutex> guard( m_loader.MutexHDF5() );
+  m_pAccessor.reset( new HDF5TimeSeriesAccessor<DD>( m_loader.DataManager(), sPathName ) ); // throws runtime_error if not found
+  try {
+    m_nSize = m_pAccessor->size();
+    m_vCurrent.resize( std::min<size_type>( m_nChunkSize, m_nSize ) );
+    m_vAhead.resize( m_vCurrent.size() );
+    ReadAhead();  // first chunk is read synchronously, so the first datum is available immediately
+    if ( 0 != m_nSize ) {
+      m_dtFirst = m_vAhead[ 0 ].DateTime();
+      m_dtLast = m_pAccessor->Fetch( m_nSize - 1 ).DateTime();
+    }
+  }
+  catch ( H5::Exception& e ) {
+    m_pAccessor.reset();
+    throw std::runtime_error( "HDF5TimeSeriesStream " + sPathName + ": " + e.getDetailMsg() );
+  }
+  catch ( ... ) {
+    m_pAccessor.reset();
+    throw;
+  }
+  Advance();
+}
+
+template<class DD>
+HDF5TimeSeriesStream<DD>::~HDF5TimeSeriesStream( void ) {
+  m_loader.Cancel( this );
+  boost::lock_guard<boost::mutex> guard( m_loader.MutexHDF5() );
+  m_pAccessor.reset();
+}
+
+template<class DD>
+void HDF5TimeSeriesStream<DD>::ReadAhead( void ) {
+  m_nAhead = std::min<size_type>( m_nChunkSize, m_nSize - m_ixNextRead );
+  if ( 0 != m_nAhead ) {
+    H5::DataSpace dsMemory( 1, &m_nAhead );
+    m_pAccessor->Read( m_ixNextRead, m_nAhead, &dsMemory, &m_vAhead[ 0 ] );
+    dsMemory.close();
+    m_ixNextRead += m_nAhead;
+  }
+}
+
+template<class DD>
+void HDF5TimeSeriesStream<DD>::Advance( void ) {
+  m_vCurrent.swap( m_vAhead );
+  m_nCurrent = m_nAhead;
+  m_ixCurrent = 0;
+  m_nAhead = 0;
+  m_bRequested = ( m_ixNextRead < m_nSize );
+  if ( m_bRequested ) {
+    m_loader.Request( this );
+  }
+}
+
+template<class DD>
+const DD* HDF5TimeSeriesStream<DD>::Next( void ) {
+  ++m_ixCurrent;
+  if ( m_ixCurrent < m_nCurrent ) return &m_vCurrent[ m_ixCurrent ];
+  if ( !m_bRequested ) { // depleted
+    m_nCurrent = 0;
+    m_ixCurrent = 0;
+    return 0;
+  }
+  m_loader.Wait( this ); // normally already complete
+  if ( Failed() ) { // what was read ahead is not trusted
+    m_nAhead = 0;
+    m_ixNextRead = m_nSize;
+  }
+  Advance();
+  return ( 0 == m_nCurrent ) ? 0 : &m_vCurrent[ 0 ];
+}
+
+//
+// =================
+//
+
+// a merge carrier which pulls its datums from a stream rather than a loaded TimeSeries
+template<class DD>
+class HDF5MergeCarrier: public MergeCarrierBase {
+public:
+  typedef FastDelegate1<const DD&> OnTypedDatumHandler;
+  typedef typename HDF5TimeSeriesStream<DD>::size_type size_type;
+  HDF5MergeCarrier( HDF5StreamLoader& loader, const std::string& sPathName, size_type nChunkSize, OnTypedDatumHandler function );
+  virtual ~HDF5MergeCarrier( void ) {};
+  void ProcessDatum( void );
+  std::size_t Size( void ) const { return m_stream.Size(); };
+  ptime FirstDateTime( void ) const { return m_stream.FirstDateTime(); };
+  ptime LastDateTime( void ) const { return m_stream.LastDateTime(); };
+  bool Failed( void ) const { return m_stream.Failed(); }; // ended early, on a read error
+protected:
+private:
+  HDF5TimeSeriesStream<DD> m_stream;
+  OnTypedDatumHandler OnTypedDatum;
+  const DD* m_pTypedDatum;
+  void Load( const DD* pDatum ) {
+    m_pTypedDatum = pDatum;
+    m_pDatum = pDatum;
+    m_nKey = ( 0 == pDatum ) ? keyDepleted : Key( pDatum->DateTime() );
+  }
+};
+
+template<class DD>
+HDF5MergeCarrier<DD>::HDF5MergeCarrier( HDF5StreamLoader& loader, const std::string& sPathName, size_type nChunkSize, OnTypedDatumHandler function )
+: MergeCarrierBase(), m_stream( loader, sPathName, nChunkSize ), OnTypedDatum( function )
+{
+  Load( m_stream.First() );
+}
+
+template<class DD>
+void HDF5MergeCarrier<DD>::ProcessDatum( void ) {
+  if ( 0 != OnTypedDatum ) OnTypedDatum( *m_pTypedDatum );
+  Load( m_stream.Next() );
+}
+
+} // namespace tf
+} // namespace ou
@@ -32,6 +32,7 @@ public:
   HDF5WriteTimeSeries<TS>( HDF5DataManager& dm, bool bDeflatable, bool bExpandable, int nDeflate = 5, hsize_t nChunkSize = 1024 );
   virtual ~HDF5WriteTimeSeries<TS>( void );
   void Write( const std::string &sPathName, TS* timeseries );
+  bool CreateDataSet( const std::string& sPathName ); // true when created, false when it exists already
 
 protected:
 private:
@@ -63,6 +64,39 @@ template<class TS> void HDF5WriteTimeSeries<TS>::Write(const std::string &sPathN
     throw std::invalid_argument( "zero length time series found" );
   }
 
+  CreateDataSet( sPathName );
+
+  try {
+    HDF5TimeSeriesContainer<DD> repository( m_dm, sPathName );
+    // 2026/10/18 written a contiguous run at a time, a SegmentedTimeSeries holds its datums in blocks
+    typedef HDF5TimeSeriesAccessor<DD> accessor_t;
+    typename TS::const_iterator iter = timeseries->begin();
+    const typename TS::const_iterator end = timeseries->end();
+    hsize_t ix = repository.accessor_t::LowerBound( 0, repository.size(), iter->DateTime() ); // the insertion point, as for HDF5TimeSeriesContainer::Write
+    while ( end != iter ) {
+      const DD* pBegin = &( *iter );
+      size_t cnt = 0;
+      do {
+        ++cnt;
+        ++iter;
+      } while ( ( end != iter ) && ( &( *iter ) == pBegin + cnt ) );
+      repository.accessor_t::Write( ix, cnt, pBegin );
+      ix += cnt;
+    }
+    //dm.AddGroupForSymbol( m_sSymbol );
+    //dm.GetH5File()->link( H5L_type_t::H5L_TYPE_HARD, sFileName1, "/symbol/" + m_sSymbol + "/bar.86400" );
+  }
+  catch ( H5::FileIException e ) {
+    std::cout << "H5::FileIException " << e.getDetailMsg() << std::endl;
+    e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
+  }
+  catch ( ... ) {
+    std::cout << "CHistoryCollectorDaily::WriteData:  unknown error 2" << std::endl;
+  }
+}
+
+template<class TS> bool HDF5WriteTimeSeries<TS>::CreateDataSet( const std::string& sPathName ) {
+
   H5::DataSet *dataset;
   bool bNeedToCreateDataSet = false;
   //HDF5DataManager dm( HDF5DataManager::RDWR );
@@ -122,19 +156,7 @@ template<class TS> void HDF5WriteTimeSeries<TS>::Write(const std::string &sPathN
     e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
   }
 
-  try {
-    HDF5TimeSeriesContainer<DD> repository( m_dm, sPathName );
-    repository.Write( timeseries->First(), timeseries->Last() + 1 );
-    //dm.AddGroupForSymbol( m_sSymbol );
-    //dm.GetH5File()->link( H5L_type_t::H5L_TYPE_HARD, sFileName1, "/symbol/" + m_sSymbol + "/bar.86400" );
-  }
-  catch ( H5::FileIException e ) {
-    std::cout << "H5::FileIException " << e.getDetailMsg() << std::endl;
-    e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
-  }
-  catch ( ... ) {
-    std::cout << "CHistoryCollectorDaily::WriteData:  unknown error 2" << std::endl;
-  }
+  return bNeedToCreateDataSet;
 }
 
 
@@ -36,7 +36,14 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 # Object Files
 OBJECTFILES= \
 	${OBJECTDIR}/HDF5Attribute.o \
-	${OBJECTDIR}/HDF5DataManager.o
+	${OBJECTDIR}/HDF5Catalog.o \
+	${OBJECTDIR}/HDF5DailyBarPanel.o \
+	${OBJECTDIR}/HDF5DataManager.o \
+	${OBJECTDIR}/HDF5FlatFileConverter.o \
+	${OBJECTDIR}/HDF5ParallelLoader.o \
+	${OBJECTDIR}/HDF5TimeIndex.o \
+	${OBJECTDIR}/HDF5TimeSeriesAppender.o \
+	${OBJECTDIR}/HDF5TimeSeriesStream.o
 
 
 # C Compiler Flags
@@ -70,11 +77,46 @@ ${OBJECTDIR}/HDF5Attribute.o: HDF5Attribute.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5Attribute.o HDF5Attribute.cpp
 
+${OBJECTDIR}/HDF5Catalog.o: HDF5Catalog.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5Catalog.o HDF5Catalog.cpp
+
+${OBJECTDIR}/HDF5DailyBarPanel.o: HDF5DailyBarPanel.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5DailyBarPanel.o HDF5DailyBarPanel.cpp
+
 ${OBJECTDIR}/HDF5DataManager.o: HDF5DataManager.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5DataManager.o HDF5DataManager.cpp
 
+${OBJECTDIR}/HDF5FlatFileConverter.o: HDF5FlatFileConverter.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5FlatFileConverter.o HDF5FlatFileConverter.cpp
+
+${OBJECTDIR}/HDF5ParallelLoader.o: HDF5ParallelLoader.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5ParallelLoader.o HDF5ParallelLoader.cpp
+
+${OBJECTDIR}/HDF5TimeIndex.o: HDF5TimeIndex.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5TimeIndex.o HDF5TimeIndex.cpp
+
+${OBJECTDIR}/HDF5TimeSeriesAppender.o: HDF5TimeSeriesAppender.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5TimeSeriesAppender.o HDF5TimeSeriesAppender.cpp
+
+${OBJECTDIR}/HDF5TimeSeriesStream.o: HDF5TimeSeriesStream.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/HDF5TimeSeriesStream.o HDF5TimeSeriesStream.cpp
+
 # Subprojects
 .build-subprojects:
 
@@ -15,15 +15,21 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <sstream>
 #include <exception>
+#include <algorithm>
 
 #include <boost/assert.hpp>
+#include <boost/atomic.hpp>
 #include <boost/foreach.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <OUCommon/Debug.h>
 #include <OUCommon/Network.h>
 #include <OUCommon/ReusableBuffers.h>
+#include <OUCommon/ShardedDispatch.h>
 
 #include "IQFeedMessages.h"
 
@@ -32,6 +38,16 @@
 //     m_pPort = m_pIQFeedProvider->CheckOutLookupPort();
 //     m_pIQFeedProvider->CheckInLookupPort( m_pPort );
 
+// 2026/10/18 SelectUpdateFields trims Q and P messages to the fields asked for (IQFeed 4.3 and later),
+//   the feed answers with S,CURRENT UPDATE FIELDS, from which the messages' field map is built,
+//   so the IQFPricingMessage field ids keep working, a feed which doesn't answer keeps the full layout
+// 2026/10/18 SetDispatchShards moves the handling of Q, P, and F messages off the network thread,
+//   onto shards chosen by symbol, so a symbol's messages stay in order, and are handled on one thread,
+//   the network thread keeps framing lines, and handles S, T, and N messages itself
+//   the On...Message callbacks, and whatever hangs off them, then run concurrently, one per shard,
+//   the ...Done calls may come from any thread, the buffers and messages go back to locked repositories
+//   the shards call into T, so T's destructor stops them, with SetDispatchShards( 0 ), while T is still whole
+
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
@@ -43,6 +59,9 @@ public:
 
   typedef typename ou::Network<IQFeed<T> > inherited_t;
   typedef typename inherited_t::linebuffer_t linebuffer_t;
+  typedef IQFUpdateMessage::enumFieldIds enumUpdateFieldIds;
+  typedef std::vector<enumUpdateFieldIds> vUpdateFields_t;
+  typedef IQFUpdateMessage::fieldmap_t fieldmap_t;  // shared by IQFSummaryMessage
 
   IQFeed(void);
   virtual ~IQFeed(void);
@@ -77,6 +96,13 @@ public:
   void SetNewsOn( void );
   void SetNewsOff( void );
 
+  // the fields of Q and P messages from the next connection on, the symbol is always sent, empty for all fields
+  void SelectUpdateFields( const vUpdateFields_t& vFields ) { m_vUpdateFields = vFields; };
+
+  // while disconnected: threads handling Q, P, and F messages, 0 handles them on the network thread,
+  //   and stops the threads, after handling what they hold
+  void SetDispatchShards( unsigned int nShards );
+
 protected:
 
   enum enumNewsState {
@@ -86,6 +112,18 @@ protected:
 
   // called by CNetwork via CRTP
   void OnNetworkConnected(void) {
+    if ( m_pShards ) m_pShards->Drain();  // lines of the previous connection are in its layout
+    m_bUpdateFieldMap.store( false, boost::memory_order_release );
+    if ( !m_vUpdateFields.empty() ) {
+      std::stringstream ss;
+      ss << "S,SELECT UPDATE FIELDS";
+      for ( typename vUpdateFields_t::const_iterator iter = m_vUpdateFields.begin(); m_vUpdateFields.end() != iter; ++iter ) {
+        const char* szName = IQFUpdateMessage::FieldName( *iter );
+        if ( ( IQFUpdateMessage::QPSymbol != *iter ) && ( 0 != szName ) ) ss << "," << szName;
+      }
+      ss << std::endl;
+      ou::Network<IQFeed<T> >::Send( ss.str() );
+    }
     if ( &IQFeed<T>::OnIQFeedConnected != &T::OnIQFeedConnected ) {
       static_cast<T*>( this )->OnIQFeedConnected();
     }
@@ -121,6 +159,17 @@ protected:
 
 private:
 
+  vUpdateFields_t m_vUpdateFields;
+  fieldmap_t m_mapUpdateFields;
+  boost::atomic<bool> m_bUpdateFieldMap;  // m_mapUpdateFields describes the Q and P messages, set on the network thread, read on the shards
+
+  void UpdateFieldsSelected( IQFSystemMessage* msg );
+
+  typedef ou::ShardedDispatch<linebuffer_t*> shards_t;
+  boost::scoped_ptr<shards_t> m_pShards;
+
+  void ProcessLine( linebuffer_t* );
+
   typename ou::BufferRepository<IQFUpdateMessage> m_reposUpdateMessages;
   typename ou::BufferRepository<IQFSummaryMessage> m_reposSummaryMessages;
   typename ou::BufferRepository<IQFNewsMessage> m_reposNewsMessages;
@@ -133,12 +182,22 @@ private:
 template <typename T>
 IQFeed<T>::IQFeed( void ) 
 : ou::Network<IQFeed<T> >( "127.0.0.1", 5009 ),
-  m_stateNews( NEWSISOFF )
+  m_stateNews( NEWSISOFF ), m_bUpdateFieldMap( false )
 {
 }
 
 template <typename T>
 IQFeed<T>::~IQFeed(void) {
+  BOOST_ASSERT( !m_pShards );  // T is gone, the shards would call into what is left of it
+  m_pShards.reset();  // lines in the shards are handled before the repositories go
+}
+
+template <typename T>
+void IQFeed<T>::SetDispatchShards( unsigned int nShards ) {
+  m_pShards.reset();
+  if ( 0 < nShards ) {
+    m_pShards.reset( new shards_t( nShards, fastdelegate::MakeDelegate( this, &IQFeed<T>::ProcessLine ) ) );
+  }
 }
 
 template <typename T>
@@ -161,8 +220,42 @@ void IQFeed<T>::SetNewsOff( void ) {
   }
 }
 
+template <typename T>
+void IQFeed<T>::UpdateFieldsSelected( IQFSystemMessage* msg ) {
+  // S,CURRENT UPDATE FIELDS,Symbol,... : the name in field ix is in field ix - 1 of the Q and P messages
+  if ( m_pShards ) m_pShards->Drain();  // lines queued before the change are in the previous layout
+  m_mapUpdateFields.assign( 0 );
+  for ( IQFSystemMessage::ixFields_t ix = 3; ix < m_mapUpdateFields.size(); ++ix ) {
+    const std::string& sName( msg->Field( ix ) );
+    if ( sName.empty() ) break;
+    enumUpdateFieldIds id = IQFUpdateMessage::FieldId( sName );
+    if ( IQFUpdateMessage::_QPLastEntry != id ) m_mapUpdateFields[ id ] = static_cast<boost::uint8_t>( ix - 1 );
+  }
+  m_bUpdateFieldMap.store( true, boost::memory_order_release );  // the map is complete before it is used
+}
+
 template <typename T>
 void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
+  // a line too short to carry a symbol goes to ProcessLine, as it does without shards
+  if ( m_pShards && ( 2 < pBuffer->size() ) && ( ',' == (*pBuffer)[ 1 ] ) ) {
+    switch ( (*pBuffer)[ 0 ] ) {
+      case 'Q':
+      case 'P':
+      case 'F':
+        {
+          // the symbol is the second field
+          typename linebuffer_t::iterator begin = pBuffer->begin() + 2;
+          typename linebuffer_t::iterator end = std::find( begin, pBuffer->end(), ',' );
+          m_pShards->Post( boost::hash_range( begin, end ) % m_pShards->Shards(), pBuffer );
+        }
+        return;
+    }
+  }
+  ProcessLine( pBuffer );
+}
+
+template <typename T>
+void IQFeed<T>::ProcessLine( linebuffer_t* pBuffer ) {
 
   typename linebuffer_t::iterator iter = (*pBuffer).begin();
   typename linebuffer_t::iterator end = (*pBuffer).end();
@@ -180,6 +273,7 @@ void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
     case 'Q': 
       {
         IQFUpdateMessage* msg = m_reposUpdateMessages.CheckOutL();
+        msg->SetFieldMap( m_bUpdateFieldMap.load( boost::memory_order_acquire ) ? &m_mapUpdateFields : 0 );
         msg->Assign( iter, end );
         if ( &IQFeed<T>::OnIQFeedUpdateMessage != &T::OnIQFeedUpdateMessage ) {
           static_cast<T*>( this )->OnIQFeedUpdateMessage( pBuffer, msg);
@@ -192,6 +286,7 @@ void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
     case 'P': 
       {
         IQFSummaryMessage* msg = m_reposSummaryMessages.CheckOutL();
+        msg->SetFieldMap( m_bUpdateFieldMap.load( boost::memory_order_acquire ) ? &m_mapUpdateFields : 0 );
         msg->Assign( iter, end );
         if ( &IQFeed<T>::OnIQFeedSummaryMessage != &T::OnIQFeedSummaryMessage ) {
           static_cast<T*>( this )->OnIQFeedSummaryMessage( pBuffer, msg);
@@ -246,6 +341,9 @@ void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
           ss << "S,KEY," << msg->Field( 3 ) << std::endl;
           ou::Network<IQFeed<T> >::Send( ss.str() );
         }
+        if ( "CURRENT UPDATE FIELDS" == msg->Field( 2 ) ) {
+          UpdateFieldsSelected( msg );
+        }
         if ( "CUST" == msg->Field( 2 ) ) {
           if ( "4.3.0.3" > msg->Field( 7 ) ) {
 //            cout << "Need IQFeed version of 4.3.0.3 or greater (" << msg.Field( 7 ) << ")" << endl;
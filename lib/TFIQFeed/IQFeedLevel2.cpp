@@ -0,0 +1,138 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <cstring>
+#include <algorithm>
+
+#include <boost/thread/lock_guard.hpp>
+
+#include "IQFeedLevel2.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+Level2::Level2( void )
+: ou::Network<Level2>( "127.0.0.1", 9200 ),
+  m_bConnected( false ), m_cntMessages( 0 ), m_cntUnknown( 0 )
+{
+}
+
+Level2::~Level2( void ) {
+}
+
+Level2::Book& Level2::Watch( const std::string& sSymbol, bool bRecord, double dblTickSize, unsigned int nTop ) {
+  boost::lock_guard<ou::SpinLock> lock( m_spinlock );
+  mapBook_t::iterator iter = m_mapBook.find( sSymbol );
+  if ( m_mapBook.end() == iter ) {
+    pBook_t pBook( new Book( sSymbol, bRecord, dblTickSize, nTop ) );
+    iter = m_mapBook.insert( mapBook_t::value_type( sSymbol, pBook ) ).first;
+    m_dispatch.Insert( sSymbol, pBook.get() );
+  }
+  Book& book( *iter->second );
+  if ( !book.bWatched ) {
+    book.bWatched = true;
+    if ( m_bConnected ) Send( "w" + sSymbol + "\n" );
+  }
+  return book;
+}
+
+void Level2::Unwatch( const std::string& sSymbol ) {
+  boost::lock_guard<ou::SpinLock> lock( m_spinlock );
+  mapBook_t::iterator iter = m_mapBook.find( sSymbol );
+  if ( ( m_mapBook.end() != iter ) && iter->second->bWatched ) {
+    iter->second->bWatched = false;
+    if ( m_bConnected ) Send( "r" + sSymbol + "\n" );
+  }
+}
+
+void Level2::OnNetworkConnected( void ) {
+  boost::lock_guard<ou::SpinLock> lock( m_spinlock );
+  m_bConnected = true;
+  for ( mapBook_t::iterator iter = m_mapBook.begin(); m_mapBook.end() != iter; ++iter ) {
+    if ( iter->second->bWatched ) {
+      iter->second->book.Clear();  // the watch brings the market makers again
+      Send( "w" + iter->first + "\n" );
+    }
+  }
+}
+
+void Level2::OnNetworkDisconnected( void ) {
+  boost::lock_guard<ou::SpinLock> lock( m_spinlock );
+  m_bConnected = false;
+}
+
+void Level2::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
+  if ( ( 2 < pBuffer->size() ) && ( ',' == (*pBuffer)[ 1 ] ) ) {
+    switch ( (*pBuffer)[ 0 ] ) {
+      case '2':  // update
+      case 'Z':  // summary
+        HandleQuote( pBuffer );
+        break;
+      default:  // T timestamps, S system, n symbol not found, E errors, M market maker names: nothing kept
+        break;
+    }
+  }
+  GiveBackBuffer( pBuffer );
+}
+
+void Level2::HandleQuote( linebuffer_t* pBuffer ) {
+
+  linebuffer_t::iterator iter = pBuffer->begin();
+  linebuffer_t::iterator end = pBuffer->end();
+  m_msg.Assign( iter, end );
+  ++m_cntMessages;
+
+  const boost::string_ref sSymbol = m_msg.FieldRef( IQFLevel2Message::L2Symbol );
+  Book* pBook = m_dispatch.Find( sSymbol.data(), sSymbol.size() );
+  if ( 0 == pBook ) {
+    ++m_cntUnknown;
+    return;
+  }
+
+  // packed as MarketDepth packs its four characters
+  const boost::string_ref sMMID = m_msg.FieldRef( IQFLevel2Message::L2MMID );
+  MarketDepth::MMID_t mmid( 0 );
+  std::memcpy( &mmid, sMMID.data(), std::min<std::size_t>( 4, sMMID.size() ) );
+
+  ApplySide( *pBook, 'B', mmid, IQFLevel2Message::L2Bid, IQFLevel2Message::L2BidSize, IQFLevel2Message::L2BidTime, IQFLevel2Message::L2BidInfoValid );
+  ApplySide( *pBook, 'S', mmid, IQFLevel2Message::L2Ask, IQFLevel2Message::L2AskSize, IQFLevel2Message::L2AskTime, IQFLevel2Message::L2AskInfoValid );
+
+  if ( m_msg.EndOfGroup() ) pBook->book.EndOfGroup();
+}
+
+void Level2::ApplySide(
+  Book& book, char chSide, MarketDepth::MMID_t mmid,
+  IQFLevel2Message::enumFieldIds idPrice, IQFLevel2Message::enumFieldIds idSize,
+  IQFLevel2Message::enumFieldIds idTime, IQFLevel2Message::enumFieldIds idValid
+) {
+  const bool bValid = m_msg.Valid( idValid );
+  ptime dt( m_msg.Time( idTime ) );
+  if ( dt.is_not_a_date_time() ) dt = microsec_clock::universal_time();  // no time, as for a withdrawn side
+  const MarketDepth depth(
+    dt, chSide,
+    bValid ? m_msg.Integer( idSize ) : 0,
+    bValid ? m_msg.Double( idPrice ) : 0.0,
+    mmid );
+  if ( book.book.Update( depth ) ) {
+    if ( book.bRecord ) book.depths.Append( depth );
+    if ( !OnDepth.IsEmpty() ) OnDepth( Depth( book, depth ) );
+  }
+}
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
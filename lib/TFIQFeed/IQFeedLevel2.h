@@ -0,0 +1,112 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+// Started 2026/10/18
+
+// the level 2 port of IQConnect ( 9200 ), with an OrderBook for each symbol watched
+//   wSYMBOL starts a watch: a Z message for each market maker, then a 2 message each time one requotes
+//   a message carries the market maker's bid and ask, each side is applied to the book as a MarketDepth,
+//     a side not flagged as valid withdraws the market maker from that side
+//   books publish their top levels at the end of each group of messages, as the feed flags it
+// lines are handled on the network thread, the books, and their events, belong to it
+// a book can record the sides which changed it to its MarketDepths, read them once the watch is over
+
+#include <map>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <OUCommon/Network.h>
+#include <OUCommon/Delegate.h>
+#include <OUCommon/SpinLock.h>
+
+#include <TFTimeSeries/TimeSeries.h>
+#include <TFTrading/OrderBook.h>
+#include <TFTrading/SymbolDispatch.h>
+
+#include "IQFeedMessages.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+class Level2: public ou::Network<Level2> {
+  friend ou::Network<Level2>;
+public:
+
+  typedef ou::Network<Level2> inherited_t;
+  typedef inherited_t::linebuffer_t linebuffer_t;
+
+  struct Book {
+    const std::string sSymbol;
+    OrderBook book;
+    MarketDepths depths;  // filled when bRecord
+    bool bRecord;
+    bool bWatched;  // between Watch and Unwatch, watched again on each connection
+    Book( const std::string& sSymbol_, bool bRecord_, double dblTickSize, unsigned int nTop )
+      : sSymbol( sSymbol_ ), book( dblTickSize, nTop ), bRecord( bRecord_ ), bWatched( false ) {};
+  };
+
+  struct Depth {  // for OnDepth
+    const Book& book;
+    const MarketDepth& depth;
+    Depth( const Book& book_, const MarketDepth& depth_ ): book( book_ ), depth( depth_ ) {};
+  };
+
+  Level2( void );
+  virtual ~Level2( void );
+
+  // the book is created with the first watch of the symbol, and kept after Unwatch, with what it had
+  // the watch is sent now when connected, otherwise on connection
+  Book& Watch( const std::string& sSymbol, bool bRecord = false, double dblTickSize = 0.01, unsigned int nTop = 10 );
+  void Unwatch( const std::string& sSymbol );
+
+  ou::Delegate<const Depth&> OnDepth;  // each side which changed its book, after it is applied
+
+  std::size_t Messages( void ) const { return m_cntMessages; };  // 2 and Z messages
+  std::size_t Unknown( void ) const { return m_cntUnknown; };  // of those, the ones for symbols not watched
+
+protected:
+
+  // called by Network via CRTP
+  void OnNetworkConnected( void );
+  void OnNetworkDisconnected( void );
+  void OnNetworkLineBuffer( linebuffer_t* );
+
+private:
+
+  typedef boost::shared_ptr<Book> pBook_t;
+  typedef std::map<std::string, pBook_t> mapBook_t;
+
+  ou::SpinLock m_spinlock;  // m_mapBook, and m_bConnected, between Watch and the network thread
+  mapBook_t m_mapBook;  // owns the books
+  SymbolDispatch<Book*> m_dispatch;  // the symbol of each message to its book, found without the lock
+  bool m_bConnected;
+
+  IQFLevel2Message m_msg;  // reused for each line
+  std::size_t m_cntMessages;
+  std::size_t m_cntUnknown;
+
+  void HandleQuote( linebuffer_t* );
+  void ApplySide(
+    Book& book, char chSide, MarketDepth::MMID_t mmid,
+    IQFLevel2Message::enumFieldIds idPrice, IQFLevel2Message::enumFieldIds idSize,
+    IQFLevel2Message::enumFieldIds idTime, IQFLevel2Message::enumFieldIds idValid );
+};
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
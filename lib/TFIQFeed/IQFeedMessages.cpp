@@ -35,12 +35,12 @@ namespace tf { // TradeFrame
 //**** IQFSystemMessage
 
 IQFSystemMessage::IQFSystemMessage( void ) 
-: IQFBaseMessage<IQFSystemMessage>()
+: IQFBaseMessage<IQFSystemMessage, unsigned char, 64>()
 {
 }
 
 IQFSystemMessage::IQFSystemMessage( iterator_t& current, iterator_t& end ) 
-: IQFBaseMessage<IQFSystemMessage>( current, end )
+: IQFBaseMessage<IQFSystemMessage, unsigned char, 64>( current, end )
 {
 }
 
@@ -66,12 +66,12 @@ IQFNewsMessage::~IQFNewsMessage() {
 // resize the vector to accept with out resizing so often?
 
 IQFFundamentalMessage::IQFFundamentalMessage( void ) 
-: IQFBaseMessage<IQFFundamentalMessage>()
+: IQFBaseMessage<IQFFundamentalMessage, unsigned char, 56>()
 {
 }
 
 IQFFundamentalMessage::IQFFundamentalMessage( iterator_t& current, iterator_t& end ) 
-: IQFBaseMessage<IQFFundamentalMessage>( current, end )
+: IQFBaseMessage<IQFFundamentalMessage, unsigned char, 56>( current, end )
 {
 }
 
@@ -108,6 +108,49 @@ IQFSummaryMessage::IQFSummaryMessage( iterator_t& current, iterator_t& end )
 IQFSummaryMessage::~IQFSummaryMessage() {
 }
 
+//**** IQFLevel2Message
+
+IQFLevel2Message::IQFLevel2Message( void )
+: IQFBaseMessage<IQFLevel2Message>()
+{
+}
+
+IQFLevel2Message::IQFLevel2Message( iterator_t& current, iterator_t& end )
+: IQFBaseMessage<IQFLevel2Message>( current, end )
+{
+}
+
+IQFLevel2Message::~IQFLevel2Message() {
+}
+
+ptime IQFLevel2Message::Time( enumFieldIds idTime ) {
+  // the date is YYYY-MM-DD, or MM/DD/YYYY as on the level 1 port
+  boost::string_ref date = FieldRef( L2Date );
+  boost::string_ref time = FieldRef( idTime );
+  int nYear, nMonth, nDay;
+  bool bDate( false );
+  if ( ( 10 == date.size() ) && ( '-' == date[ 4 ] ) ) {
+    bDate = iqfeed::AllDigits( date.begin(), 4 ) && iqfeed::AllDigits( date.begin() + 5, 2 ) && iqfeed::AllDigits( date.begin() + 8, 2 );
+    if ( bDate ) {
+      nYear = iqfeed::Digits( date.begin(), 4 );
+      nMonth = iqfeed::Digits( date.begin() + 5, 2 );
+      nDay = iqfeed::Digits( date.begin() + 8, 2 );
+    }
+  }
+  else {
+    bDate = iqfeed::ParseDate( date.begin(), date.end(), nYear, nMonth, nDay );
+  }
+  time_duration td;
+  if ( bDate && iqfeed::ParseTime( time.begin(), time.end(), td ) ) {
+    try {
+      return ptime( boost::gregorian::date( nYear, nMonth, nDay ), td );
+    }
+    catch (...) {
+    }
+  }
+  return ptime( boost::date_time::not_a_date_time );
+}
+
 //**** IQFTimeMessage
 
 IQFTimeMessage::IQFTimeMessage( void )
@@ -130,12 +173,17 @@ IQFTimeMessage::~IQFTimeMessage() {
 
 void IQFTimeMessage::Assign(iterator_t &current, iterator_t &end) {
   IQFBaseMessage<IQFTimeMessage>::Assign( current, end );
-  std::stringstream ss( Field( 2 ) );
-  time_input_facet *input_facet;
-  input_facet = new boost::posix_time::time_input_facet();  // input facet stuff needs to be with ss.imbue, can't be reused
-  input_facet->format( "%Y%m%d %H:%M:%S" );
-  ss.imbue( std::locale( ss.getloc(), input_facet ) );
-  ss >> m_dt;
+  // %Y%m%d %H:%M:%S
+  boost::string_ref field = FieldRef( 2 );
+  time_duration td;
+  if ( ( 17 <= field.size() ) && iqfeed::AllDigits( field.begin(), 8 ) && ( ' ' == field[ 8 ] )
+    && iqfeed::ParseTime( field.begin() + 9, field.begin() + 17, td ) ) {  // whole seconds, as the facet read them
+    try {
+      m_dt = ptime( date( iqfeed::Digits( field.begin(), 4 ), iqfeed::Digits( field.begin() + 4, 2 ), iqfeed::Digits( field.begin() + 6, 2 ) ), td );
+    }
+    catch (...) {  // out of range, left as it was, as the facet did
+    }
+  }
   m_bMarketIsOpen = ( ( m_dt.time_of_day() >= m_timeMarketOpen ) && ( m_dt.time_of_day() < m_timeMarketClose ) );
 }
 
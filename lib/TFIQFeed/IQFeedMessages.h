@@ -14,9 +14,26 @@
 
 #pragma once
 
+// 2026/10/18 fields are indexed on demand into a fixed array of comma offsets, sized per message type,
+//   only as far as the highest field asked for, commas are found sixteen bytes at a time with sse2,
+//   FieldRef hands out a field without copying it
+// 2026/10/18 numbers, dates, and times are read with the fixed format parsers in ParseFields.h
+// 2026/10/18 a field map lets the Q/P field ids address messages with a selected set of fields
+// 2026/10/18 IQFLevel2Message for the market maker quotes of the level 2 port
+
 #include <string>
 #include <vector>
 #include <utility>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <boost/array.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/utility/string_ref.hpp>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 using namespace boost::posix_time;
@@ -30,6 +47,8 @@ using namespace boost::gregorian;
 #include <boost/spirit/include/phoenix_operator.hpp>
 #include <boost/spirit/include/phoenix_bind.hpp>
 
+#include "ParseFields.h"
+
 // will need to use the flex field capability where we get only the fields we need
 // field offsets are 1 based, in order to easily match up with documentation
 // for all the charT =  = unsigned char template parameters, need to turn into a trait
@@ -38,7 +57,8 @@ using namespace boost::gregorian;
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
-template <class T, class charT = unsigned char>
+// nMaxFields is the highest field which can be asked for, fields past it, or past the end of the line, are empty
+template <class T, class charT = unsigned char, std::size_t nMaxFields = 32>
 class IQFBaseMessage {
 public:
 
@@ -49,14 +69,20 @@ public:
   typedef std::pair<iterator_t, iterator_t> fielddelimiter_t;
   typedef typename linebuffer_t::size_type ixFields_t;
 
+  // field id to its position in the line, 0 for a field the line doesn't carry
+  typedef boost::array<boost::uint8_t, nMaxFields + 1> fieldmap_t;
+
   IQFBaseMessage( void );
   IQFBaseMessage( iterator_t& current, iterator_t& end );
   ~IQFBaseMessage(void);
 
   void Assign( iterator_t& current, iterator_t& end );
 
-  // change to return a fielddelimiter_t
+  void SetFieldMap( const fieldmap_t* pFieldMap ) { m_pFieldMap = pFieldMap; }; // 0 for lines with all fields in their documented places
+  bool HasField( ixFields_t fld ) const { return ( 0 == m_pFieldMap ) || ( 0 != (*m_pFieldMap)[ fld ] ); };
+
   const std::string& Field( ixFields_t ); // returns reference to a field (will be sNull or sField );
+  boost::string_ref FieldRef( ixFields_t ); // the field in place, valid while the line buffer is
   double Double( ixFields_t );  // use boost::spirit?
   int Integer( ixFields_t );  // use boost::spirit?
   date Date( ixFields_t );
@@ -66,19 +92,32 @@ public:
 
 protected:
 
-  std::vector<fielddelimiter_t> m_vFieldDelimiters;
+  typedef boost::int32_t offset_t;
+
+  iterator_t m_iterBegin;  // the line
+  offset_t m_nLength;
+
+  // m_rDelimiter[ ix ] is the offset of the ',' ending field ix, or the line length for the last field,
+  //   m_rDelimiter[ 0 ] is -1, so field ix starts at m_rDelimiter[ ix - 1 ] + 1
+  offset_t m_rDelimiter[ nMaxFields + 1 ];
+  ixFields_t m_nFields;  // fields indexed so far
+  bool m_bIndexed;  // the last field of the line has been reached
+
+  const fieldmap_t* m_pFieldMap;
 
   std::string sNull;  // always the empty string
   std::string sField;  // will hold content of selected field during field request call
 
-  void Tokenize( iterator_t& begin, iterator_t& end );  // scans for ',' and builds the m_vFieldDelimiters vector
+  void Tokenize( iterator_t& begin, iterator_t& end );  // starts a new line, fields are indexed when asked for
+  void Index( ixFields_t fld ); // indexes the line through field fld
+  fielddelimiter_t Delimiters( ixFields_t fld );
 
 private:
 
 };
 
 //****
-class IQFSystemMessage: public IQFBaseMessage<IQFSystemMessage> { // S
+class IQFSystemMessage: public IQFBaseMessage<IQFSystemMessage, unsigned char, 64> { // S, 64 for the field names of CURRENT UPDATE FIELDS
 public:
 
   IQFSystemMessage( void );
@@ -130,29 +169,25 @@ public:
   const std::string& SymbolList( void ) { return Field( NSymbolList ); };
   const std::string& DateTime( void ) { return Field( NDateTime ); };
   const std::string& Headline( void ) { 
-    m_sHeadLine.assign( m_vFieldDelimiters[ NHeadLine ].first, m_vFieldDelimiters[ 0 ].second );
+    fielddelimiter_t fd( HeadLine_iter() );
+    m_sHeadLine.assign( fd.first, fd.second );
     return m_sHeadLine;
   };
 
   fielddelimiter_t Distributor_iter( void ) { 
-    BOOST_ASSERT( NDistributor <= m_vFieldDelimiters.size() - 1 );
-    return m_vFieldDelimiters[ NDistributor ];
+    return Delimiters( NDistributor );
   }
   fielddelimiter_t StoryId_iter( void ) { 
-    BOOST_ASSERT( NStoryId <= m_vFieldDelimiters.size() - 1 );
-    return m_vFieldDelimiters[ NStoryId ];
+    return Delimiters( NStoryId );
   }
   fielddelimiter_t SymbolList_iter( void ) { 
-    BOOST_ASSERT( NSymbolList <= m_vFieldDelimiters.size() - 1 );
-    return m_vFieldDelimiters[ NSymbolList ];
+    return Delimiters( NSymbolList );
   }
   fielddelimiter_t DateTime_iter( void ) { 
-    BOOST_ASSERT( NDateTime <= m_vFieldDelimiters.size() - 1 );
-    return m_vFieldDelimiters[ NDateTime ];
+    return Delimiters( NDateTime );
   }
   fielddelimiter_t HeadLine_iter( void ) { 
-    BOOST_ASSERT( NHeadLine <= m_vFieldDelimiters.size() - 1 );
-    fielddelimiter_t fd( m_vFieldDelimiters[ NHeadLine ].first, m_vFieldDelimiters[ 0 ].second ); // necessary to incorporate included commas, and field 0 has end of buffer marker
+    fielddelimiter_t fd( Delimiters( NHeadLine ).first, m_iterBegin + m_nLength ); // necessary to incorporate included commas, runs to the end of the line
     return fd;
   }
 
@@ -163,7 +198,7 @@ private:
 };
 
 //**** IQFFundamentalMessage
-class IQFFundamentalMessage: public IQFBaseMessage<IQFFundamentalMessage> { // F
+class IQFFundamentalMessage: public IQFBaseMessage<IQFFundamentalMessage, unsigned char, 56> { // F, through _FLastEntry
 public:
 
   enum enumFieldIds {
@@ -221,7 +256,7 @@ private:
 
 //**** IQFPricingMessage ( root for IQFUpdateMessage, IQFSummaryMessage )
 template <class T, class charT = unsigned char>
-class IQFPricingMessage: public IQFBaseMessage<IQFPricingMessage<T, charT> > { // Q, P
+class IQFPricingMessage: public IQFBaseMessage<IQFPricingMessage<T, charT>, charT, 64> { // Q, P, through _QPLastEntry
 public:
 
   enum enumFieldIds {
@@ -277,13 +312,18 @@ public:
     _QPLastEntry
   };
   
-  typedef typename IQFBaseMessage<IQFPricingMessage<T, charT> >::iterator_t iterator_t;
-  typedef typename IQFBaseMessage<IQFPricingMessage<T, charT> >::fielddelimiter_t fielddelimiter_t;
+  typedef IQFBaseMessage<IQFPricingMessage<T, charT>, charT, 64> base_t;
+  typedef typename base_t::iterator_t iterator_t;
+  typedef typename base_t::fielddelimiter_t fielddelimiter_t;
 
   IQFPricingMessage( void );
   IQFPricingMessage( iterator_t& current, iterator_t& end );
   ~IQFPricingMessage(void);
 
+  // names used by S,SELECT UPDATE FIELDS and S,CURRENT UPDATE FIELDS
+  static const char* FieldName( enumFieldIds id );  // 0 for an id without a name
+  static enumFieldIds FieldId( const std::string& sName );  // _QPLastEntry when not one of the ids
+
   ptime LastTradeTime( void );
 protected:
 
@@ -315,163 +355,214 @@ public:
 private:
 };
 
+//**** IQFLevel2Message
+class IQFLevel2Message: public IQFBaseMessage<IQFLevel2Message> { // 2 update, Z summary: one market maker's quote
+public:
 
-template <class T, class charT>
-IQFBaseMessage<T, charT>::IQFBaseMessage( void )
+  enum enumFieldIds {
+    L2Type = 1,
+    L2Symbol,
+    L2MMID,
+    L2Bid,
+    L2Ask,
+    L2BidSize,
+    L2AskSize,
+    L2BidTime,
+    L2Date,
+    L2ConditionCode,
+    L2AskTime,
+    L2BidInfoValid,
+    L2AskInfoValid,
+    L2EndOfMsgGroup,
+    _L2LastEntry
+  };
+
+  IQFLevel2Message( void );
+  IQFLevel2Message( iterator_t& current, iterator_t& end );
+  ~IQFLevel2Message(void);
+
+  ptime Time( enumFieldIds idTime );  // L2BidTime or L2AskTime on L2Date, not_a_date_time when either is unreadable
+  bool Valid( enumFieldIds idValid ) { boost::string_ref field = FieldRef( idValid ); return !field.empty() && ( 'T' == field[ 0 ] ); };
+  bool EndOfGroup( void ) { boost::string_ref field = FieldRef( L2EndOfMsgGroup ); return field.empty() || ( 'T' == field[ 0 ] ); }; // each message is a group when not flagged
+
+private:
+};
+
+
+template <class T, class charT, std::size_t nMaxFields>
+IQFBaseMessage<T, charT, nMaxFields>::IQFBaseMessage( void )
+: m_nLength( 0 ), m_nFields( 0 ), m_bIndexed( true ), m_pFieldMap( 0 )
 {
+  BOOST_STATIC_ASSERT( 1 == sizeof( charT ) );
+  m_rDelimiter[ 0 ] = -1;
 }
 
-template <class T, class charT>
-IQFBaseMessage<T, charT>::IQFBaseMessage( iterator_t& current, iterator_t& end )
+template <class T, class charT, std::size_t nMaxFields>
+IQFBaseMessage<T, charT, nMaxFields>::IQFBaseMessage( iterator_t& current, iterator_t& end )
+: m_nLength( 0 ), m_nFields( 0 ), m_bIndexed( true ), m_pFieldMap( 0 )
 {
+  BOOST_STATIC_ASSERT( 1 == sizeof( charT ) );
+  m_rDelimiter[ 0 ] = -1;
   Tokenize( current, end );
 }
 
-template <class T, class charT>
-IQFBaseMessage<T, charT>::~IQFBaseMessage(void) {
+template <class T, class charT, std::size_t nMaxFields>
+IQFBaseMessage<T, charT, nMaxFields>::~IQFBaseMessage(void) {
 }
 
-template <class T, class charT>
-void IQFBaseMessage<T, charT>::Assign( iterator_t& current, iterator_t& end ) {
+template <class T, class charT, std::size_t nMaxFields>
+void IQFBaseMessage<T, charT, nMaxFields>::Assign( iterator_t& current, iterator_t& end ) {
   Tokenize( current, end );
 }
 
-template <class T, class charT>
-void IQFBaseMessage<T, charT>::Tokenize( iterator_t& current, iterator_t& end ) {
+template <class T, class charT, std::size_t nMaxFields>
+void IQFBaseMessage<T, charT, nMaxFields>::Tokenize( iterator_t& current, iterator_t& end ) {
   // used in IQFeedLookupPort::Parse
+  m_iterBegin = current;
+  m_nLength = static_cast<offset_t>( end - current );
+  m_nFields = 0;
+  m_bIndexed = false;
+  current = end;
+}
 
-  m_vFieldDelimiters.clear();
-  m_vFieldDelimiters.push_back( fielddelimiter_t( current, end ) );  // prime entry 0 with something to get to index 1
+template <class T, class charT, std::size_t nMaxFields>
+void IQFBaseMessage<T, charT, nMaxFields>::Index( ixFields_t fld ) {
+  if ( nMaxFields < fld ) fld = nMaxFields;
+  if ( m_bIndexed || ( fld <= m_nFields ) ) return;
+
+  if ( 0 == m_nLength ) {
+    m_rDelimiter[ ++m_nFields ] = 0;
+    m_bIndexed = true;
+    return;
+  }
 
-  iterator_t begin = current;
-  while ( current != end ) {
-    if ( ',' == *current ) { // first character shouldn't be ','
-      m_vFieldDelimiters.push_back( fielddelimiter_t( begin, current ) );
-      ++current;
-      begin = current;
+  const char* pBegin = reinterpret_cast<const char*>( &*m_iterBegin );
+  const char* pEnd = pBegin + m_nLength;
+  const char* p = pBegin + m_rDelimiter[ m_nFields ] + 1;
+
+#if defined(__SSE2__)
+  // a mask of the commas in each sixteen bytes, taken lowest bit first
+  const __m128i comma = _mm_set1_epi8( ',' );
+  while ( 16 <= ( pEnd - p ) ) {
+    unsigned int mask = _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) ), comma ) );
+    while ( 0 != mask ) {
+      m_rDelimiter[ ++m_nFields ] = static_cast<offset_t>( p - pBegin ) + __builtin_ctz( mask );
+      if ( fld == m_nFields ) return;
+      mask &= mask - 1;
     }
-    else {
-      ++current;
+    p += 16;
+  }
+#endif
+
+  while ( m_nFields < fld ) {
+    const char* pComma = ( p == pEnd ) ? 0 : static_cast<const char*>( std::memchr( p, ',', pEnd - p ) );
+    if ( 0 == pComma ) {
+      // always index what ever is remaining, empty string or not
+      m_rDelimiter[ ++m_nFields ] = m_nLength;
+      m_bIndexed = true;
+      break;
     }
+    m_rDelimiter[ ++m_nFields ] = static_cast<offset_t>( pComma - pBegin );
+    p = pComma + 1;
   }
-  // always push what ever is remaining, empty string or not
-  m_vFieldDelimiters.push_back( fielddelimiter_t( begin, current ) );
 }
 
-template <class T, class charT>
-const std::string& IQFBaseMessage<T, charT>::Field( ixFields_t fld ) {
+template <class T, class charT, std::size_t nMaxFields>
+typename IQFBaseMessage<T, charT, nMaxFields>::fielddelimiter_t IQFBaseMessage<T, charT, nMaxFields>::Delimiters( ixFields_t fld ) {
   BOOST_ASSERT( 0 != fld );
-  BOOST_ASSERT( fld <= m_vFieldDelimiters.size() - 1 );
-  fielddelimiter_t fielddelimiter = m_vFieldDelimiters[ fld ];
+  BOOST_ASSERT( fld <= nMaxFields );
+  if ( 0 != m_pFieldMap ) fld = (*m_pFieldMap)[ fld ];
+  Index( fld );
+  if ( ( 0 != fld ) && ( fld <= m_nFields ) ) {
+    return fielddelimiter_t( m_iterBegin + ( m_rDelimiter[ fld - 1 ] + 1 ), m_iterBegin + m_rDelimiter[ fld ] );
+  }
+  else {
+    iterator_t end = m_iterBegin + m_nLength;
+    return fielddelimiter_t( end, end );
+  }
+}
+
+template <class T, class charT, std::size_t nMaxFields>
+boost::string_ref IQFBaseMessage<T, charT, nMaxFields>::FieldRef( ixFields_t fld ) {
+  fielddelimiter_t fielddelimiter = Delimiters( fld );
+  if ( fielddelimiter.first == fielddelimiter.second ) return boost::string_ref();
+  return boost::string_ref( reinterpret_cast<const char*>( &*fielddelimiter.first ), fielddelimiter.second - fielddelimiter.first );
+}
+
+template <class T, class charT, std::size_t nMaxFields>
+const std::string& IQFBaseMessage<T, charT, nMaxFields>::Field( ixFields_t fld ) {
+  fielddelimiter_t fielddelimiter = Delimiters( fld );
   if ( fielddelimiter.first == fielddelimiter.second ) return sNull;
   else sField.assign( fielddelimiter.first, fielddelimiter.second );
   return sField;
 }
 
-template <class T, class charT>
-double IQFBaseMessage<T, charT>::Double( ixFields_t fld ) {
-  BOOST_ASSERT( 0 != fld );
-  BOOST_ASSERT( fld <= m_vFieldDelimiters.size() - 1 );
+template <class T, class charT, std::size_t nMaxFields>
+double IQFBaseMessage<T, charT, nMaxFields>::Double( ixFields_t fld ) {
 
   double dest = 0;
-  fielddelimiter_t fielddelimiter = m_vFieldDelimiters[ fld ];
-  if ( fielddelimiter.first != fielddelimiter.second ) {
-    namespace qi = boost::spirit::qi;
-	  using namespace boost::phoenix::arg_names;
-
-    using boost::spirit::qi::_1;
-	  using boost::phoenix::ref;
-	  using namespace boost::spirit::qi;
-
-    bool b = qi::parse( fielddelimiter.first, fielddelimiter.second, double_[ref(dest) = _1] );
+  boost::string_ref field = FieldRef( fld );
+  if ( !field.empty() ) {
+    iqfeed::ParseDouble( field.begin(), field.end(), dest );
   }
 
   return dest;
 }
 
-template <class T, class charT>
-int IQFBaseMessage<T, charT>::Integer( ixFields_t fld ) {
-  BOOST_ASSERT( 0 != fld );
-  BOOST_ASSERT( fld <= m_vFieldDelimiters.size() - 1 );
+template <class T, class charT, std::size_t nMaxFields>
+int IQFBaseMessage<T, charT, nMaxFields>::Integer( ixFields_t fld ) {
 
   int dest = 0;
-  fielddelimiter_t fielddelimiter = m_vFieldDelimiters[ fld ];
-  if ( fielddelimiter.first != fielddelimiter.second ) {
-    namespace qi = boost::spirit::qi;
-	  using namespace boost::phoenix::arg_names;
-
-    using boost::spirit::qi::_1;
-	  using boost::phoenix::ref;
-	  using namespace boost::spirit::qi;
-
-    bool b = qi::parse( fielddelimiter.first, fielddelimiter.second, int_[ref(dest) = _1] );
+  boost::string_ref field = FieldRef( fld );
+  if ( !field.empty() ) {
+    iqfeed::ParseInteger( field.begin(), field.end(), dest );
   }
 
   return dest;
 }
 
-template <class T, class charT>
-date IQFBaseMessage<T, charT>::Date( ixFields_t fld ) {
-  BOOST_ASSERT( 0 != fld );
-  BOOST_ASSERT( fld <= m_vFieldDelimiters.size() - 1 );
+template <class T, class charT, std::size_t nMaxFields>
+date IQFBaseMessage<T, charT, nMaxFields>::Date( ixFields_t fld ) {
   int nYear, nMonth, nDay;
   date d(not_a_date_time);
-  fielddelimiter_t fielddelimiter = m_vFieldDelimiters[ fld ];
-  if ( fielddelimiter.first != fielddelimiter.second ) {
-    if ( 10 == ( fielddelimiter.second - fielddelimiter.first ) ) {
-      namespace qi = boost::spirit::qi;
-	    using namespace boost::phoenix::arg_names;
-      using boost::spirit::qi::_1;
-      using boost::spirit::qi::lit;
-	    using boost::phoenix::ref;
-	    using namespace boost::spirit::qi;
-
-      bool b;
-      b = qi::parse( fielddelimiter.first + 0, fielddelimiter.first +  2, int_[ref(nMonth) = _1] );
-      b = qi::parse( fielddelimiter.first + 3, fielddelimiter.first +  5, int_[ref(nDay)   = _1] );
-      b = qi::parse( fielddelimiter.first + 6, fielddelimiter.first + 10, int_[ref(nYear)  = _1] );
-      if ( ( 99 == nDay ) || ( 99 == nMonth ) || ( 9999 == nYear ) ) {
+  boost::string_ref field = FieldRef( fld );
+  if ( iqfeed::ParseDate( field.begin(), field.end(), nYear, nMonth, nDay ) ) {
+    if ( ( 99 == nDay ) || ( 99 == nMonth ) || ( 9999 == nYear ) ) {
+    }
+    else {
+      try {
+        d = date( nYear, nMonth, nDay );
       }
-      else {
-        try {
-          if ( b ) d = date( nYear, nMonth, nDay );
-        }
-        catch (...) {
-          std::string s( fielddelimiter.first, fielddelimiter.second );
-          std::cout << "IQFBaseMessage<T, charT>::Date ill formed date" + s << std::endl;
-        }
+      catch (...) {
+        std::string s( field.begin(), field.end() );
+        std::cout << "IQFBaseMessage<T, charT>::Date ill formed date" + s << std::endl;
       }
     }
   }
   return d;
 }
 
-template <class T, class charT>
-typename IQFBaseMessage<T, charT>::iterator_t IQFBaseMessage<T, charT>::FieldBegin( ixFields_t fld ) {
-  BOOST_ASSERT( 0 != fld );
-  BOOST_ASSERT( fld <= m_vFieldDelimiters.size() - 1 );
-  return m_vFieldDelimiters[ fld ].first;
+template <class T, class charT, std::size_t nMaxFields>
+typename IQFBaseMessage<T, charT, nMaxFields>::iterator_t IQFBaseMessage<T, charT, nMaxFields>::FieldBegin( ixFields_t fld ) {
+  return Delimiters( fld ).first;
 }
 
-template <class T, class charT>
-typename IQFBaseMessage<T, charT>::iterator_t IQFBaseMessage<T, charT>::FieldEnd( ixFields_t fld ) {
-  BOOST_ASSERT( 0 != fld );
-  BOOST_ASSERT( fld <= m_vFieldDelimiters.size() - 1 );
-  return m_vFieldDelimiters[ fld ].second;
+template <class T, class charT, std::size_t nMaxFields>
+typename IQFBaseMessage<T, charT, nMaxFields>::iterator_t IQFBaseMessage<T, charT, nMaxFields>::FieldEnd( ixFields_t fld ) {
+  return Delimiters( fld ).second;
 }
 
 //**** IQFPricingMessage
-// resize the vector to accept with out resizing so often?
 
 template <class T, class charT>
 IQFPricingMessage<T, charT>::IQFPricingMessage( void ) 
-: IQFBaseMessage<IQFPricingMessage<T> >()
+: base_t()
 {
 }
 
 template <class T, class charT>
 IQFPricingMessage<T, charT>::IQFPricingMessage( iterator_t& current, iterator_t& end ) 
-: IQFBaseMessage<IQFPricingMessage>( current, end )
+: base_t( current, end )
 {
 }
 
@@ -479,39 +570,83 @@ template <class T, class charT>
 IQFPricingMessage<T, charT>::~IQFPricingMessage() {
 }
 
+template <class T, class charT>
+const char* IQFPricingMessage<T, charT>::FieldName( enumFieldIds id ) {
+  switch ( id ) {
+    case QPSymbol: return "Symbol";
+    case QPLast: return "Last";
+    case QPChange: return "Change";
+    case QPPctChange: return "Percent Change";
+    case QPTtlVol: return "Total Volume";
+    case QPLastVol: return "Incremental Volume";
+    case QPHigh: return "High";
+    case QPLow: return "Low";
+    case QPBid: return "Bid";
+    case QPAsk: return "Ask";
+    case QPBidSize: return "Bid Size";
+    case QPAskSize: return "Ask Size";
+    case QPTick: return "Tick";
+    case QPBidTick: return "Bid Tick";
+    case QPTradeRange: return "Range";
+    case QPLastTradeTime: return "Last Trade Time";
+    case QPOpenInterest: return "Open Interest";
+    case QPOpen: return "Open";
+    case QPClose: return "Close";
+    case QPSpread: return "Spread";
+    case QPSettle: return "Settle";
+    case QPDelay: return "Delay";
+    case QPNav: return "Net Asset Value";
+    case QPMnyMktAveMaturity: return "Average Maturity";
+    case QPMnyMkt7DayYld: return "7 Day Yield";
+    case QPLastTradeDate: return "Last Trade Date";
+    case QPExtTradeLast: return "Extended Trading Last";
+    case QPNav2: return "Net Asset Value 2";
+    case QPExtTradeChng: return "Extended Trading Change";
+    case QPExtTradeDif: return "Extended Trading Difference";
+    case QPPE: return "Price-Earnings Ratio";
+    case QPPctOff30AveVol: return "Percent Off Average Volume";
+    case QPBidChange: return "Bid Change";
+    case QPAskChange: return "Ask Change";
+    case QPChangeFromOpen: return "Change From Open";
+    case QPMarketOpen: return "Market Open";
+    case QPVolatility: return "Volatility";
+    case QPMarketCap: return "Market Capitalization";
+    case QPDisplayCode: return "Fraction Display Code";
+    case QPPrecision: return "Decimal Precision";
+    case QPDaysToExpiration: return "Days to Expiration";
+    case QPPrevDayVol: return "Previous Day Volume";
+    case QPNumTrades: return "Number of Trades Today";
+    case QPFxBidTime: return "Bid Time";
+    case QPFxAskTime: return "Ask Time";
+    case QPVWAP: return "VWAP";
+    case QPTickId: return "TickID";
+    case QPFinStatus: return "Financial Status Indicator";
+    case QPSettleDate: return "Settlement Date";
+    default: return 0;
+  }
+}
+
+template <class T, class charT>
+typename IQFPricingMessage<T, charT>::enumFieldIds IQFPricingMessage<T, charT>::FieldId( const std::string& sName ) {
+  for ( int id = QPSymbol; id < _QPLastEntry; ++id ) {
+    const char* szName = FieldName( static_cast<enumFieldIds>( id ) );
+    if ( ( 0 != szName ) && ( sName == szName ) ) return static_cast<enumFieldIds>( id );
+  }
+  return _QPLastEntry;
+}
+
 template <class T, class charT>
 ptime IQFPricingMessage<T, charT>::LastTradeTime( void ) {
     
-  fielddelimiter_t date = this->m_vFieldDelimiters[ QPLastTradeDate ];
-  fielddelimiter_t time = this->m_vFieldDelimiters[ QPLastTradeTime ];
-
-  if ( ( ( date.second - date.first ) == 10 ) && ( ( time.second - time.first ) >= 8 ) ) {
-    char szDateTime[ 20 ];
-    szDateTime[  0 ] = *(date.first + 6); // yyyy
-    szDateTime[  1 ] = *(date.first + 7);
-    szDateTime[  2 ] = *(date.first + 8);
-    szDateTime[  3 ] = *(date.first + 9);
-
-    szDateTime[  5 ] = *(date.first + 0); // mm
-    szDateTime[  6 ] = *(date.first + 1);
-
-    szDateTime[  8 ] = *(date.first + 3); // dd
-    szDateTime[  9 ] = *(date.first + 4);
-
-    szDateTime[ 11 ] = *(time.first + 0); // hh:mm:ss
-    szDateTime[ 12 ] = *(time.first + 1);
-    szDateTime[ 13 ] = *(time.first + 2);
-    szDateTime[ 14 ] = *(time.first + 3);
-    szDateTime[ 15 ] = *(time.first + 4);
-    szDateTime[ 16 ] = *(time.first + 5);
-    szDateTime[ 17 ] = *(time.first + 6);
-    szDateTime[ 18 ] = *(time.first + 7);
-
-    szDateTime[ 4 ] = szDateTime[ 7 ] = '-';
-    szDateTime[ 10 ] = ' ';
-    szDateTime[ 19 ] = 0;
-
-    return boost::posix_time::time_from_string(szDateTime);
+  boost::string_ref date = this->FieldRef( QPLastTradeDate );
+  boost::string_ref time = this->FieldRef( QPLastTradeTime );
+
+  // whole seconds, as time_from_string was given them, a fraction, when the feed sends one, is not used
+  int nYear, nMonth, nDay;
+  boost::posix_time::time_duration td;
+  if ( iqfeed::ParseDate( date.begin(), date.end(), nYear, nMonth, nDay )
+    && ( 8 <= time.size() ) && iqfeed::ParseTime( time.begin(), time.begin() + 8, td ) ) {
+    return boost::posix_time::ptime( boost::gregorian::date( nYear, nMonth, nDay ), td );
   }
   else {
     return boost::posix_time::ptime(boost::date_time::special_values::min_date_time );
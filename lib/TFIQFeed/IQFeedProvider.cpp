@@ -31,9 +31,12 @@ IQFeedProvider::IQFeedProvider( void )
   m_nID = keytypes::EProviderIQF;
   m_bProvidesQuotes = true;
   m_bProvidesTrades = true;
+  m_bProvidesDepth = true;  // 2026/10/18 through iqfeed::Level2
+  IQFeed_t::SelectUpdateFields( IQFeedSymbol::PricingFields() );  // 2026/10/18 only what IQFeedSymbol decodes
 }
 
 IQFeedProvider::~IQFeedProvider(void) {
+  IQFeed_t::SetDispatchShards( 0 );  // 2026/10/18 the shards call into this, they finish while it is whole
 }
 
 void IQFeedProvider::Connect() {
@@ -41,6 +44,7 @@ void IQFeedProvider::Connect() {
     ProviderInterfaceBase::OnConnecting( 0 );
     inherited_t::Connect();
     IQFeed_t::Connect();
+    if ( m_pLevel2 ) m_pLevel2->Connect();  // depth was watched in an earlier connection
   }
 }
 
@@ -55,6 +59,7 @@ void IQFeedProvider::Disconnect() {
     inherited_t::Disconnecting();
     ProviderInterfaceBase::OnDisconnecting( 0 );
     IQFeed_t::Disconnect();
+    if ( m_pLevel2 ) m_pLevel2->Disconnect();
     inherited_t::Disconnect();
   }
 }
@@ -108,34 +113,49 @@ void IQFeedProvider::StopTradeWatch(pSymbol_t pSymbol) {
   StopQuoteTradeWatch( dynamic_cast<IQFeedSymbol*>( pSymbol.get() ) );
 }
 
+void IQFeedProvider::StartDepthWatch( pSymbol_t pSymbol ) {
+  if ( !m_pLevel2 ) {
+    m_pLevel2.reset( new iqfeed::Level2 );
+    m_pLevel2->OnDepth.Add( MakeDelegate( this, &IQFeedProvider::HandleLevel2Depth ) );
+    m_pLevel2->Connect();
+  }
+  m_pLevel2->Watch( pSymbol->GetId() );  // sent once the port connects
+}
+
+void IQFeedProvider::StopDepthWatch( pSymbol_t pSymbol ) {
+  if ( m_pLevel2 ) m_pLevel2->Unwatch( pSymbol->GetId() );
+}
+
+void IQFeedProvider::HandleLevel2Depth( const iqfeed::Level2::Depth& depth ) {
+  const std::string& sSymbol( depth.book.sSymbol );
+  IQFeedSymbol* pSym = inherited_t::LookupSymbol( sSymbol.data(), sSymbol.size() );
+  if ( 0 != pSym ) {
+    pSym->HandleDepth( depth.depth );
+  }
+}
+
 void IQFeedProvider::OnIQFeedUpdateMessage( linebuffer_t* pBuffer, IQFUpdateMessage *pMsg ) {
-  inherited_t::mapSymbols_t::iterator mapSymbols_iter;
-  mapSymbols_iter = m_mapSymbols.find( pMsg->Field( IQFUpdateMessage::QPSymbol ) );
-  pSymbol_t pSym;
-  if ( m_mapSymbols.end() != mapSymbols_iter ) {
-    pSym = mapSymbols_iter -> second;
+  boost::string_ref sSymbol = pMsg->FieldRef( IQFUpdateMessage::QPSymbol );
+  IQFeedSymbol* pSym = inherited_t::LookupSymbol( sSymbol.data(), sSymbol.size() );
+  if ( 0 != pSym ) {
     pSym ->HandleUpdateMessage( pMsg );
   }
   this->UpdateDone( pBuffer, pMsg );
 }
 
 void IQFeedProvider::OnIQFeedSummaryMessage( linebuffer_t* pBuffer, IQFSummaryMessage *pMsg ) {
-  inherited_t::mapSymbols_t::iterator mapSymbols_iter;
-  mapSymbols_iter = m_mapSymbols.find( pMsg->Field( IQFSummaryMessage::QPSymbol ) );
-  pSymbol_t pSym;
-  if ( m_mapSymbols.end() != mapSymbols_iter ) {
-    pSym = mapSymbols_iter -> second;
+  boost::string_ref sSymbol = pMsg->FieldRef( IQFSummaryMessage::QPSymbol );
+  IQFeedSymbol* pSym = inherited_t::LookupSymbol( sSymbol.data(), sSymbol.size() );
+  if ( 0 != pSym ) {
     pSym ->HandleSummaryMessage( pMsg );
   }
   this->SummaryDone( pBuffer, pMsg );
 }
 
 void IQFeedProvider::OnIQFeedFundamentalMessage( linebuffer_t* pBuffer, IQFFundamentalMessage *pMsg ) {
-  inherited_t::mapSymbols_t::iterator mapSymbols_iter;
-  mapSymbols_iter = m_mapSymbols.find( pMsg->Field( IQFFundamentalMessage::FSymbol ) );
-  pSymbol_t pSym;
-  if ( m_mapSymbols.end() != mapSymbols_iter ) {
-    pSym = mapSymbols_iter -> second;
+  boost::string_ref sSymbol = pMsg->FieldRef( IQFFundamentalMessage::FSymbol );
+  IQFeedSymbol* pSym = inherited_t::LookupSymbol( sSymbol.data(), sSymbol.size() );
+  if ( 0 != pSym ) {
     pSym ->HandleFundamentalMessage( pMsg );
   }
   this->FundamentalDone( pBuffer, pMsg );
@@ -15,11 +15,13 @@
 #pragma once
 
 #include <boost/shared_ptr.hpp>
+#include <boost/scoped_ptr.hpp>
 
 #include "TFTrading/ProviderInterface.h"
 
 #include "IQFeed.h"
 #include "IQFeedSymbol.h"
+#include "IQFeedLevel2.h"
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
@@ -59,8 +61,11 @@ protected:
   virtual void StartTradeWatch( pSymbol_t pSymbol );
   virtual void  StopTradeWatch( pSymbol_t pSymbol );
 
-  virtual void StartDepthWatch( pSymbol_t pSymbol ) {};
-  virtual void  StopDepthWatch( pSymbol_t pSymbol ) {};
+  // 2026/10/18 depth from the level 2 port, which is connected with the first depth watch
+  //   the symbols' depth events fire on the level 2 port's network thread, not the level 1 thread of the quotes and trades,
+  //   a handler sharing state with quote or trade handlers synchronizes with them, or marshals the depth itself
+  virtual void StartDepthWatch( pSymbol_t pSymbol );
+  virtual void  StopDepthWatch( pSymbol_t pSymbol );
 
   pSymbol_t NewCSymbol( pInstrument_t pInstrument );  // used by Add/Remove x handlers in base class
 
@@ -77,6 +82,10 @@ protected:
 
 private:
 
+  boost::scoped_ptr<iqfeed::Level2> m_pLevel2;
+
+  void HandleLevel2Depth( const iqfeed::Level2::Depth& );
+
 };
 
 } // namespace tf
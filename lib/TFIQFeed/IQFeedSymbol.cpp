@@ -38,6 +38,18 @@ IQFeedSymbol::IQFeedSymbol(const symbol_id_t& sSymbol, pInstrument_t pInstrument
 IQFeedSymbol::~IQFeedSymbol(void) {
 }
 
+const IQFeedSymbol::vPricingFields_t& IQFeedSymbol::PricingFields( void ) {
+  static const IQFUpdateMessage::enumFieldIds rFields[] = {
+    IQFUpdateMessage::QPSymbol,
+    IQFUpdateMessage::QPLast, IQFUpdateMessage::QPLastVol, IQFUpdateMessage::QPLastTradeTime, IQFUpdateMessage::QPLastTradeDate,
+    IQFUpdateMessage::QPBid, IQFUpdateMessage::QPBidSize, IQFUpdateMessage::QPAsk, IQFUpdateMessage::QPAskSize,
+    IQFUpdateMessage::QPChange, IQFUpdateMessage::QPTtlVol, IQFUpdateMessage::QPHigh, IQFUpdateMessage::QPLow,
+    IQFUpdateMessage::QPOpen, IQFUpdateMessage::QPClose, IQFUpdateMessage::QPNumTrades, IQFUpdateMessage::QPOpenInterest
+  };
+  static const vPricingFields_t vFields( rFields, rFields + sizeof( rFields ) / sizeof( rFields[ 0 ] ) );
+  return vFields;
+}
+
 void IQFeedSymbol::HandleFundamentalMessage( IQFFundamentalMessage *pMsg ) {
   m_sOptionRoots = pMsg->Field( IQFFundamentalMessage::FRootOptionSymbols );
   m_AverageVolume = pMsg->Integer( IQFFundamentalMessage::FAveVolume );
@@ -67,9 +79,9 @@ void IQFeedSymbol::DecodePricingMessage( IQFPricingMessage<T> *pMsg ) {
   double dblOpen, dblBid, dblAsk;
   int nBidSize, nAskSize;
      
-  std::string sLastTradeTime = pMsg->Field( IQFPricingMessage<T>::QPLastTradeTime );
-  if ( sLastTradeTime.length() > 0 ) {
-    chType = sLastTradeTime[ sLastTradeTime.length() - 1 ];
+  boost::string_ref sLastTradeTime = pMsg->FieldRef( IQFPricingMessage<T>::QPLastTradeTime );
+  if ( !sLastTradeTime.empty() ) {
+    chType = sLastTradeTime.back();
   }
   else {
     chType = 'q';
@@ -80,22 +92,25 @@ void IQFeedSymbol::DecodePricingMessage( IQFPricingMessage<T> *pMsg ) {
     case 't':
     case 'T':
       m_dblTrade = pMsg->Double( IQFPricingMessage<T>::QPLast );
-      m_dblChange = pMsg->Double( IQFPricingMessage<T>::QPChange );
-      m_nTotalVolume = pMsg->Integer( IQFPricingMessage<T>::QPTtlVol );
       m_nTradeSize = pMsg->Integer( IQFPricingMessage<T>::QPLastVol );
-      m_dblHigh = pMsg->Double( IQFPricingMessage<T>::QPHigh );
-      m_dblLow = pMsg->Double( IQFPricingMessage<T>::QPLow );
-      m_dblClose = pMsg->Double( IQFPricingMessage<T>::QPClose );
-      m_cntTrades = pMsg->Integer( IQFPricingMessage<T>::QPNumTrades );
+      // the rest may have been left out of the selected update fields
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPChange ) ) m_dblChange = pMsg->Double( IQFPricingMessage<T>::QPChange );
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPTtlVol ) ) m_nTotalVolume = pMsg->Integer( IQFPricingMessage<T>::QPTtlVol );
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPHigh ) ) m_dblHigh = pMsg->Double( IQFPricingMessage<T>::QPHigh );
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPLow ) ) m_dblLow = pMsg->Double( IQFPricingMessage<T>::QPLow );
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPClose ) ) m_dblClose = pMsg->Double( IQFPricingMessage<T>::QPClose );
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPNumTrades ) ) m_cntTrades = pMsg->Integer( IQFPricingMessage<T>::QPNumTrades );
       m_bNewTrade = true;
 
-      dblOpen = pMsg->Double( IQFPricingMessage<T>::QPOpen );
-      if ( ( m_dblOpen != dblOpen ) && ( 0 != dblOpen ) ) { 
-        m_dblOpen = dblOpen; 
-        m_bNewOpen = true; 
-        std::cout << "IQF new open: " << GetId() << "=" << m_dblOpen << std::endl;
-      };
-      m_nOpenInterest = pMsg->Integer( IQFPricingMessage<T>::QPOpenInterest );
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPOpen ) ) {
+        dblOpen = pMsg->Double( IQFPricingMessage<T>::QPOpen );
+        if ( ( m_dblOpen != dblOpen ) && ( 0 != dblOpen ) ) { 
+          m_dblOpen = dblOpen; 
+          m_bNewOpen = true; 
+          std::cout << "IQF new open: " << GetId() << "=" << m_dblOpen << std::endl;
+        };
+      }
+      if ( pMsg->HasField( IQFPricingMessage<T>::QPOpenInterest ) ) m_nOpenInterest = pMsg->Integer( IQFPricingMessage<T>::QPOpenInterest );
 
       // fall through to processing bid / ask
     case 'q':
@@ -139,7 +154,7 @@ void IQFeedSymbol::HandleSummaryMessage( IQFSummaryMessage *pMsg ) {
 void IQFeedSymbol::HandleUpdateMessage( IQFUpdateMessage *pMsg ) {
 
   if ( qUnknown == m_QStatus ) {
-    m_QStatus = ( "Not Found" == pMsg->Field( IQFPricingMessage<IQFUpdateMessage>::QPLast ) ) ? qNotFound : qFound;
+    m_QStatus = ( "Not Found" == pMsg->FieldRef( IQFPricingMessage<IQFUpdateMessage>::QPLast ) ) ? qNotFound : qFound;
     if ( qNotFound == m_QStatus ) {
       std::cout << GetId() << " not found" << std::endl;
     }
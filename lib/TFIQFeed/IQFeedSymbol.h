@@ -82,6 +82,9 @@ public:
   ou::Delegate<IQFeedSymbol&> OnSummaryMessage;
   ou::Delegate<IQFeedSymbol&> OnNewsMessage;
 
+  typedef std::vector<IQFUpdateMessage::enumFieldIds> vPricingFields_t;
+  static const vPricingFields_t& PricingFields( void ); // the Q/P fields DecodePricingMessage reads, for IQFeed<T>::SelectUpdateFields
+
 protected:
 
   unsigned short m_cnt;  // used for watch/unwatch
@@ -101,6 +104,7 @@ protected:
   void HandleUpdateMessage( IQFUpdateMessage *pMsg );
   void HandleSummaryMessage( IQFSummaryMessage *pMsg );
   void HandleNewsMessage( IQFNewsMessage *pMsg );
+  void HandleDepth( const MarketDepth& depth ) { Symbol::m_OnDepth( depth ); };  // 2026/10/18 from iqfeed::Level2
 
   template <typename T>
   void DecodePricingMessage( IQFPricingMessage<T> *pMsg );
@@ -0,0 +1,543 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <istream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#include <boost/bind.hpp>
+
+#include "LoadGenerator.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+LoadGenerator::Security::Security( void )
+: bOption( false ), bWatched( false ),
+  nLast( 0 ), nBid( 0 ), nAsk( 0 ), nOpen( 0 ), nHigh( 0 ), nLow( 0 ), nClose( 0 ),
+  nLastSize( 0 ), nBidSize( 0 ), nAskSize( 0 ), nTotalVolume( 0 ), nTrades( 0 ), nOpenInterest( 0 ),
+  nStrike( 0 )
+{
+}
+
+LoadGenerator::LoadGenerator( const Config& config )
+: m_config( config ),
+  m_acceptor( m_io ), m_socket( m_io ), m_timer( m_io ),
+  m_nPending( 0 ), m_nWriting( 0 ), m_bWriting( false ), m_bDone( false ),
+  m_tdMarket( 9, 30, 0 ), m_dblOwed( 0.0 ), m_nSecondsReported( 0 ), m_nBurstsSpiked( 0 ),
+  m_nRandom( 2463534242u )
+{
+  m_date = boost::posix_time::microsec_clock::universal_time().date();
+  Build();
+  DefaultFields();
+}
+
+LoadGenerator::~LoadGenerator( void ) {
+  m_io.stop();
+  if ( m_thread.joinable() ) m_thread.join();
+}
+
+boost::uint32_t LoadGenerator::Random( void ) {
+  m_nRandom ^= m_nRandom << 13;
+  m_nRandom ^= m_nRandom >> 17;
+  m_nRandom ^= m_nRandom << 5;
+  return m_nRandom;
+}
+
+void LoadGenerator::Build( void ) {
+
+  for ( unsigned int ix = 0; ix < m_config.nEquities; ++ix ) {
+    Security security;
+    security.sName = "LG";
+    security.sName += static_cast<char>( 'A' + ( ix / ( 26 * 26 ) ) % 26 );
+    security.sName += static_cast<char>( 'A' + ( ix / 26 ) % 26 );
+    security.sName += static_cast<char>( 'A' + ix % 26 );
+    security.nLast = security.nOpen = security.nHigh = security.nLow = security.nClose = 1000 + Random( 19000 );
+    security.nBid = security.nLast - 1;
+    security.nAsk = security.nLast + 1;
+    security.nBidSize = 100 * ( 1 + Random( 10 ) );
+    security.nAskSize = 100 * ( 1 + Random( 10 ) );
+    m_vSecurity.push_back( security );
+  }
+
+  // weekly expiries, on the fridays after today
+  boost::gregorian::date dateExpiry( m_date );
+  while ( boost::date_time::Friday != dateExpiry.day_of_week() ) dateExpiry += boost::gregorian::days( 1 );
+  if ( m_date == dateExpiry ) dateExpiry += boost::gregorian::days( 7 );
+
+  for ( unsigned int ixUnderlying = 0; ixUnderlying < std::min( m_config.nUnderlyings, m_config.nEquities ); ++ixUnderlying ) {
+    const Security underlying( m_vSecurity[ ixUnderlying ] );
+    const boost::int64_t nStep = std::max<boost::int64_t>( 100, ( underlying.nLast / 5000 ) * 100 );  // about 2%, in whole dollars
+    const boost::int64_t nFirst = ( ( underlying.nLast / nStep ) - m_config.nStrikes / 2 ) * nStep;
+    for ( unsigned int ixExpiry = 0; ixExpiry < m_config.nExpiries; ++ixExpiry ) {
+      boost::gregorian::date date( dateExpiry + boost::gregorian::days( 7 * ixExpiry ) );
+      for ( unsigned int ixStrike = 0; ixStrike < m_config.nStrikes; ++ixStrike ) {
+        boost::int64_t nStrike = nFirst + ixStrike * nStep;
+        if ( 0 >= nStrike ) continue;
+        for ( int side = 0; side < 2; ++side ) {  // call, put
+          Security option;
+          option.bOption = true;
+          option.nStrike = nStrike;
+          option.dateExpiry = date;
+          std::stringstream ss;
+          ss << underlying.sName
+            << std::setw( 2 ) << std::setfill( '0' ) << ( date.year() % 100 )
+            << std::setw( 2 ) << std::setfill( '0' ) << date.day().as_number()
+            << static_cast<char>( ( 0 == side ? 'A' : 'M' ) + date.month().as_number() - 1 )
+            << ( nStrike / 100 );
+          if ( 0 != ( nStrike % 100 ) ) ss << "." << ( nStrike % 100 );
+          option.sName = ss.str();
+          boost::int64_t nIntrinsic = ( 0 == side ) ? underlying.nLast - nStrike : nStrike - underlying.nLast;
+          option.nLast = option.nOpen = option.nHigh = option.nLow = option.nClose
+            = std::max<boost::int64_t>( 0, nIntrinsic ) + 20 + 10 * ixExpiry + Random( 50 );
+          option.nBid = option.nLast - 2;
+          option.nAsk = option.nLast + 2;
+          option.nBidSize = 10 * ( 1 + Random( 10 ) );
+          option.nAskSize = 10 * ( 1 + Random( 10 ) );
+          option.nOpenInterest = Random( 10000 );
+          m_vSecurity.push_back( option );
+        }
+      }
+    }
+  }
+
+  for ( std::size_t ix = 0; ix < m_vSecurity.size(); ++ix ) {
+    m_vSymbolNames.push_back( m_vSecurity[ ix ].sName );
+    m_mapSymbols[ m_vSecurity[ ix ].sName ] = ix;
+  }
+}
+
+void LoadGenerator::DefaultFields( void ) {
+  // every field, in its place, as sent before fields are selected
+  m_vFields.clear();
+  for ( int id = IQFUpdateMessage::QPSymbol; id < IQFUpdateMessage::_QPLastEntry; ++id ) {
+    m_vFields.push_back( static_cast<enumFieldIds>( id ) );
+  }
+}
+
+void LoadGenerator::Start( void ) {
+  boost::asio::ip::tcp::endpoint endpoint( boost::asio::ip::address_v4::loopback(), m_config.nPort );
+  m_acceptor.open( endpoint.protocol() );
+  m_acceptor.set_option( boost::asio::ip::tcp::acceptor::reuse_address( true ) );
+  m_acceptor.bind( endpoint );
+  m_acceptor.listen();
+  m_acceptor.async_accept( m_socket, boost::bind( &LoadGenerator::OnAccept, this, boost::asio::placeholders::error ) );
+  m_thread = boost::thread( boost::bind( &boost::asio::io_service::run, &m_io ) );
+}
+
+void LoadGenerator::Wait( void ) {
+  m_thread.join();
+}
+
+void LoadGenerator::OnAccept( const boost::system::error_code& error ) {
+  m_acceptor.close();  // one client
+  if ( error ) return;
+  m_socket.set_option( boost::asio::ip::tcp::no_delay( true ) );
+
+  if ( m_config.bWatchAll ) {
+    for ( std::size_t ix = 0; ix < m_vSecurity.size(); ++ix ) {
+      m_vSecurity[ ix ].bWatched = true;
+      m_vWatched.push_back( ix );
+    }
+    m_stats.nWatched = m_vWatched.size();
+  }
+
+  m_sPending += "S,SERVER CONNECTED\r\n";
+  ++m_nPending;
+  Flush();
+
+  ReadCommand();
+
+  m_dtStart = m_dtLastTick = boost::posix_time::microsec_clock::universal_time();
+  m_timer.expires_at( m_dtLastTick + boost::posix_time::milliseconds( static_cast<long>( nTickMilliSeconds ) ) );
+  m_timer.async_wait( boost::bind( &LoadGenerator::OnTick, this, boost::asio::placeholders::error ) );
+}
+
+void LoadGenerator::ReadCommand( void ) {
+  boost::asio::async_read_until(
+    m_socket, m_bufCommands, '\n',
+    boost::bind( &LoadGenerator::OnCommand, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred ) );
+}
+
+void LoadGenerator::OnCommand( const boost::system::error_code& error, std::size_t /* bytes_transferred */ ) {
+  if ( error ) {
+    Release();  // client closed
+    return;
+  }
+  std::istream is( &m_bufCommands );
+  std::string sCommand;
+  std::getline( is, sCommand );
+  if ( !sCommand.empty() && ( '\r' == sCommand[ sCommand.size() - 1 ] ) ) sCommand.erase( sCommand.size() - 1 );
+  Command( sCommand );
+  Flush();
+  ReadCommand();
+}
+
+void LoadGenerator::Command( const std::string& sCommand ) {
+  static const std::string sSelect( "S,SELECT UPDATE FIELDS" );
+  if ( sCommand.empty() ) return;
+  switch ( sCommand[ 0 ] ) {
+    case 'w':
+      Watch( sCommand.substr( 1 ), true );
+      break;
+    case 'r':
+      Watch( sCommand.substr( 1 ), false );
+      break;
+    case 'S':
+      if ( 0 == sCommand.compare( 0, sSelect.size(), sSelect ) ) {
+        SelectFields( sCommand.substr( sSelect.size() ) );
+      }
+      break;
+    default:
+      break;  // nothing else is simulated
+  }
+}
+
+void LoadGenerator::Watch( const std::string& sSymbol, bool bWatch ) {
+  std::map<std::string, std::size_t>::const_iterator iter = m_mapSymbols.find( sSymbol );
+  if ( m_mapSymbols.end() == iter ) {
+    if ( bWatch ) ++m_stats.nUnknown;
+    return;
+  }
+  Security& security( m_vSecurity[ iter->second ] );
+  if ( bWatch ) {
+    if ( !security.bWatched ) {
+      security.bWatched = true;
+      m_vWatched.push_back( iter->second );
+      ++m_stats.nWatched;
+    }
+    AppendFundamental( security );
+    AppendPricing( 'P', security, 't', m_tdMarket + ( boost::posix_time::microsec_clock::universal_time() - m_dtStart ) );
+  }
+  else {
+    if ( security.bWatched ) {
+      security.bWatched = false;
+      std::vector<std::size_t>::iterator iterWatched = std::find( m_vWatched.begin(), m_vWatched.end(), iter->second );
+      *iterWatched = m_vWatched.back();
+      m_vWatched.pop_back();
+    }
+  }
+}
+
+void LoadGenerator::SelectFields( const std::string& sFields ) {
+  // ,name,name,...
+  m_vFields.clear();
+  m_vFields.push_back( IQFUpdateMessage::QPSymbol );
+  m_sPending += "S,CURRENT UPDATE FIELDS,Symbol";
+  std::string::size_type ixBegin = 0;
+  while ( std::string::npos != ixBegin ) {
+    std::string::size_type ixEnd = sFields.find( ',', ixBegin + 1 );
+    std::string sName( sFields.substr( ixBegin + 1, std::string::npos == ixEnd ? std::string::npos : ixEnd - ixBegin - 1 ) );
+    enumFieldIds id = IQFUpdateMessage::FieldId( sName );
+    if ( ( IQFUpdateMessage::_QPLastEntry != id ) && ( IQFUpdateMessage::QPSymbol != id ) ) {
+      m_vFields.push_back( id );
+      m_sPending += ',';
+      m_sPending += sName;
+    }
+    ixBegin = ixEnd;
+  }
+  m_sPending += "\r\n";
+  ++m_nPending;
+}
+
+void LoadGenerator::OnTick( const boost::system::error_code& error ) {
+
+  if ( error || m_bDone ) return;
+
+  boost::posix_time::ptime dtNow( boost::posix_time::microsec_clock::universal_time() );
+  boost::posix_time::time_duration tdElapsed( dtNow - m_dtStart );
+
+  if ( m_config.tdDuration <= tdElapsed ) {
+    m_bDone = true;
+    m_stats.nBacklog = m_nPending + ( m_bWriting ? m_nWriting : 0 );
+    if ( m_bWriting || !m_sPending.empty() ) {
+      Flush();  // OnWritten finishes once the backlog is written
+    }
+    else {
+      Finish();
+    }
+    return;
+  }
+
+  double dblInterval = ( dtNow - m_dtLastTick ).total_microseconds() / 1e6;
+  m_dtLastTick = dtNow;
+
+  double dblRate( m_config.dblRate );
+  if ( ( BurstNone != m_config.eBurst ) && ( 0 < m_config.tdBurstPeriod.total_microseconds() ) ) {
+    boost::int64_t nPeriod = tdElapsed.total_microseconds() / m_config.tdBurstPeriod.total_microseconds();
+    boost::int64_t nPhase = tdElapsed.total_microseconds() % m_config.tdBurstPeriod.total_microseconds();
+    switch ( m_config.eBurst ) {
+      case BurstSquare:
+        if ( nPhase < m_config.tdBurstLength.total_microseconds() ) dblRate *= m_config.dblBurstFactor;
+        break;
+      case BurstSpike:
+        if ( m_nBurstsSpiked <= nPeriod ) {
+          m_dblOwed += m_config.dblRate * ( m_config.dblBurstFactor - 1.0 ) * ( m_config.tdBurstLength.total_microseconds() / 1e6 );
+          m_nBurstsSpiked = nPeriod + 1;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  m_dblOwed += dblRate * dblInterval;
+
+  std::size_t nMessages = static_cast<std::size_t>( m_dblOwed );
+  m_dblOwed -= nMessages;
+  Generate( nMessages, m_tdMarket + tdElapsed );
+
+  while ( m_nSecondsReported < tdElapsed.total_seconds() ) {
+    ++m_nSecondsReported;
+    AppendTime( m_tdMarket + boost::posix_time::seconds( m_nSecondsReported ) );
+  }
+
+  Flush();
+
+  // scheduled from the previous expiry, so ticks don't drift, a late tick catches up by generating more
+  m_timer.expires_at( m_timer.expires_at() + boost::posix_time::milliseconds( static_cast<long>( nTickMilliSeconds ) ) );
+  m_timer.async_wait( boost::bind( &LoadGenerator::OnTick, this, boost::asio::placeholders::error ) );
+}
+
+void LoadGenerator::Generate( std::size_t nMessages, const boost::posix_time::time_duration& tdMarket ) {
+  if ( m_vWatched.empty() ) return;
+  if ( nBacklogMax < m_sPending.size() ) {
+    m_stats.nDropped += nMessages;
+    return;
+  }
+  for ( std::size_t ix = 0; ix < nMessages; ++ix ) {
+    Security& security( m_vSecurity[ m_vWatched[ Random( m_vWatched.size() ) ] ] );
+    char chTrade = Update( security );
+    AppendPricing( 'Q', security, chTrade, tdMarket );
+    ++m_stats.nUpdates;
+    if ( 't' == chTrade ) ++m_stats.nTrades;
+  }
+}
+
+char LoadGenerator::Update( Security& security ) {
+  const int nLot = security.bOption ? 10 : 100;
+  if ( Random( 100 ) < m_config.nTradePercent ) {
+    security.nLast = ( 0 == Random( 2 ) ) ? security.nBid : security.nAsk;
+    security.nLastSize = nLot * ( 1 + Random( 10 ) );
+    security.nTotalVolume += security.nLastSize;
+    ++security.nTrades;
+    security.nHigh = std::max( security.nHigh, security.nLast );
+    security.nLow = std::min( security.nLow, security.nLast );
+    return 't';
+  }
+  // the quote walks a cent at a time, one side or the other, keeping a spread of one to four cents
+  int nStep = ( 0 == Random( 2 ) ) ? 1 : -1;
+  if ( 0 == Random( 2 ) ) {
+    boost::int64_t nBid = security.nBid + nStep;
+    if ( ( 0 < nBid ) && ( nBid < security.nAsk ) && ( 4 >= ( security.nAsk - nBid ) ) ) security.nBid = nBid;
+    security.nBidSize = nLot * ( 1 + Random( 10 ) );
+    return 'b';
+  }
+  else {
+    boost::int64_t nAsk = security.nAsk + nStep;
+    if ( ( security.nBid < nAsk ) && ( 4 >= ( nAsk - security.nBid ) ) ) security.nAsk = nAsk;
+    security.nAskSize = nLot * ( 1 + Random( 10 ) );
+    return 'a';
+  }
+}
+
+void LoadGenerator::AppendPricing( char chType, const Security& security, char chTrade, const boost::posix_time::time_duration& tdMarket ) {
+  m_sPending += chType;
+  for ( vFields_t::const_iterator iter = m_vFields.begin(); m_vFields.end() != iter; ++iter ) {
+    m_sPending += ',';
+    AppendField( *iter, security, chTrade, tdMarket );
+  }
+  m_sPending += ",\r\n";
+  ++m_nPending;
+}
+
+void LoadGenerator::AppendField( enumFieldIds id, const Security& security, char chTrade, const boost::posix_time::time_duration& tdMarket ) {
+  switch ( id ) {
+    case IQFUpdateMessage::QPSymbol: m_sPending += security.sName; break;
+    case IQFUpdateMessage::QPLast: AppendPrice( security.nLast ); break;
+    case IQFUpdateMessage::QPChange: AppendPrice( security.nLast - security.nClose ); break;
+    case IQFUpdateMessage::QPPctChange: AppendPrice( ( 10000 * ( security.nLast - security.nClose ) ) / security.nClose ); break;
+    case IQFUpdateMessage::QPTtlVol: AppendNumber( security.nTotalVolume ); break;
+    case IQFUpdateMessage::QPLastVol: AppendNumber( security.nLastSize ); break;
+    case IQFUpdateMessage::QPHigh: AppendPrice( security.nHigh ); break;
+    case IQFUpdateMessage::QPLow: AppendPrice( security.nLow ); break;
+    case IQFUpdateMessage::QPBid: AppendPrice( security.nBid ); break;
+    case IQFUpdateMessage::QPAsk: AppendPrice( security.nAsk ); break;
+    case IQFUpdateMessage::QPBidSize: AppendNumber( security.nBidSize ); break;
+    case IQFUpdateMessage::QPAskSize: AppendNumber( security.nAskSize ); break;
+    case IQFUpdateMessage::QPLastTradeTime:
+      AppendTimeOfDay( tdMarket, true );
+      m_sPending += chTrade;
+      break;
+    case IQFUpdateMessage::QPOpenInterest: AppendNumber( security.nOpenInterest ); break;
+    case IQFUpdateMessage::QPOpen: AppendPrice( security.nOpen ); break;
+    case IQFUpdateMessage::QPClose: AppendPrice( security.nClose ); break;
+    case IQFUpdateMessage::QPSpread: AppendPrice( security.nAsk - security.nBid ); break;
+    case IQFUpdateMessage::QPLastTradeDate: AppendDate( m_date ); break;
+    case IQFUpdateMessage::QPMarketOpen: m_sPending += '1'; break;
+    case IQFUpdateMessage::QPPrecision: m_sPending += '2'; break;
+    case IQFUpdateMessage::QPDaysToExpiration:
+      if ( security.bOption ) AppendNumber( ( security.dateExpiry - m_date ).days() );
+      break;
+    case IQFUpdateMessage::QPNumTrades: AppendNumber( security.nTrades ); break;
+    default: break;  // left empty
+  }
+}
+
+void LoadGenerator::AppendFundamental( const Security& security ) {
+  // F,symbol, through the strike price, the rest empty
+  m_sPending += "F,";
+  m_sPending += security.sName;
+  for ( int id = IQFFundamentalMessage::FSymbol + 1; id < IQFFundamentalMessage::_FLastEntry; ++id ) {
+    m_sPending += ',';
+    switch ( id ) {
+      case IQFFundamentalMessage::FAveVolume: AppendNumber( 1000000 ); break;
+      case IQFFundamentalMessage::F52WkHi: AppendPrice( security.nClose + security.nClose / 5 ); break;
+      case IQFFundamentalMessage::F52WkLo: AppendPrice( security.nClose - security.nClose / 5 ); break;
+      case IQFFundamentalMessage::FName: m_sPending += security.bOption ? "LOAD GENERATOR OPTION" : "LOAD GENERATOR EQUITY"; break;
+      case IQFFundamentalMessage::FPrecision: m_sPending += '2'; break;
+      case IQFFundamentalMessage::FSecurityType: m_sPending += security.bOption ? '2' : '1'; break;  // IEOPTION, EQUITY
+      case IQFFundamentalMessage::FExpirationDate: if ( security.bOption ) AppendDate( security.dateExpiry ); break;
+      case IQFFundamentalMessage::FStrikePrice: if ( security.bOption ) AppendPrice( security.nStrike ); break;
+      default: break;
+    }
+  }
+  m_sPending += ",\r\n";
+  ++m_nPending;
+}
+
+void LoadGenerator::AppendTime( const boost::posix_time::time_duration& tdMarket ) {
+  // T,YYYYMMDD HH:MM:SS
+  m_sPending += "T,";
+  AppendNumber( m_date.year() * 10000 + m_date.month().as_number() * 100 + m_date.day().as_number() );
+  m_sPending += ' ';
+  AppendTimeOfDay( tdMarket, false );
+  m_sPending += "\r\n";
+  ++m_nPending;
+}
+
+void LoadGenerator::AppendNumber( boost::int64_t n ) {
+  char rBuf[ 24 ];
+  char* p = rBuf + sizeof( rBuf );
+  bool bNegative = 0 > n;
+  boost::uint64_t u = bNegative ? -static_cast<boost::uint64_t>( n ) : n;
+  do {
+    *--p = static_cast<char>( '0' + u % 10 );
+    u /= 10;
+  } while ( 0 != u );
+  if ( bNegative ) *--p = '-';
+  m_sPending.append( p, rBuf + sizeof( rBuf ) );
+}
+
+void LoadGenerator::AppendPrice( boost::int64_t nCents ) {
+  if ( 0 > nCents ) {
+    m_sPending += '-';
+    nCents = -nCents;
+  }
+  AppendNumber( nCents / 100 );
+  char rBuf[ 3 ] = { '.', static_cast<char>( '0' + ( nCents % 100 ) / 10 ), static_cast<char>( '0' + nCents % 10 ) };
+  m_sPending.append( rBuf, 3 );
+}
+
+void LoadGenerator::AppendDate( const boost::gregorian::date& date ) {
+  // MM/DD/YYYY
+  int nMonth = date.month().as_number();
+  int nDay = date.day().as_number();
+  int nYear = date.year();
+  char rBuf[ 10 ] = {
+    static_cast<char>( '0' + nMonth / 10 ), static_cast<char>( '0' + nMonth % 10 ), '/',
+    static_cast<char>( '0' + nDay / 10 ), static_cast<char>( '0' + nDay % 10 ), '/',
+    static_cast<char>( '0' + nYear / 1000 ), static_cast<char>( '0' + ( nYear / 100 ) % 10 ),
+    static_cast<char>( '0' + ( nYear / 10 ) % 10 ), static_cast<char>( '0' + nYear % 10 )
+  };
+  m_sPending.append( rBuf, 10 );
+}
+
+void LoadGenerator::AppendTimeOfDay( const boost::posix_time::time_duration& td, bool bMicroSeconds ) {
+  // HH:MM:SS[.ffffff]
+  int nHours = td.hours() % 24;
+  int nMinutes = td.minutes();
+  int nSeconds = td.seconds();
+  char rBuf[ 15 ] = {
+    static_cast<char>( '0' + nHours / 10 ), static_cast<char>( '0' + nHours % 10 ), ':',
+    static_cast<char>( '0' + nMinutes / 10 ), static_cast<char>( '0' + nMinutes % 10 ), ':',
+    static_cast<char>( '0' + nSeconds / 10 ), static_cast<char>( '0' + nSeconds % 10 ), '.'
+  };
+  if ( bMicroSeconds ) {
+    boost::int64_t nFraction = td.total_microseconds() % 1000000;
+    for ( int ix = 14; ix > 8; --ix ) {
+      rBuf[ ix ] = static_cast<char>( '0' + nFraction % 10 );
+      nFraction /= 10;
+    }
+    m_sPending.append( rBuf, 15 );
+  }
+  else {
+    m_sPending.append( rBuf, 8 );
+  }
+}
+
+void LoadGenerator::Flush( void ) {
+  if ( !m_bWriting && !m_sPending.empty() && m_socket.is_open() ) {
+    m_sWriting.swap( m_sPending );
+    m_sPending.clear();
+    m_nWriting = m_nPending;
+    m_nPending = 0;
+    m_bWriting = true;
+    boost::asio::async_write(
+      m_socket, boost::asio::buffer( m_sWriting ),
+      boost::bind( &LoadGenerator::OnWritten, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred ) );
+  }
+}
+
+void LoadGenerator::OnWritten( const boost::system::error_code& error, std::size_t bytes_transferred ) {
+  m_bWriting = false;
+  m_stats.nBytes += bytes_transferred;
+  if ( error ) {
+    Release();  // client went away
+    return;
+  }
+  m_stats.nSent += m_nWriting;
+  m_nWriting = 0;
+  Flush();
+  if ( m_bDone && !m_bWriting ) {
+    Finish();
+  }
+}
+
+void LoadGenerator::Finish( void ) {
+  m_stats.tdElapsed = boost::posix_time::microsec_clock::universal_time() - m_dtStart;
+  // as NetworkReplayServer, the client gets a moment to close its side before the connection is closed
+  boost::system::error_code error;
+  m_socket.shutdown( boost::asio::ip::tcp::socket::shutdown_send, error );
+  m_timer.expires_from_now( boost::posix_time::seconds( 1 ) );
+  m_timer.async_wait( boost::bind( &LoadGenerator::Release, this ) );
+}
+
+void LoadGenerator::Release( void ) {
+  if ( !m_bDone ) {  // ended early
+    m_bDone = true;
+    m_stats.nBacklog = m_nPending + m_nWriting;
+    m_stats.tdElapsed = boost::posix_time::microsec_clock::universal_time() - m_dtStart;
+  }
+  boost::system::error_code error;
+  m_timer.cancel( error );
+  m_socket.close( error );  // pending reads and writes are cancelled, and the thread runs out of work
+}
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
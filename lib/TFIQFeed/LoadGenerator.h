@@ -0,0 +1,199 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+// Started 2026/10/18
+
+// a stand in for IQConnect's level 1 port, generating a synthetic market, for load testing a client
+//   listens on a local port ( 5009 as IQConnect ), and serves the first client to connect
+//   the client's commands are understood as IQFeed does:
+//     wSYMBOL: F then P for the symbol, after which it is updated with Q messages
+//     rSYMBOL: no more updates
+//     S,SELECT UPDATE FIELDS,...: answered with S,CURRENT UPDATE FIELDS, Q and P messages then carry those fields
+//   a T message goes out each second
+// symbols: equities named LGAAA, LGAAB, ..., option chains on the first of them,
+//   a call and a put at each strike of each expiry, named as IQFeed does: root, yy, dd, month code, strike
+// rate: Q messages per second across the watched symbols, a share of which are trades, the rest quotes
+//   bursts multiply the rate for part of each period, or send a period's extra messages at once
+// what couldn't be written while the client was still reading is held, and counted as a backlog,
+//   so comparing what was sent with what the client handled shows where it saturates
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "IQFeedMessages.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+class LoadGenerator: boost::noncopyable {
+public:
+
+  typedef unsigned short port_t;
+
+  enum enumBurst {
+    BurstNone,   // steady
+    BurstSquare, // the rate is multiplied for the length of the burst, at the start of each period
+    BurstSpike   // the messages of a square burst all go out at the start of each period
+  };
+
+  struct Config {
+    port_t nPort;
+    unsigned int nEquities;
+    unsigned int nUnderlyings;  // equities with option chains
+    unsigned int nExpiries;  // weekly
+    unsigned int nStrikes;  // per expiry
+    double dblRate;  // Q messages per second
+    unsigned int nTradePercent;  // of the Q messages
+    enumBurst eBurst;
+    double dblBurstFactor;
+    boost::posix_time::time_duration tdBurstPeriod;
+    boost::posix_time::time_duration tdBurstLength;
+    boost::posix_time::time_duration tdDuration;  // of the run, from the connection
+    bool bWatchAll;  // every symbol is updated, without waiting for watch requests
+    Config( void )
+    : nPort( 5009 ), nEquities( 500 ), nUnderlyings( 0 ), nExpiries( 4 ), nStrikes( 20 ),
+      dblRate( 10000.0 ), nTradePercent( 20 ),
+      eBurst( BurstNone ), dblBurstFactor( 10.0 ),
+      tdBurstPeriod( boost::posix_time::seconds( 10 ) ), tdBurstLength( boost::posix_time::seconds( 1 ) ),
+      tdDuration( boost::posix_time::seconds( 30 ) ),
+      bWatchAll( false )
+    {};
+  };
+
+  struct Stats {
+    std::size_t nWatched;
+    std::size_t nUnknown;  // watch requests for symbols not generated
+    std::size_t nUpdates;  // Q messages generated
+    std::size_t nTrades;  // of the Q messages, those carrying a trade
+    std::size_t nSent;  // messages, of all types, written to the client
+    std::size_t nBytes;  // written to the client
+    std::size_t nBacklog;  // messages generated, but not yet written, when the run ended
+    std::size_t nDropped;  // messages not generated, as the backlog was at its limit
+    boost::posix_time::time_duration tdElapsed;  // from the connection until all was written
+    Stats( void ): nWatched( 0 ), nUnknown( 0 ), nUpdates( 0 ), nTrades( 0 ), nSent( 0 ), nBytes( 0 ), nBacklog( 0 ), nDropped( 0 ) {};
+  };
+
+  explicit LoadGenerator( const Config& config );
+  ~LoadGenerator( void );
+
+  const std::vector<std::string>& Symbols( void ) const { return m_vSymbolNames; };
+
+  void Start( void );  // throws when the port can't be listened on
+  void Wait( void );  // returns once the run is over, and the connection closed
+  const Stats& GetStats( void ) const { return m_stats; };  // after Wait
+
+protected:
+private:
+
+  typedef IQFUpdateMessage::enumFieldIds enumFieldIds;
+  typedef std::vector<enumFieldIds> vFields_t;
+
+  enum { nTickMilliSeconds = 1 };
+  enum { nBacklogMax = 64 * 1024 * 1024 };  // bytes
+
+  struct Security {
+    std::string sName;
+    bool bOption;
+    bool bWatched;
+    boost::int64_t nLast, nBid, nAsk;  // in cents
+    boost::int64_t nOpen, nHigh, nLow, nClose;
+    int nLastSize, nBidSize, nAskSize;
+    boost::int64_t nTotalVolume;
+    int nTrades;
+    int nOpenInterest;
+    boost::int64_t nStrike;  // options, in cents
+    boost::gregorian::date dateExpiry;  // options
+    Security( void );
+  };
+  typedef std::vector<Security> vSecurity_t;
+
+  Config m_config;
+  Stats m_stats;
+
+  vSecurity_t m_vSecurity;
+  std::vector<std::string> m_vSymbolNames;
+  std::map<std::string, std::size_t> m_mapSymbols;  // name to index into m_vSecurity
+  std::vector<std::size_t> m_vWatched;  // indexes into m_vSecurity
+
+  vFields_t m_vFields;  // of Q and P messages, after the message type
+
+  boost::asio::io_service m_io;
+  boost::asio::ip::tcp::acceptor m_acceptor;
+  boost::asio::ip::tcp::socket m_socket;
+  boost::asio::deadline_timer m_timer;
+  boost::thread m_thread;
+
+  boost::asio::streambuf m_bufCommands;
+
+  std::string m_sPending;  // messages waiting on the write in progress
+  std::size_t m_nPending;
+  std::string m_sWriting;
+  std::size_t m_nWriting;
+  bool m_bWriting;
+  bool m_bDone;  // generation over
+
+  boost::posix_time::ptime m_dtStart;
+  boost::posix_time::ptime m_dtLastTick;
+  boost::posix_time::time_duration m_tdMarket;  // simulated time of day at the start
+  boost::gregorian::date m_date;
+  double m_dblOwed;  // messages due, but not yet generated
+  long m_nSecondsReported;  // T messages sent
+  boost::int64_t m_nBurstsSpiked;
+  boost::uint32_t m_nRandom;
+
+  void Build( void );
+  void DefaultFields( void );
+
+  void OnAccept( const boost::system::error_code& error );
+  void ReadCommand( void );
+  void OnCommand( const boost::system::error_code& error, std::size_t bytes_transferred );
+  void Command( const std::string& sCommand );
+  void Watch( const std::string& sSymbol, bool bWatch );
+  void SelectFields( const std::string& sFields );
+
+  void OnTick( const boost::system::error_code& error );
+  void Generate( std::size_t nMessages, const boost::posix_time::time_duration& tdMarket );
+  char Update( Security& security );  // the kind of update: t trade, b bid, a ask
+
+  void AppendPricing( char chType, const Security& security, char chTrade, const boost::posix_time::time_duration& tdMarket );
+  void AppendFundamental( const Security& security );
+  void AppendTime( const boost::posix_time::time_duration& tdMarket );
+  void AppendField( enumFieldIds id, const Security& security, char chTrade, const boost::posix_time::time_duration& tdMarket );
+  void AppendNumber( boost::int64_t n );
+  void AppendPrice( boost::int64_t nCents );
+  void AppendDate( const boost::gregorian::date& date );
+  void AppendTimeOfDay( const boost::posix_time::time_duration& td, bool bMicroSeconds );
+
+  void Flush( void );
+  void OnWritten( const boost::system::error_code& error, std::size_t bytes_transferred );
+  void Finish( void );
+  void Release( void );
+
+  boost::uint32_t Random( void );  // xorshift, the sequence repeats from run to run
+  unsigned int Random( unsigned int n ) { return Random() % n; };
+};
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,163 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+// Started 2026/10/18
+
+// field value parsers for the feed's fixed formats, used by IQFBaseMessage on every pricing message
+//   prices and sizes are plain decimals, so they are accumulated as integers and scaled once,
+//     anything else ( exponents, nan, inf, over long mantissas ) goes to spirit, as before
+//   like qi::parse, a leading number is taken, and the value is left alone when there is none
+//   dates are MM/DD/YYYY, times HH:MM:SS, optionally .f to .ffffff, trailing characters are ignored
+//     LastTradeTime and the T message pass only HH:MM:SS, as they did to time_from_string and the facet
+// IQFeedParse ( in the repository root ) checks these against the spirit and date_time parsers they replace,
+//   and times both
+
+#include <boost/cstdint.hpp>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <boost/spirit/include/qi.hpp>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+inline bool IsDigit( char ch ) { return ( '0' <= ch ) && ( '9' >= ch ); };
+
+// n digits at p, which are known to be there
+inline int Digits( const char* p, int n ) {
+  int value = 0;
+  while ( 0 < n ) {
+    value = 10 * value + ( *p - '0' );
+    ++p;
+    --n;
+  }
+  return value;
+}
+
+inline bool AllDigits( const char* p, int n ) {
+  while ( 0 < n ) {
+    if ( !IsDigit( *p ) ) return false;
+    ++p;
+    --n;
+  }
+  return true;
+}
+
+inline bool ParseDouble( const char* begin, const char* end, double& dbl ) {
+
+  // powers of ten are exact as doubles through 1e22
+  static const double rPow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+  };
+
+  const char* p = begin;
+  bool bNegative = false;
+  if ( ( p != end ) && ( ( '-' == *p ) || ( '+' == *p ) ) ) {
+    bNegative = ( '-' == *p );
+    ++p;
+  }
+
+  boost::uint64_t n = 0;
+  int nDigits = 0;
+  int nFraction = 0;
+  while ( ( p != end ) && IsDigit( *p ) ) {
+    n = 10 * n + ( *p - '0' );
+    ++nDigits;
+    ++p;
+  }
+  if ( ( p != end ) && ( '.' == *p ) ) {
+    ++p;
+    while ( ( p != end ) && IsDigit( *p ) ) {
+      n = 10 * n + ( *p - '0' );
+      ++nDigits;
+      ++nFraction;
+      ++p;
+    }
+  }
+
+  // mantissas of up to 15 digits are exact, so one division rounds correctly
+  if ( ( 0 == nDigits ) || ( 15 < nDigits ) || ( ( p != end ) && ( ( 'e' == *p ) || ( 'E' == *p ) ) ) ) {
+    namespace qi = boost::spirit::qi;
+    return qi::parse( begin, end, qi::double_, dbl );
+  }
+
+  double value = static_cast<double>( n );
+  if ( 0 != nFraction ) value /= rPow10[ nFraction ];
+  dbl = bNegative ? -value : value;
+  return true;
+}
+
+inline bool ParseInteger( const char* begin, const char* end, int& value ) {
+
+  const char* p = begin;
+  bool bNegative = false;
+  if ( ( p != end ) && ( ( '-' == *p ) || ( '+' == *p ) ) ) {
+    bNegative = ( '-' == *p );
+    ++p;
+  }
+
+  int n = 0;
+  int nDigits = 0;
+  while ( ( p != end ) && IsDigit( *p ) ) {
+    if ( 9 == nDigits ) { // may not fit, spirit knows the limits
+      namespace qi = boost::spirit::qi;
+      return qi::parse( begin, end, qi::int_, value );
+    }
+    n = 10 * n + ( *p - '0' );
+    ++nDigits;
+    ++p;
+  }
+  if ( 0 == nDigits ) return false;
+
+  value = bNegative ? -n : n;
+  return true;
+}
+
+// MM/DD/YYYY, the numbers are not range checked, the feed uses 99 and 9999 for none
+inline bool ParseDate( const char* begin, const char* end, int& nYear, int& nMonth, int& nDay ) {
+  if ( 10 != ( end - begin ) ) return false;
+  if ( !AllDigits( begin + 0, 2 ) || !AllDigits( begin + 3, 2 ) || !AllDigits( begin + 6, 4 ) ) return false;
+  nMonth = Digits( begin + 0, 2 );
+  nDay = Digits( begin + 3, 2 );
+  nYear = Digits( begin + 6, 4 );
+  return true;
+}
+
+// HH:MM:SS[.ffffff]
+inline bool ParseTime( const char* begin, const char* end, boost::posix_time::time_duration& td ) {
+  if ( 8 > ( end - begin ) ) return false;
+  if ( ( ':' != begin[ 2 ] ) || ( ':' != begin[ 5 ] ) ) return false;
+  if ( !AllDigits( begin + 0, 2 ) || !AllDigits( begin + 3, 2 ) || !AllDigits( begin + 6, 2 ) ) return false;
+  boost::int64_t nMicroSeconds = 0;
+  const char* p = begin + 8;
+  if ( ( p != end ) && ( '.' == *p ) ) {
+    ++p;
+    int nScale = 100000;
+    while ( ( p != end ) && IsDigit( *p ) && ( 0 != nScale ) ) {
+      nMicroSeconds += nScale * ( *p - '0' );
+      nScale /= 10;
+      ++p;
+    }
+  }
+  td = boost::posix_time::time_duration( Digits( begin + 0, 2 ), Digits( begin + 3, 2 ), Digits( begin + 6, 2 ) )
+     + boost::posix_time::microseconds( nMicroSeconds );
+  return true;
+}
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
@@ -39,10 +39,12 @@ OBJECTFILES= \
 	${OBJECTDIR}/BuildSymbolName.o \
 	${OBJECTDIR}/CurlGetMktSymbols.o \
 	${OBJECTDIR}/IQFeed.o \
+	${OBJECTDIR}/IQFeedLevel2.o \
 	${OBJECTDIR}/IQFeedMessages.o \
 	${OBJECTDIR}/IQFeedProvider.o \
 	${OBJECTDIR}/IQFeedSymbol.o \
 	${OBJECTDIR}/InMemoryMktSymbolList.o \
+	${OBJECTDIR}/LoadGenerator.o \
 	${OBJECTDIR}/LoadMktSymbols.o \
 	${OBJECTDIR}/MarketSymbol.o \
 	${OBJECTDIR}/MarketSymbols.o \
@@ -100,6 +102,11 @@ ${OBJECTDIR}/IQFeed.o: IQFeed.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/IQFeed.o IQFeed.cpp
 
+${OBJECTDIR}/IQFeedLevel2.o: IQFeedLevel2.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/IQFeedLevel2.o IQFeedLevel2.cpp
+
 ${OBJECTDIR}/IQFeedMessages.o: IQFeedMessages.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -120,6 +127,11 @@ ${OBJECTDIR}/InMemoryMktSymbolList.o: InMemoryMktSymbolList.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/InMemoryMktSymbolList.o InMemoryMktSymbolList.cpp
 
+${OBJECTDIR}/LoadGenerator.o: LoadGenerator.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/LoadGenerator.o LoadGenerator.cpp
+
 ${OBJECTDIR}/LoadMktSymbols.o: LoadMktSymbols.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -43,6 +43,18 @@ void ExpiryBundle::SaveSeries( const std::string& sPrefix60sec, const std::strin
   SaveAtmIv( sPrefix60sec, sPrefix86400sec );
 }
 
+void ExpiryBundle::RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix60sec, bool bRetain ) {
+  for ( mapStrikes_t::iterator iter = m_mapStrikes.begin(); m_mapStrikes.end() != iter; ++iter ) {
+    iter->second.RecordSeries( writer, sPrefix60sec, bRetain );
+  }
+}
+
+void ExpiryBundle::StopRecording( void ) {
+  for ( mapStrikes_t::iterator iter = m_mapStrikes.begin(); m_mapStrikes.end() != iter; ++iter ) {
+    iter->second.StopRecording();
+  }
+}
+
 void ExpiryBundle::SaveAtmIv( const std::string& sPrefix60sec, const std::string& sPrefix86400sec ) {
 
   std::string sPathName;
@@ -489,6 +501,20 @@ void ExpiryBundleWithUnderlying::SaveSeries( const std::string& sPrefix60sec, co
 //  SaveAtmIv( sPrefix60sec, sPrefix86400sec );
 }
 
+void ExpiryBundleWithUnderlying::RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix60sec, bool bRetain ) {
+  if ( ( 0 != m_pwatchUnderlying.get() ) && !m_pwatchUnderlying->Recording() ) {
+    m_pwatchUnderlying->RecordSeries( writer, sPrefix60sec, bRetain );
+  }
+  ExpiryBundle::RecordSeries( writer, sPrefix60sec, bRetain );
+}
+
+void ExpiryBundleWithUnderlying::StopRecording( void ) {
+  if ( 0 != m_pwatchUnderlying.get() ) {
+    m_pwatchUnderlying->StopRecording();
+  }
+  ExpiryBundle::StopRecording();
+}
+
 //=====================================
 
 MultiExpiryBundle::~MultiExpiryBundle( void ) {
@@ -80,6 +80,10 @@ public:
   void SaveSeries( const std::string& sPrefix60sec, const std::string& sPrefix86400sec );
   void EmitValues( void );
 
+  // options of the strikes known so far write their series as they arrive, SaveSeries then flushes them
+  void RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix60sec, bool bRetain = false );
+  void StopRecording( void );
+
   void SetExpiry( ptime dt ); // utc
 
   void CalcGreeks( double dblUnderlying, double dblVolHistorical, ptime now, ou::tf::LiborFromIQFeed& libor );
@@ -138,6 +142,9 @@ public:
 
   void SaveSeries( const std::string& sPrefix60sec, const std::string& sPrefix86400sec );
 
+  void RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix60sec, bool bRetain = false );
+  void StopRecording( void );
+
 protected:
 private:
   pWatch_t m_pwatchUnderlying;
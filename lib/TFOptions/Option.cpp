@@ -16,6 +16,7 @@
 
 #include <TFHDF5TimeSeries/HDF5DataManager.h>
 #include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesAppender.h>
 #include <TFHDF5TimeSeries/HDF5IterateGroups.h>
 #include <TFHDF5TimeSeries/HDF5Attribute.h>
 
@@ -27,33 +28,34 @@ namespace option { // options
 
 Option::Option( pInstrument_t pInstrument, pProvider_t pDataProvider, pProvider_t pGreekProvider )
 : Watch( pInstrument, pDataProvider ),
-  m_pGreekProvider( pGreekProvider ),
+  m_sSide( "-" ),
   m_dblStrike( pInstrument->GetStrike() ),
-  m_sSide( "-" )
+  m_pGreekProvider( pGreekProvider ), m_pGreekAppender( 0 )
 {
   Initialize();
 }
 
 Option::Option( pInstrument_t pInstrument, pProvider_t pDataProvider )
 : Watch( pInstrument, pDataProvider ),
-  m_dblStrike( pInstrument->GetStrike() ),
-  m_sSide( "-" )
+  m_sSide( "-" ),
+  m_dblStrike( pInstrument->GetStrike() ), m_pGreekAppender( 0 )
 {
   Initialize();
 }
 
 Option::Option( const Option& rhs ) :
   Watch( rhs ),
+  m_sSide( rhs.m_sSide ),
   m_dblStrike( rhs.m_dblStrike ),
   m_greek( rhs.m_greek ),
-  m_sSide( rhs.m_sSide ),
-  m_pGreekProvider( rhs.m_pGreekProvider )
+  m_pGreekProvider( rhs.m_pGreekProvider ), m_pGreekAppender( 0 )
 {
   Initialize();
 }
 
 Option::~Option( void ) {
 //  StopWatch();  // issues here
+  StopRecording();  // here, so the greeks, and the option attributes, are handled
 }
 
 Option& Option::operator=( const Option& rhs ) {
@@ -179,7 +181,10 @@ void Option::EmitValues( void ) {
 
 void Option::HandleGreek( const Greek& greek ) {
   m_greek = greek;
-  m_greeks.Append( greek );
+  if ( 0 != m_pGreekAppender ) m_pGreekAppender->Append( greek );
+  if ( m_bRetainSeries ) {
+    m_greeks.Append( greek );
+  }
   OnGreek( greek );
 }
 
@@ -191,28 +196,35 @@ void Option::SaveSeries( const std::string& sPrefix ) {
 
   std::string sPathName;
 
-  HDF5Attributes::structOption option( 
-    m_dblStrike, m_pInstrument->GetExpiryYear(), m_pInstrument->GetExpiryMonth(), m_pInstrument->GetExpiryDay(), m_pInstrument->GetOptionSide() );
+  Watch::SaveSeries( sPrefix );  // option attributes are added to the quotes and trades by SetSeriesAttributes
 
-  Watch::SaveSeries( sPrefix );
+  try {
+    if ( 0 != m_pGreekAppender ) { // already on disk, with attributes
+      m_pGreekAppender->Flush();
+    }
+    // 2026/10/18 as Watch::SaveSeries, retained greeks are written as well when sPrefix is not the recording's
+    if ( ( 0 == m_pGreekAppender ) || ( m_bRetainSeries && ( sPrefix != RecordPrefix() ) ) ) {
+      if ( 0 != m_greeks.Size() ) {
+        ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+        sPathName = sPrefix + "/greeks/" + m_pInstrument->GetInstrumentName();
+        HDF5WriteTimeSeries<ou::tf::Greeks> wtsGreeks( dm, true, true, 5, 256 );
+        wtsGreeks.Write( sPathName, &m_greeks );
+        SetSeriesAttributes( dm, sPathName, ou::tf::Greek::Signature() );
+      }
+    }
+  }
+  catch (...) {
+    std::cout << "Option::SaveSeries error: " << sPrefix << std::endl;
+  }
 
-  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+}
 
-  // add in option attributes to the already written quotes and trades.
-  if ( 0 != m_quotes.Size() ) {
-    sPathName = sPrefix + "/quotes/" + m_pInstrument->GetInstrumentName();
-    HDF5Attributes attrGreeks( dm, sPathName, option );
-  }
+void Option::SetSeriesAttributes( HDF5DataManager& dm, const std::string& sPathName, boost::uint64_t signature ) {
 
-  if ( 0 != m_trades.Size() ) {
-    sPathName = sPrefix + "/trades/" + m_pInstrument->GetInstrumentName();
-    HDF5Attributes attrGreeks( dm, sPathName, option );
-  }
+  HDF5Attributes::structOption option( 
+    m_dblStrike, m_pInstrument->GetExpiryYear(), m_pInstrument->GetExpiryMonth(), m_pInstrument->GetExpiryDay(), m_pInstrument->GetOptionSide() );
 
-  if ( 0 != m_greeks.Size() ) {
-    sPathName = sPrefix + "/greeks/" + m_pInstrument->GetInstrumentName();
-    HDF5WriteTimeSeries<ou::tf::Greeks> wtsGreeks( dm, true, true, 5, 256 );
-    wtsGreeks.Write( sPathName, &m_greeks );
+  if ( ou::tf::Greek::Signature() == signature ) {
     HDF5Attributes attrGreeks( dm, sPathName, option );
     attrGreeks.SetSignature( ou::tf::Greek::Signature() );
     attrGreeks.SetMultiplier( m_pInstrument->GetMultiplier() );
@@ -224,7 +236,32 @@ void Option::SaveSeries( const std::string& sPrefix ) {
       attrGreeks.SetProviderType( ou::tf::keytypes::EProviderCalc );
     }
   }
+  else {
+    Watch::SetSeriesAttributes( dm, sPathName, signature );
+    HDF5Attributes attrOption( dm, sPathName, option );
+  }
+
+}
 
+void Option::RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix, bool bRetain ) {
+  Watch::RecordSeries( writer, sPrefix, bRetain );
+  m_pGreekAppender = new HDF5TimeSeriesAppender<Greek>( 
+    writer, sPrefix + "/greeks/" + m_pInstrument->GetInstrumentName(), 256, 5, MakeDelegate( this, &Option::HandleGreeksCreated ) );
+}
+
+void Option::StopRecording( void ) {
+  delete m_pGreekAppender;
+  m_pGreekAppender = 0;
+  Watch::StopRecording();
+}
+
+// writer thread
+void Option::HandleGreeksCreated( HDF5DataManager& dm, const std::string& sPathName ) {
+  try {
+    SetSeriesAttributes( dm, sPathName, ou::tf::Greek::Signature() );
+  }
+  catch (...) {  // may already exist
+  }
 }
 
 
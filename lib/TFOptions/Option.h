@@ -73,6 +73,10 @@ public:
 
   void SaveSeries( const std::string& sPrefix );
 
+  // greeks are recorded along with the quotes and trades
+  void RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix, bool bRetain = false );
+  void StopRecording( void );
+
 protected:
 
   std::string m_sSide;
@@ -84,9 +88,15 @@ protected:
 
   pProvider_t m_pGreekProvider;
 
+  // adds the option attributes, greeks are attributed to the greek provider
+  void SetSeriesAttributes( HDF5DataManager& dm, const std::string& sPathName, boost::uint64_t signature );
+
 private:
 
+  HDF5TimeSeriesAppender<Greek>* m_pGreekAppender;
+
   void Initialize( void );
+  void HandleGreeksCreated( HDF5DataManager& dm, const std::string& sPathName );
 
   void HandleGreek( const Greek& greek );
   void AppendGreek( const ou::tf::Greek& greek );
@@ -100,6 +100,16 @@ void Strike::SaveSeries( const std::string& sPrefix ) {
   if ( 0 != m_put.get()  ) m_put->SaveSeries( sPrefix );
 }
 
+void Strike::RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix, bool bRetain ) {
+  if ( ( 0 != m_call.get() ) && !m_call->Recording() ) m_call->RecordSeries( writer, sPrefix, bRetain );
+  if ( ( 0 != m_put.get()  ) && !m_put->Recording()  ) m_put->RecordSeries( writer, sPrefix, bRetain );
+}
+
+void Strike::StopRecording( void ) {
+  if ( 0 != m_call.get() ) m_call->StopRecording();
+  if ( 0 != m_put.get()  ) m_put->StopRecording();
+}
+
 void Strike::SetWatchableOn( void ) {
   if ( !m_bWatchable ) {
     m_bWatchable = true;
@@ -54,6 +54,8 @@ public:
   bool IsWatching( void ) const { return 0 != m_nWatching; };
 
   void SaveSeries( const std::string& sPrefix );
+  void RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix, bool bRetain = false ); // options assigned so far
+  void StopRecording( void );
   void EmitValues( void );
 
 protected:
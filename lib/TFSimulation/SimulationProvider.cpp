@@ -16,8 +16,11 @@
 
 #include <stdexcept>
 #include <cassert>
+#include <cstdio>
 
 #include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesStream.h>
+#include <TFHDF5TimeSeries/HDF5ParallelLoader.h>
 #include <TFTrading/KeyTypes.h>
 
 #include "SimulationProvider.h"
@@ -27,7 +30,8 @@ namespace tf { // TradeFrame
 
 SimulationProvider::SimulationProvider(void)
 : ProviderInterface<SimulationProvider,SimulationSymbol>(), 
-  m_pMerge( 0 )
+  m_pMerge( 0 ), m_bUseMergeCache( false ),
+  m_nStreamChunkSize( 0 ), m_pLoader( 0 )
 {
   m_sName = "Simulator";
   m_nID = keytypes::EProviderSimulator;
@@ -44,6 +48,10 @@ SimulationProvider::~SimulationProvider(void) {
     delete m_pMerge;
     m_pMerge = NULL;
   }
+  if ( 0 != m_pLoader ) { // after the merge, as its carriers use the loader
+    delete m_pLoader;
+    m_pLoader = 0;
+  }
 }
 
 void SimulationProvider::SetGroupDirectory( const std::string sGroupDirectory ) {
@@ -78,15 +86,51 @@ void SimulationProvider::Disconnect() {
   }
 }
 
+void SimulationProvider::SetStreamingChunkSize( std::size_t nChunkSize ) {
+  if ( 0 != m_pMerge ) throw std::runtime_error( "SetStreamingChunkSize: simulation has been run" );
+  m_nStreamChunkSize = nChunkSize;
+  for ( mapSymbols_t::iterator iter = m_mapSymbols.begin(); m_mapSymbols.end() != iter; ++iter ) {
+    iter->second->m_bStream = ( 0 != nChunkSize ); // series already loaded are still merged from memory
+  }
+}
+
 SimulationProvider::pSymbol_t SimulationProvider::NewCSymbol( SimulationSymbol::pInstrument_t pInstrument ) {
   pSymbol_t pSymbol( new SimulationSymbol(pInstrument->GetInstrumentName(), pInstrument, m_sGroupDirectory) );
   pSymbol->m_simExec.SetOnOrderFill( MakeDelegate( this, &SimulationProvider::HandleExecution ) );
   pSymbol->m_simExec.SetOnCommission( MakeDelegate( this, &SimulationProvider::HandleCommission ) );
   pSymbol->m_simExec.SetOnOrderCancelled( MakeDelegate( this, &SimulationProvider::HandleCancellation ) );
+  pSymbol->m_bStream = ( 0 != m_nStreamChunkSize );
   inherited_t::AddCSymbol( pSymbol );
   return pSymbol;
 }
 
+void SimulationProvider::Preload( const std::vector<pInstrument_t>& vInstrument, OnPreloadProgress_t progress, unsigned int nThreads ) {
+  if ( 0 == m_sGroupDirectory.size() ) throw std::invalid_argument( "Group Directory is empty" );
+  HDF5DataManager dm( HDF5DataManager::RO );
+  HDF5ParallelLoader loader( dm );
+  for ( std::vector<pInstrument_t>::const_iterator iter = vInstrument.begin(); vInstrument.end() != iter; ++iter ) {
+    pSymbol_t pSymbol;
+    inherited_t::mapSymbols_t::iterator iterSymbol = m_mapSymbols.find( (*iter)->GetInstrumentName( m_nID ) );
+    if ( m_mapSymbols.end() == iterSymbol ) {
+      pSymbol = inherited_t::Add( *iter );
+    }
+    else {
+      pSymbol = iterSymbol->second;
+    }
+    // anything already loaded is left as is
+    if ( 0 == pSymbol->m_quotes.Size() ) {
+      loader.Add( pSymbol->m_sDirectory + "/quotes/" + pSymbol->GetId(), pSymbol->m_quotes );
+    }
+    if ( 0 == pSymbol->m_trades.Size() ) {
+      loader.Add( pSymbol->m_sDirectory + "/trades/" + pSymbol->GetId(), pSymbol->m_trades );
+    }
+    if ( ( 0 == pSymbol->m_greeks.Size() ) && ( (*iter)->IsOption() ) ) {
+      loader.Add( pSymbol->m_sDirectory + "/greeks/" + pSymbol->GetId(), pSymbol->m_greeks );
+    }
+  }
+  loader.Load( nThreads, progress );
+}
+
 void SimulationProvider::AddQuoteHandler( pInstrument_cref pInstrument, SimulationSymbol::quotehandler_t handler ) {
   inherited_t::AddQuoteHandler( pInstrument, handler );
   inherited_t::mapSymbols_t::iterator iter;
@@ -172,11 +216,128 @@ void SimulationProvider::StopGreekWatch( pSymbol_t pSymbol ) {
   pSymbol->StopGreekWatch();
 }
 
+namespace {
+  // fnv-1a, stable across builds, as the key is persisted
+  boost::uint64_t HashKey( const std::string& s ) {
+    boost::uint64_t hash( 14695981039346656037ULL );
+    for ( std::string::const_iterator iter = s.begin(); s.end() != iter; ++iter ) {
+      hash ^= (unsigned char) *iter;
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  // 2026/10/18 the series just added: its size, and the times it spans, so a series rewritten to the same length gets another key
+  void KeySeries( std::ostream& ssKey, const char* szKind, const std::string& sName, const MergeDatedDatums& merge ) {
+    const MergeCarrierBase& carrier( merge.Carrier( merge.Carriers() - 1 ) );
+    ssKey
+      << szKind << sName << ":" << carrier.Size()
+      << ":" << boost::posix_time::to_iso_string( carrier.FirstDateTime() )
+      << ":" << boost::posix_time::to_iso_string( carrier.LastDateTime() ) << ";";
+  }
+
+  const char szScheduleKey[] = "key";  // the whole key, on the schedule, the path only has its hash
+}
+
+bool SimulationProvider::LoadMergeSchedule( const std::string& sPath, const std::string& sKey, MergeDatedDatums::vSchedule_t& vSchedule ) {
+  bool bLoaded( false );
+  boost::unique_lock<boost::mutex> lock;  // the stream loader may be reading in the background
+  if ( 0 != m_pLoader ) lock = boost::unique_lock<boost::mutex>( m_pLoader->MutexHDF5() );
+  try {
+    HDF5DataManager dm( HDF5DataManager::RO );
+    const std::string sGroup( sPath.substr( 0, sPath.rfind( '/' ) ) );
+    if ( dm.GroupExists( sGroup ) && ( 0 < H5Lexists( dm.GetH5File()->getId(), sPath.c_str(), H5P_DEFAULT ) ) ) {
+      H5::DataSet dataset( dm.GetH5File()->openDataSet( sPath ) );
+      std::string sSaved;
+      if ( dataset.attrExists( szScheduleKey ) ) {
+        H5::Attribute attribute( dataset.openAttribute( szScheduleKey ) );
+        H5::StrType type( attribute.getStrType() );
+        attribute.read( type, sSaved );
+        type.close();
+        attribute.close();
+      }
+      if ( sKey == sSaved ) { // otherwise the hash collided, or the schedule predates the full key
+        H5::DataSpace dataspace( dataset.getSpace() );
+        vSchedule.resize( dataspace.getSimpleExtentNpoints() );
+        if ( 0 != vSchedule.size() ) {
+          dataset.read( &vSchedule[0], H5::PredType::NATIVE_UINT16 );
+        }
+        dataspace.close();
+        bLoaded = true;
+      }
+      dataset.close();
+    }
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "SimulationProvider::LoadMergeSchedule " << sPath << ": " << e.getDetailMsg() << std::endl;
+  }
+  return bLoaded;
+}
+
+void SimulationProvider::SaveMergeSchedule( const std::string& sPath, const std::string& sKey, const MergeDatedDatums::vSchedule_t& vSchedule ) {
+  boost::unique_lock<boost::mutex> lock;
+  if ( 0 != m_pLoader ) lock = boost::unique_lock<boost::mutex>( m_pLoader->MutexHDF5() );
+  try {
+    HDF5DataManager dm( HDF5DataManager::RDWR );
+    dm.AddGroup( sPath );
+    hsize_t nSize( vSchedule.size() );
+    hsize_t nChunk( std::min<hsize_t>( nSize, 64 * 1024 ) );
+    H5::DataSpace dataspace( 1, &nSize );
+    H5::DSetCreatPropList pl;
+    pl.setChunk( 1, &nChunk );
+    pl.setShuffle();
+    pl.setDeflate( 5 );  // carrier ids run in long repeats, compresses well
+    H5::DataSet dataset( dm.GetH5File()->createDataSet( sPath, H5::PredType::NATIVE_UINT16, dataspace, pl ) );
+    dataset.write( &vSchedule[0], H5::PredType::NATIVE_UINT16 );
+    H5::StrType type( H5::PredType::C_S1, sKey.size() );
+    H5::DataSpace dspace( H5S_SCALAR );
+    H5::Attribute attribute( dataset.createAttribute( szScheduleKey, type, dspace ) );
+    attribute.write( type, sKey );
+    attribute.close();
+    dspace.close();
+    type.close();
+    dataset.close();
+    dataspace.close();
+  }
+  catch ( H5::Exception& e ) {
+    std::cout << "SimulationProvider::SaveMergeSchedule " << sPath << ": " << e.getDetailMsg() << std::endl;
+  }
+}
+
+template<typename DD>
+std::size_t SimulationProvider::AddStream( const std::string& sPath, FastDelegate1<const DD&> handler ) {
+  std::size_t nSize( 0 );
+  try {
+    HDF5MergeCarrier<DD>* pCarrier( new HDF5MergeCarrier<DD>( *m_pLoader, sPath, m_nStreamChunkSize, handler ) );
+    nSize = pCarrier->Size();
+    if ( 0 == nSize ) {
+      delete pCarrier;
+    }
+    else {
+      m_pMerge->Add( pCarrier );
+    }
+  }
+  catch ( std::runtime_error &e ) {
+    // couldn't open, so nothing to stream
+  }
+  catch ( H5::Exception& e ) {  // 2026/10/18 nor when the library fails on it
+    std::cout << "SimulationProvider::AddStream " << sPath << ": " << e.getDetailMsg() << std::endl;
+  }
+  return nSize;
+}
+
 // root of background simulation thread, thread is started from Run.
 void SimulationProvider::Merge( void ) {
 
   if ( 0 != m_OnSimulationThreadStarted ) m_OnSimulationThreadStarted();
 
+  std::stringstream ssKey;  // identifies the series, in order of Add, for the schedule cache
+
+  if ( 0 != m_nStreamChunkSize ) {
+    // writable when caching, so the schedule can be saved while the loader has the file open
+    m_pLoader = new HDF5StreamLoader( m_bUseMergeCache ? HDF5DataManager::RDWR : HDF5DataManager::RO );
+  }
+
   // for each of the symbols, add the quote, trade and greek series
   // datums from each series will be merged and emitted in chronological order
   for ( mapSymbols_t::iterator iter = m_mapSymbols.begin();
@@ -189,21 +350,42 @@ void SimulationProvider::Merge( void ) {
       if ( 0 != quotes.Size() ) {
         m_pMerge -> Add( 
           quotes, 
-          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleQuoteEvent ) );
+          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleQuote ) );
+        KeySeries( ssKey, "q:", iter->first, *m_pMerge );
+      }
+      else if ( ( 0 != m_pLoader ) && sym->m_bQuoteWatch ) {
+        std::size_t nSize = AddStream<Quote>( 
+          sym->m_sDirectory + "/quotes/" + sym->GetId(), 
+          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleQuote ) );
+        if ( 0 != nSize ) KeySeries( ssKey, "q:", iter->first, *m_pMerge );
       }
 
       Trades& trades( sym->m_trades );
       if ( 0 != trades.Size() ) {
         m_pMerge -> Add( 
           trades, 
-          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleTradeEvent ) );
+          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleTrade ) );
+        KeySeries( ssKey, "t:", iter->first, *m_pMerge );
+      }
+      else if ( ( 0 != m_pLoader ) && sym->m_bTradeWatch ) {
+        std::size_t nSize = AddStream<Trade>( 
+          sym->m_sDirectory + "/trades/" + sym->GetId(), 
+          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleTrade ) );
+        if ( 0 != nSize ) KeySeries( ssKey, "t:", iter->first, *m_pMerge );
       }
 
       Greeks& greeks( sym->m_greeks );
       if ( 0 != greeks.Size() ) {
         m_pMerge -> Add(
           greeks,
-          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleGreekEvent ) );
+          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleGreek ) );
+        KeySeries( ssKey, "g:", iter->first, *m_pMerge );
+      }
+      else if ( ( 0 != m_pLoader ) && sym->m_bGreekWatch ) {
+        std::size_t nSize = AddStream<Greek>( 
+          sym->m_sDirectory + "/greeks/" + sym->GetId(), 
+          MakeDelegate( iter->second.get(), &SimulationSymbol::HandleGreek ) );
+        if ( 0 != nSize ) KeySeries( ssKey, "g:", iter->first, *m_pMerge );
       }
 
   }
@@ -214,7 +396,31 @@ void SimulationProvider::Merge( void ) {
   bool bOldMode = ou::TimeSource::LocalCommonInstance().GetSimulationMode();
   ou::TimeSource::LocalCommonInstance().SetSimulationMode();
 
-  m_pMerge -> Run();
+  if ( m_bUseMergeCache ) {
+    std::string sKey( ssKey.str() );
+    char szKey[ 24 ];
+    std::sprintf( szKey, "/%016llx", (unsigned long long) HashKey( sKey ) );
+    std::string sPath( "/cache/merge" + m_sGroupDirectory + szKey );
+    MergeDatedDatums::vSchedule_t vSchedule;
+    if ( LoadMergeSchedule( sPath, sKey, vSchedule ) && m_pMerge->Validate( vSchedule ) ) {
+      m_pMerge->Replay( vSchedule );
+    }
+    else {
+      try {
+        m_pMerge->Run( vSchedule );
+        if ( !vSchedule.empty() && m_pMerge->Validate( vSchedule ) ) { // a stopped run is incomplete, don't keep it
+          SaveMergeSchedule( sPath, sKey, vSchedule );
+        }
+      }
+      catch ( std::runtime_error& e ) { // too many series to record, nothing has been merged yet
+        std::cout << e.what() << std::endl;
+        m_pMerge -> Run();
+      }
+    }
+  }
+  else {
+    m_pMerge -> Run();
+  }
 
   m_nProcessedDatums = m_pMerge->GetCountProcessedDatums();
   m_dtSimStop = ou::TimeSource::LocalCommonInstance().External();
@@ -246,10 +452,10 @@ void SimulationProvider::Run( bool bAsync ) {
 
 void SimulationProvider::EmitStats( std::stringstream& ss ) {
   boost::posix_time::time_duration dur = m_dtSimStop - m_dtSimStart;
-  unsigned long nDuration = dur.total_seconds();
-  unsigned long nDatumsPerSecond = m_nProcessedDatums / nDuration;
+  double dblDuration = (double) dur.total_microseconds() / 1000000.0; // short runs are sub-second
+  unsigned long nDatumsPerSecond = ( 0.0 < dblDuration ) ? (unsigned long) ( (double) m_nProcessedDatums / dblDuration ) : 0;
 //  ss << m_nProcessedDatums << " datums in " << nDuration << " seconds, " << nDatumsPerSecond << " datums/second." << std::endl;
-    ss << m_nProcessedDatums << " datums in " << nDuration << " seconds, " << nDatumsPerSecond << " datums/second.";
+    ss << m_nProcessedDatums << " datums in " << dblDuration << " seconds, " << nDatumsPerSecond << " datums/second.";
 }
 
 // at some point:  run, stop, pause, resume, reset
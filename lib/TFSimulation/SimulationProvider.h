@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <sstream>
 
 #include <boost/shared_ptr.hpp>
@@ -28,12 +29,15 @@ using namespace fastdelegate;
 #include <TFTrading/ProviderInterface.h>
 #include <TFTrading/Order.h>
 #include <TFTimeSeries/MergeDatedDatums.h>
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
 
 #include "SimulationSymbol.h"
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+class HDF5StreamLoader;
+
 // simulation provider needs to send an open event on each symbol it does
 //  will need to be based upon time
 // looks like MergeDatedDatums will need an OnOpen event simulated
@@ -41,6 +45,14 @@ namespace tf { // TradeFrame
 // 20100821:  todo: provide cache mechanism for multiple runs
 //    first time through, use the minheap, 
 //    subsequent times through, scan a vector
+// 2026/10/18 done, see SetUseMergeCache:
+//    the merge schedule is saved under /cache/merge/<group directory>/ in the hdf5 file,
+//    keyed by the series being simulated, so parameter sweeps over a day replay it
+// 2026/10/18 SetStreamingChunkSize:
+//    series are read in chunks by a background thread while the merge runs, rather than
+//    loaded whole in Start*Watch, memory is then bounded by 2 x chunk size x number of series
+// 2026/10/18 Preload:
+//    loads the series for a list of instruments concurrently, rather than one at a time in Start*Watch
 
 class SimulationProvider
 : public ProviderInterface<SimulationProvider,SimulationSymbol>
@@ -62,6 +74,13 @@ public:
   void SetGroupDirectory( const std::string sGroupDirectory );  // eg /basket/20080620
   const std::string &GetGroupDirectory( void ) { return m_sGroupDirectory; };
 
+  void SetUseMergeCache( bool bUseMergeCache ) { m_bUseMergeCache = bUseMergeCache; }; // requires writable hdf5 file
+  void SetStreamingChunkSize( std::size_t nChunkSize ); // datums per read, 0 (default) loads whole series, 1024 is reasonable
+
+  typedef FastDelegate2<std::size_t, std::size_t> OnPreloadProgress_t; // series processed, series total
+  // symbols are added as required, Start*Watch then finds the series already loaded, nThreads 0 is one per core
+  void Preload( const std::vector<pInstrument_t>& vInstrument, OnPreloadProgress_t progress = 0, unsigned int nThreads = 0 );
+
   void Run( bool bAsync = true );
   void Stop( void );
   void PlaceOrder( pOrder_t pOrder );
@@ -103,6 +122,10 @@ protected:
   std::string m_sGroupDirectory;
 
   MergeDatedDatums* m_pMerge;
+  bool m_bUseMergeCache;
+
+  std::size_t m_nStreamChunkSize;
+  HDF5StreamLoader* m_pLoader;  // streaming mode only, outlives the carriers in m_pMerge
 
   OnSimulationThreadStarted_t m_OnSimulationThreadStarted;
   OnSimulationThreadEnded_t m_OnSimulationThreadEnded;
@@ -110,6 +133,12 @@ protected:
 
   void Merge( void );  // the background thread
 
+  bool LoadMergeSchedule( const std::string& sPath, const std::string& sKey, MergeDatedDatums::vSchedule_t& ); // false when saved under another key
+  void SaveMergeSchedule( const std::string& sPath, const std::string& sKey, const MergeDatedDatums::vSchedule_t& );
+
+  template<typename DD>
+  std::size_t AddStream( const std::string& sPath, FastDelegate1<const DD&> handler ); // returns series size, 0 if not added
+
   void HandleExecution( Order::idOrder_t orderId, const Execution &exec );
   void HandleCommission( Order::idOrder_t orderId, double commission );
   void HandleCancellation( Order::idOrder_t orderId );
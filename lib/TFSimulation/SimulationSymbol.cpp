@@ -28,7 +28,8 @@ SimulationSymbol::SimulationSymbol(
   pInstrument_cref pInstrument, 
   const std::string &sGroup
   ) 
-: Symbol<SimulationSymbol>(pInstrument), m_sDirectory( sGroup )
+: Symbol<SimulationSymbol>(pInstrument), m_sDirectory( sGroup ),
+  m_bStream( false ), m_bQuoteWatch( false ), m_bTradeWatch( false ), m_bGreekWatch( false )
 {
   // this is dealt with in the SimulationProvider, but we don't have a .Remove
   //m_OnTrade.Add( MakeDelegate( &m_simExec, &CSimulateOrderExecution::NewTrade ) );
@@ -41,7 +42,8 @@ SimulationSymbol::~SimulationSymbol(void) {
 }
 
 void SimulationSymbol::StartTradeWatch( void ) {
-  if ( 0 == m_trades.Size() ) {
+  m_bTradeWatch = true;
+  if ( !m_bStream && ( 0 == m_trades.Size() ) ) {
     try {
       std::string sPath( m_sDirectory + "/trades/" + GetId() );
       ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RO );
@@ -62,7 +64,8 @@ void SimulationSymbol::StopTradeWatch( void ) {
 }
 
 void SimulationSymbol::StartQuoteWatch( void ) {
-  if ( 0 == m_quotes.Size() ) {
+  m_bQuoteWatch = true;
+  if ( !m_bStream && ( 0 == m_quotes.Size() ) ) {
     try {
       std::string sPath( m_sDirectory + "/quotes/" + GetId() );
       ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RO );
@@ -83,7 +86,8 @@ void SimulationSymbol::StopQuoteWatch( void ) {
 }
 
 void SimulationSymbol::StartGreekWatch( void ) {
-  if ( ( 0 == m_greeks.Size() ) && ( m_pInstrument->IsOption() ) )  {
+  m_bGreekWatch = m_pInstrument->IsOption();
+  if ( !m_bStream && ( 0 == m_greeks.Size() ) && ( m_pInstrument->IsOption() ) )  {
     try {
       std::string sPath( m_sDirectory + "/greeks/" + GetId() );
       ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RO );
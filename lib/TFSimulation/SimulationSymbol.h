@@ -57,8 +57,18 @@ protected:
   void HandleQuoteEvent( const DatedDatum &datum );
   void HandleGreekEvent( const DatedDatum &datum );
 
+  // typed, used by the merge, no dynamic_cast per datum
+  void HandleTrade( const Trade& trade ) { m_OnTrade( trade ); };
+  void HandleQuote( const Quote& quote ) { m_OnQuote( quote ); };
+  void HandleGreek( const Greek& greek ) { m_OnGreek( greek ); };
+
   std::string m_sDirectory;
 
+  bool m_bStream; // set by the provider, series are streamed during the merge rather than loaded here
+  bool m_bQuoteWatch;
+  bool m_bTradeWatch;
+  bool m_bGreekWatch;
+
   Quotes m_quotes;
   Trades m_trades;
   Greeks m_greeks;
@@ -0,0 +1,357 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// struct-of-arrays variant of TimeSeries<T> for Quote, Trade, Bar
+//   each field is held in its own contiguous vector, so scans which only need
+//   a price or a size column don't drag timestamps, other fields and the vtable
+//   pointer through cache.
+// intended for offline/batch scanning (Scanner, SymbolSelection, InstrumentFilter),
+//   not as a replacement for TimeSeries<T> in the live path.
+// the kernels in namespace columnar are written as plain loops over raw arrays
+//   with independent accumulators so the optimizer can vectorize them.
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+
+#include <boost/cstdint.hpp>
+
+#include "DatedDatum.h"
+#include "DatedDatumPod.h"
+#include "TimeSeries.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace columnar {
+
+typedef DatedDatum::price_t price_t;
+typedef DatedDatum::volume_t volume_t;
+typedef pod::epoch_t timestamp_t;  // nanoseconds since 1970/01/01 00:00:00
+
+// kernels work on [begin, begin+n), n must be > 0 for Min/Max/Range
+
+inline price_t Min( const price_t* __restrict p, size_t n ) {
+  assert( 0 < n );
+  price_t m0( p[0] ), m1( p[0] ), m2( p[0] ), m3( p[0] );
+  size_t ix( 0 );
+  for ( ; ix + 4 <= n; ix += 4 ) {
+    m0 = p[ix+0] < m0 ? p[ix+0] : m0;
+    m1 = p[ix+1] < m1 ? p[ix+1] : m1;
+    m2 = p[ix+2] < m2 ? p[ix+2] : m2;
+    m3 = p[ix+3] < m3 ? p[ix+3] : m3;
+  }
+  for ( ; ix < n; ++ix ) m0 = p[ix] < m0 ? p[ix] : m0;
+  m0 = m1 < m0 ? m1 : m0;
+  m2 = m3 < m2 ? m3 : m2;
+  return m2 < m0 ? m2 : m0;
+}
+
+inline price_t Max( const price_t* __restrict p, size_t n ) {
+  assert( 0 < n );
+  price_t m0( p[0] ), m1( p[0] ), m2( p[0] ), m3( p[0] );
+  size_t ix( 0 );
+  for ( ; ix + 4 <= n; ix += 4 ) {
+    m0 = p[ix+0] > m0 ? p[ix+0] : m0;
+    m1 = p[ix+1] > m1 ? p[ix+1] : m1;
+    m2 = p[ix+2] > m2 ? p[ix+2] : m2;
+    m3 = p[ix+3] > m3 ? p[ix+3] : m3;
+  }
+  for ( ; ix < n; ++ix ) m0 = p[ix] > m0 ? p[ix] : m0;
+  m0 = m1 > m0 ? m1 : m0;
+  m2 = m3 > m2 ? m3 : m2;
+  return m2 > m0 ? m2 : m0;
+}
+
+// max - min, in a single pass
+inline std::pair<price_t,price_t> Range( const price_t* __restrict p, size_t n ) {
+  assert( 0 < n );
+  price_t mn0( p[0] ), mn1( p[0] ), mx0( p[0] ), mx1( p[0] );
+  size_t ix( 0 );
+  for ( ; ix + 2 <= n; ix += 2 ) {
+    mn0 = p[ix+0] < mn0 ? p[ix+0] : mn0;
+    mn1 = p[ix+1] < mn1 ? p[ix+1] : mn1;
+    mx0 = p[ix+0] > mx0 ? p[ix+0] : mx0;
+    mx1 = p[ix+1] > mx1 ? p[ix+1] : mx1;
+  }
+  if ( ix < n ) {
+    mn0 = p[ix] < mn0 ? p[ix] : mn0;
+    mx0 = p[ix] > mx0 ? p[ix] : mx0;
+  }
+  return std::pair<price_t,price_t>( mn1 < mn0 ? mn1 : mn0, mx1 > mx0 ? mx1 : mx0 );
+}
+
+inline price_t Sum( const price_t* __restrict p, size_t n ) {
+  price_t s0( 0.0 ), s1( 0.0 ), s2( 0.0 ), s3( 0.0 );
+  size_t ix( 0 );
+  for ( ; ix + 4 <= n; ix += 4 ) {
+    s0 += p[ix+0];
+    s1 += p[ix+1];
+    s2 += p[ix+2];
+    s3 += p[ix+3];
+  }
+  for ( ; ix < n; ++ix ) s0 += p[ix];
+  return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+inline boost::uint64_t Sum( const volume_t* __restrict p, size_t n ) {
+  boost::uint64_t s( 0 );
+  for ( size_t ix = 0; ix < n; ++ix ) s += p[ix];
+  return s;
+}
+
+// sum( price * volume ) / sum( volume ), 0.0 if no volume
+inline price_t VWAP( const price_t* __restrict pPrice, const volume_t* __restrict pVolume, size_t n ) {
+  price_t pv0( 0.0 ), pv1( 0.0 ), v0( 0.0 ), v1( 0.0 );
+  size_t ix( 0 );
+  for ( ; ix + 2 <= n; ix += 2 ) {
+    const price_t vol0( static_cast<price_t>( pVolume[ix+0] ) );
+    const price_t vol1( static_cast<price_t>( pVolume[ix+1] ) );
+    pv0 += pPrice[ix+0] * vol0;
+    pv1 += pPrice[ix+1] * vol1;
+    v0 += vol0;
+    v1 += vol1;
+  }
+  if ( ix < n ) {
+    const price_t vol( static_cast<price_t>( pVolume[ix] ) );
+    pv0 += pPrice[ix] * vol;
+    v0 += vol;
+  }
+  const price_t v( v0 + v1 );
+  return ( 0.0 == v ) ? 0.0 : ( pv0 + pv1 ) / v;
+}
+
+} // namespace columnar
+
+// Layout describes how a datum type is split into, and rebuilt from, columns
+
+template<typename T> struct ColumnarLayout;
+
+template<>
+struct ColumnarLayout<Quote> {
+  enum EPrice { Bid, Ask, nPrice };
+  enum EVolume { BidSize, AskSize, nVolume };
+  static void Split( const Quote& quote, columnar::price_t* pPrice, columnar::volume_t* pVolume ) {
+    pPrice[ Bid ] = quote.Bid();
+    pPrice[ Ask ] = quote.Ask();
+    pVolume[ BidSize ] = quote.BidSize();
+    pVolume[ AskSize ] = quote.AskSize();
+  }
+  static Quote Join( const ptime& dt, const columnar::price_t* pPrice, const columnar::volume_t* pVolume ) {
+    return Quote( dt, pPrice[ Bid ], pVolume[ BidSize ], pPrice[ Ask ], pVolume[ AskSize ] );
+  }
+};
+
+template<>
+struct ColumnarLayout<Trade> {
+  enum EPrice { Price, nPrice };
+  enum EVolume { Volume, nVolume };
+  static void Split( const Trade& trade, columnar::price_t* pPrice, columnar::volume_t* pVolume ) {
+    pPrice[ Price ] = trade.Price();
+    pVolume[ Volume ] = trade.Volume();
+  }
+  static Trade Join( const ptime& dt, const columnar::price_t* pPrice, const columnar::volume_t* pVolume ) {
+    return Trade( dt, pPrice[ Price ], pVolume[ Volume ] );
+  }
+};
+
+template<>
+struct ColumnarLayout<Bar> {
+  enum EPrice { Open, High, Low, Close, nPrice };
+  enum EVolume { Volume, nVolume };
+  static void Split( const Bar& bar, columnar::price_t* pPrice, columnar::volume_t* pVolume ) {
+    pPrice[ Open ] = bar.Open();
+    pPrice[ High ] = bar.High();
+    pPrice[ Low ] = bar.Low();
+    pPrice[ Close ] = bar.Close();
+    pVolume[ Volume ] = bar.Volume();
+  }
+  static Bar Join( const ptime& dt, const columnar::price_t* pPrice, const columnar::volume_t* pVolume ) {
+    return Bar( dt, pPrice[ Open ], pPrice[ High ], pPrice[ Low ], pPrice[ Close ], pVolume[ Volume ] );
+  }
+};
+
+template<typename T>
+class ColumnarTimeSeries {
+public:
+
+  typedef T datum_t;
+  typedef ColumnarLayout<T> layout_t;
+  typedef typename layout_t::EPrice EPrice;
+  typedef typename layout_t::EVolume EVolume;
+
+  typedef columnar::price_t price_t;
+  typedef columnar::volume_t volume_t;
+  typedef columnar::timestamp_t timestamp_t;
+
+  typedef std::vector<timestamp_t> vTime_t;
+  typedef std::vector<price_t> vPrice_t;
+  typedef std::vector<volume_t> vVolume_t;
+
+  typedef typename vTime_t::size_type size_type;
+
+  ColumnarTimeSeries( void ) {};
+  ColumnarTimeSeries( size_type nSize ) { Reserve( nSize ); };
+  ColumnarTimeSeries( const TimeSeries<T>& series ) { Assign( series ); };
+  virtual ~ColumnarTimeSeries( void ) {};
+
+  size_type Size( void ) const { return m_vTime.size(); };
+
+  void Clear( void );
+  void Reserve( size_type n );
+  void Append( const T& datum );
+  void Assign( const TimeSeries<T>& series );  // replaces content
+
+  T At( size_type ix ) const;
+  T operator[]( size_type ix ) const { return At( ix ); };
+  T Ago( size_type ix ) const;  // 0 is most recent
+  ptime DateTime( size_type ix ) const { return pod::FromEpoch( m_vTime[ ix ] ); };
+
+  // return indexes, Size() when not found; assumes sorted by time
+  size_type AtOrAfter( const ptime& dt ) const;
+  size_type After( const ptime& dt ) const;
+
+  // raw column access for custom kernels
+  const timestamp_t* Times( void ) const { return m_vTime.data(); };
+  const price_t* Prices( EPrice ePrice ) const { return m_rvPrice[ ePrice ].data(); };
+  const volume_t* Volumes( EVolume eVolume ) const { return m_rvVolume[ eVolume ].data(); };
+
+  // kernels over [ixBegin, ixEnd)
+  price_t Min( EPrice, size_type ixBegin, size_type ixEnd ) const;
+  price_t Max( EPrice, size_type ixBegin, size_type ixEnd ) const;
+  price_t Range( EPrice, size_type ixBegin, size_type ixEnd ) const;  // max - min
+  price_t Sum( EPrice, size_type ixBegin, size_type ixEnd ) const;
+  boost::uint64_t Sum( EVolume, size_type ixBegin, size_type ixEnd ) const;
+  price_t VWAP( EPrice, EVolume, size_type ixBegin, size_type ixEnd ) const;
+
+protected:
+private:
+  vTime_t m_vTime;
+  vPrice_t m_rvPrice[ layout_t::nPrice ];
+  vVolume_t m_rvVolume[ layout_t::nVolume ];
+};
+
+template<typename T>
+void ColumnarTimeSeries<T>::Clear( void ) {
+  m_vTime.clear();
+  for ( vPrice_t& v: m_rvPrice ) v.clear();
+  for ( vVolume_t& v: m_rvVolume ) v.clear();
+}
+
+template<typename T>
+void ColumnarTimeSeries<T>::Reserve( size_type n ) {
+  m_vTime.reserve( n );
+  for ( vPrice_t& v: m_rvPrice ) v.reserve( n );
+  for ( vVolume_t& v: m_rvVolume ) v.reserve( n );
+}
+
+template<typename T>
+void ColumnarTimeSeries<T>::Append( const T& datum ) {
+  price_t rPrice[ layout_t::nPrice ];
+  volume_t rVolume[ layout_t::nVolume ];
+  layout_t::Split( datum, rPrice, rVolume );
+  m_vTime.push_back( pod::ToEpoch( datum.DateTime() ) );
+  for ( int ix = 0; ix < layout_t::nPrice; ++ix ) m_rvPrice[ ix ].push_back( rPrice[ ix ] );
+  for ( int ix = 0; ix < layout_t::nVolume; ++ix ) m_rvVolume[ ix ].push_back( rVolume[ ix ] );
+}
+
+template<typename T>
+void ColumnarTimeSeries<T>::Assign( const TimeSeries<T>& series ) {
+  Clear();
+  Reserve( series.Size() );
+  for ( typename TimeSeries<T>::const_iterator iter = series.begin(); series.end() != iter; ++iter ) {
+    Append( *iter );
+  }
+}
+
+template<typename T>
+T ColumnarTimeSeries<T>::At( size_type ix ) const {
+  assert( ix < m_vTime.size() );
+  price_t rPrice[ layout_t::nPrice ];
+  volume_t rVolume[ layout_t::nVolume ];
+  for ( int col = 0; col < layout_t::nPrice; ++col ) rPrice[ col ] = m_rvPrice[ col ][ ix ];
+  for ( int col = 0; col < layout_t::nVolume; ++col ) rVolume[ col ] = m_rvVolume[ col ][ ix ];
+  return layout_t::Join( pod::FromEpoch( m_vTime[ ix ] ), rPrice, rVolume );
+}
+
+template<typename T>
+T ColumnarTimeSeries<T>::Ago( size_type ix ) const {
+  assert( ix < m_vTime.size() );
+  return At( m_vTime.size() - 1 - ix );
+}
+
+template<typename T>
+typename ColumnarTimeSeries<T>::size_type ColumnarTimeSeries<T>::AtOrAfter( const ptime& dt ) const {
+  return std::lower_bound( m_vTime.begin(), m_vTime.end(), pod::ToEpoch( dt ) ) - m_vTime.begin();
+}
+
+template<typename T>
+typename ColumnarTimeSeries<T>::size_type ColumnarTimeSeries<T>::After( const ptime& dt ) const {
+  return std::upper_bound( m_vTime.begin(), m_vTime.end(), pod::ToEpoch( dt ) ) - m_vTime.begin();
+}
+
+template<typename T>
+typename ColumnarTimeSeries<T>::price_t ColumnarTimeSeries<T>::Min( EPrice ePrice, size_type ixBegin, size_type ixEnd ) const {
+  assert( ixBegin < ixEnd );
+  assert( ixEnd <= m_vTime.size() );
+  return columnar::Min( Prices( ePrice ) + ixBegin, ixEnd - ixBegin );
+}
+
+template<typename T>
+typename ColumnarTimeSeries<T>::price_t ColumnarTimeSeries<T>::Max( EPrice ePrice, size_type ixBegin, size_type ixEnd ) const {
+  assert( ixBegin < ixEnd );
+  assert( ixEnd <= m_vTime.size() );
+  return columnar::Max( Prices( ePrice ) + ixBegin, ixEnd - ixBegin );
+}
+
+template<typename T>
+typename ColumnarTimeSeries<T>::price_t ColumnarTimeSeries<T>::Range( EPrice ePrice, size_type ixBegin, size_type ixEnd ) const {
+  assert( ixBegin < ixEnd );
+  assert( ixEnd <= m_vTime.size() );
+  std::pair<price_t,price_t> minmax = columnar::Range( Prices( ePrice ) + ixBegin, ixEnd - ixBegin );
+  return minmax.second - minmax.first;
+}
+
+template<typename T>
+typename ColumnarTimeSeries<T>::price_t ColumnarTimeSeries<T>::Sum( EPrice ePrice, size_type ixBegin, size_type ixEnd ) const {
+  assert( ixBegin <= ixEnd );
+  assert( ixEnd <= m_vTime.size() );
+  return columnar::Sum( Prices( ePrice ) + ixBegin, ixEnd - ixBegin );
+}
+
+template<typename T>
+boost::uint64_t ColumnarTimeSeries<T>::Sum( EVolume eVolume, size_type ixBegin, size_type ixEnd ) const {
+  assert( ixBegin <= ixEnd );
+  assert( ixEnd <= m_vTime.size() );
+  return columnar::Sum( Volumes( eVolume ) + ixBegin, ixEnd - ixBegin );
+}
+
+template<typename T>
+typename ColumnarTimeSeries<T>::price_t ColumnarTimeSeries<T>::VWAP( EPrice ePrice, EVolume eVolume, size_type ixBegin, size_type ixEnd ) const {
+  assert( ixBegin <= ixEnd );
+  assert( ixEnd <= m_vTime.size() );
+  return columnar::VWAP( Prices( ePrice ) + ixBegin, Volumes( eVolume ) + ixBegin, ixEnd - ixBegin );
+}
+
+typedef ColumnarTimeSeries<Quote> ColumnarQuotes;
+typedef ColumnarTimeSeries<Trade> ColumnarTrades;
+typedef ColumnarTimeSeries<Bar> ColumnarBars;
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,291 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <limits>
+#include <algorithm>
+#include <iterator>
+
+#include "DailyBarPanel.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+
+  const double dblMissing = std::numeric_limits<double>::quiet_NaN();
+
+  const DailyBarPanel::size_type c_nSpare = 64;  // rows kept free at the end of each column, about three months of days
+
+  const pod::epoch_t nsDay = pod::epoch_t( 86400 ) * 1000000000;
+
+  const boost::gregorian::date dateEpoch( 1970, 1, 1 );
+
+  DailyBarPanel::day_t EpochToDay( pod::epoch_t nTime ) {
+    pod::epoch_t nDays = nTime / nsDay;
+    if ( nTime < nDays * nsDay ) --nDays;
+    return static_cast<DailyBarPanel::day_t>( nDays );
+  }
+
+} // namespace anonymous
+
+const DailyBarPanel::size_type DailyBarPanel::npos;
+
+DailyBarPanel::DailyBarPanel( void )
+: m_nStride( 0 ), m_nStaged( 0 ), m_nMarkedSymbols( 0 ), m_nMarkedDates( 0 ), m_ixDirty( npos )
+{
+}
+
+DailyBarPanel::~DailyBarPanel( void ) {
+}
+
+DailyBarPanel::day_t DailyBarPanel::ToDay( const boost::gregorian::date& date ) {
+  return static_cast<day_t>( ( date - dateEpoch ).days() );
+}
+
+boost::gregorian::date DailyBarPanel::FromDay( day_t day ) {
+  return dateEpoch + boost::gregorian::days( day );
+}
+
+DailyBarPanel::size_type DailyBarPanel::LowerBound( const boost::gregorian::date& date ) const {
+  return std::lower_bound( m_vDay.begin(), m_vDay.end(), ToDay( date ) ) - m_vDay.begin();
+}
+
+DailyBarPanel::size_type DailyBarPanel::FindSymbol( const std::string& sSymbol ) const {
+  mapSymbol_t::const_iterator iter = m_mapSymbol.find( sSymbol );
+  return ( m_mapSymbol.end() == iter ) ? npos : iter->second;
+}
+
+DailyBarPanel::Column DailyBarPanel::GetColumn( size_type ixSymbol, size_type ixDateBegin, size_type ixDateEnd ) const {
+  Column column;
+  column.ixSymbol = ixSymbol;
+  column.ixBegin = ixDateBegin;
+  column.n = ( ixDateBegin < ixDateEnd ) ? ixDateEnd - ixDateBegin : 0;
+  for ( int ix = 0; ix < nFields; ++ix ) {
+    column.p[ ix ] = Field( static_cast<enumField>( ix ), ixSymbol ) + ixDateBegin;
+  }
+  column.ixFirst = column.ixLast = column.n;
+  const size_type ixFirst = m_vFirst[ ixSymbol ];
+  const size_type ixLast = m_vLast[ ixSymbol ];
+  if ( ( npos != ixFirst ) && ( ixFirst < ixDateEnd ) && ( ixLast >= ixDateBegin ) ) {
+    // the ends are bars, rows between them may be gaps
+    const double* pClose = column.p[ fClose ];
+    size_type ix = std::max( ixFirst, ixDateBegin ) - ixDateBegin;
+    while ( Missing( pClose[ ix ] ) ) ++ix;
+    column.ixFirst = ix;
+    ix = std::min( ixLast, ixDateEnd - 1 ) - ixDateBegin;
+    while ( Missing( pClose[ ix ] ) ) --ix;
+    column.ixLast = ix;
+  }
+  return column;
+}
+
+void DailyBarPanel::Select( size_type ixDateBegin, size_type ixDateEnd, filter_t f, std::vector<size_type>& v,
+  size_type ixSymbolBegin, size_type ixSymbolEnd ) const
+{
+  ixSymbolEnd = std::min( ixSymbolEnd, Symbols() );
+  ixDateEnd = std::min( ixDateEnd, Dates() );
+  for ( size_type ixSymbol = ixSymbolBegin; ixSymbol < ixSymbolEnd; ++ixSymbol ) {
+    if ( f( GetColumn( ixSymbol, ixDateBegin, ixDateEnd ) ) ) v.push_back( ixSymbol );
+  }
+}
+
+void DailyBarPanel::Bars( size_type ixSymbol, size_type ixDateBegin, size_type ixDateEnd, ou::tf::Bars& bars ) const {
+  bars.Clear();
+  const Column column( GetColumn( ixSymbol, ixDateBegin, std::min( ixDateEnd, Dates() ) ) );
+  if ( column.Empty() ) return;
+  bars.Reserve( column.ixLast - column.ixFirst + 1 );
+  for ( size_type ix = column.ixFirst; ix <= column.ixLast; ++ix ) {
+    if ( !Missing( column.Close()[ ix ] ) ) {
+      bars.Append( ou::tf::Bar(
+        boost::posix_time::ptime( Date( column.ixBegin + ix ) ),
+        column.Open()[ ix ], column.High()[ ix ], column.Low()[ ix ], column.Close()[ ix ],
+        static_cast<ou::tf::Bar::volume_t>( column.Volume()[ ix ] ) ) );
+    }
+  }
+}
+
+void DailyBarPanel::Add( const std::string& sSymbol, const pod::Bar* begin, const pod::Bar* end, const boost::posix_time::ptime& dtThrough ) {
+  m_vStaging.push_back( Staging() );
+  Staging& staging( m_vStaging.back() );
+  staging.sSymbol = sSymbol;
+  staging.vBar.assign( begin, end );
+  staging.dtThrough = dtThrough;
+  m_nStaged += ( end - begin );
+}
+
+void DailyBarPanel::Merge( void ) {
+
+  if ( m_vStaging.empty() ) return;
+
+  // the days of the staged bars, added to the date axis
+  vDay_t vNew;
+  for ( vStaging_t::const_iterator iter = m_vStaging.begin(); m_vStaging.end() != iter; ++iter ) {
+    for ( std::vector<pod::Bar>::const_iterator iterBar = iter->vBar.begin(); iter->vBar.end() != iterBar; ++iterBar ) {
+      vNew.push_back( EpochToDay( iterBar->Epoch() ) );
+    }
+  }
+  std::sort( vNew.begin(), vNew.end() );
+  vNew.erase( std::unique( vNew.begin(), vNew.end() ), vNew.end() );
+  vDay_t vDay;
+  vDay.reserve( m_vDay.size() + vNew.size() );
+  std::set_union( m_vDay.begin(), m_vDay.end(), vNew.begin(), vNew.end(), std::back_inserter( vDay ) );
+  if ( vDay.size() != m_vDay.size() ) {
+    const bool bAppend = std::equal( m_vDay.begin(), m_vDay.end(), vDay.begin() );
+    if ( bAppend && ( vDay.size() <= m_nStride ) ) {
+      m_vDay.swap( vDay ); // the spare rows are already NaN
+    }
+    else {
+      Layout( vDay, vDay.size() + c_nSpare );
+    }
+  }
+
+  for ( vStaging_t::const_iterator iter = m_vStaging.begin(); m_vStaging.end() != iter; ++iter ) {
+    size_type ixSymbol = FindSymbol( iter->sSymbol );
+    if ( npos == ixSymbol ) ixSymbol = AddSymbol( iter->sSymbol );
+    const size_type ixColumn = ixSymbol * m_nStride;
+    vDay_t::iterator iterDay = m_vDay.begin();
+    for ( std::vector<pod::Bar>::const_iterator iterBar = iter->vBar.begin(); iter->vBar.end() != iterBar; ++iterBar ) {
+      iterDay = std::lower_bound( iterDay, m_vDay.end(), EpochToDay( iterBar->Epoch() ) ); // bars are in time order
+      const size_type ixRow = iterDay - m_vDay.begin();
+      m_vField[ fOpen ][ ixColumn + ixRow ] = iterBar->Open();
+      m_vField[ fHigh ][ ixColumn + ixRow ] = iterBar->High();
+      m_vField[ fLow ][ ixColumn + ixRow ] = iterBar->Low();
+      m_vField[ fClose ][ ixColumn + ixRow ] = iterBar->Close();
+      m_vField[ fVolume ][ ixColumn + ixRow ] = static_cast<double>( iterBar->Volume() );
+      if ( ( npos == m_vFirst[ ixSymbol ] ) || ( ixRow < m_vFirst[ ixSymbol ] ) ) m_vFirst[ ixSymbol ] = ixRow;
+      if ( ( npos == m_vLast[ ixSymbol ] ) || ( ixRow > m_vLast[ ixSymbol ] ) ) m_vLast[ ixSymbol ] = ixRow;
+      Dirty( ixSymbol, ixRow );
+    }
+    if ( m_vThrough[ ixSymbol ].is_special() || ( iter->dtThrough > m_vThrough[ ixSymbol ] ) ) {
+      m_vThrough[ ixSymbol ] = iter->dtThrough;
+    }
+  }
+
+  m_vStaging.clear();
+  m_nStaged = 0;
+}
+
+// the columns are copied to the new date axis, which holds all the days of the current one
+void DailyBarPanel::Layout( const vDay_t& vDay, size_type nStride ) {
+  vRow_t vMap( m_vDay.size() );  // old row to new row
+  size_type ixMoved = npos;
+  vDay_t::const_iterator iterDay = vDay.begin();
+  for ( size_type ix = 0; ix < m_vDay.size(); ++ix ) {
+    iterDay = std::lower_bound( iterDay, vDay.end(), m_vDay[ ix ] );
+    vMap[ ix ] = iterDay - vDay.begin();
+    if ( ( npos == ixMoved ) && ( vMap[ ix ] != ix ) ) ixMoved = ix;
+  }
+  const size_type nSymbols = Symbols();
+  for ( int ixField = 0; ixField < nFields; ++ixField ) {
+    vField_t v( nSymbols * nStride, dblMissing );
+    for ( size_type ixSymbol = 0; ixSymbol < nSymbols; ++ixSymbol ) {
+      const double* pFrom = &m_vField[ ixField ][ ixSymbol * m_nStride ];
+      double* pTo = &v[ ixSymbol * nStride ];
+      if ( npos == ixMoved ) {
+        std::copy( pFrom, pFrom + m_vDay.size(), pTo );
+      }
+      else {
+        for ( size_type ix = 0; ix < m_vDay.size(); ++ix ) pTo[ vMap[ ix ] ] = pFrom[ ix ];
+      }
+    }
+    m_vField[ ixField ].swap( v );
+  }
+  if ( npos != ixMoved ) {
+    for ( size_type ixSymbol = 0; ixSymbol < nSymbols; ++ixSymbol ) {
+      if ( npos != m_vFirst[ ixSymbol ] ) {
+        m_vFirst[ ixSymbol ] = vMap[ m_vFirst[ ixSymbol ] ];
+        m_vLast[ ixSymbol ] = vMap[ m_vLast[ ixSymbol ] ];
+      }
+    }
+    // rows from the first inserted day on hold other days than they did at the mark
+    if ( 0 < m_nMarkedSymbols ) m_ixDirty = std::min( m_ixDirty, ixMoved );
+  }
+  m_vDay = vDay;
+  m_nStride = nStride;
+}
+
+DailyBarPanel::size_type DailyBarPanel::AddSymbol( const std::string& sSymbol ) {
+  const size_type ixSymbol = m_vSymbol.size();
+  m_vSymbol.push_back( sSymbol );
+  m_mapSymbol[ sSymbol ] = ixSymbol;
+  m_vThrough.push_back( boost::posix_time::ptime() );
+  m_vFirst.push_back( npos );
+  m_vLast.push_back( npos );
+  for ( int ixField = 0; ixField < nFields; ++ixField ) {
+    m_vField[ ixField ].resize( m_vField[ ixField ].size() + m_nStride, dblMissing );
+  }
+  return ixSymbol;
+}
+
+void DailyBarPanel::Dirty( size_type ixSymbol, size_type ixRow ) {
+  if ( ( ixSymbol < m_nMarkedSymbols ) && ( ixRow < m_ixDirty ) ) m_ixDirty = ixRow;
+}
+
+void DailyBarPanel::Clear( void ) {
+  m_vDay.clear();
+  m_vSymbol.clear();
+  m_mapSymbol.clear();
+  m_vThrough.clear();
+  m_vFirst.clear();
+  m_vLast.clear();
+  for ( int ixField = 0; ixField < nFields; ++ixField ) m_vField[ ixField ].clear();
+  m_nStride = 0;
+  m_vStaging.clear();
+  m_nStaged = 0;
+  m_nMarkedSymbols = m_nMarkedDates = 0;
+  m_ixDirty = npos;
+}
+
+void DailyBarPanel::Reset( const vDay_t& vDay, const vSymbol_t& vSymbol, const vThrough_t& vThrough ) {
+  Clear();
+  m_vDay = vDay;
+  m_nStride = vDay.size() + c_nSpare;
+  m_vSymbol = vSymbol;
+  for ( size_type ix = 0; ix < vSymbol.size(); ++ix ) m_mapSymbol[ vSymbol[ ix ] ] = ix;
+  m_vThrough = vThrough;
+  m_vThrough.resize( vSymbol.size() );
+  m_vFirst.assign( vSymbol.size(), npos );
+  m_vLast.assign( vSymbol.size(), npos );
+  for ( int ixField = 0; ixField < nFields; ++ixField ) {
+    m_vField[ ixField ].assign( vSymbol.size() * m_nStride, dblMissing );
+  }
+}
+
+void DailyBarPanel::Extents( void ) {
+  for ( size_type ixSymbol = 0; ixSymbol < Symbols(); ++ixSymbol ) {
+    const double* pClose = Field( fClose, ixSymbol );
+    size_type ix = 0;
+    while ( ( ix < Dates() ) && Missing( pClose[ ix ] ) ) ++ix;
+    if ( ix < Dates() ) {
+      m_vFirst[ ixSymbol ] = ix;
+      ix = Dates() - 1;
+      while ( Missing( pClose[ ix ] ) ) --ix;
+      m_vLast[ ixSymbol ] = ix;
+    }
+    else {
+      m_vFirst[ ixSymbol ] = m_vLast[ ixSymbol ] = npos;
+    }
+  }
+}
+
+void DailyBarPanel::Mark( void ) {
+  m_nMarkedSymbols = Symbols();
+  m_nMarkedDates = Dates();
+  m_ixDirty = npos;
+}
+
+} // namespace tf
+} // namespace ou
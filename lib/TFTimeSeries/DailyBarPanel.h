@@ -0,0 +1,170 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// daily bars of a whole universe, as one date x symbol matrix per field (open, high, low, close, volume)
+//   the date axis is the union of the days of all symbols, a symbol without a bar on a day has NaN there
+//   each symbol's column is contiguous, Stride() doubles apart, so a filter is handed a plain array
+//     per field, and a selection pass is a sweep over columns, which can be split across threads
+//     by symbol range ( Select ), the panel is not changed by reading
+//   volume is held as double, so all fields can go through the same kernels ( columnar:: )
+// built incrementally: bars are staged with Add, and folded in with Merge,
+//   which re-lays the matrices at most once, when days land before the end or the spare rows run out
+//   Through() is the time of the last source bar folded in for the symbol, so a builder
+//     only needs to read the bars after it ( HDF5DailyBarPanel )
+// the mark ( Mark, MarkedSymbols, MarkedDates, DirtyRow ) tells a writer which cells changed since it last saved
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/function.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "DatedDatumPod.h"
+#include "TimeSeries.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class DailyBarPanel {
+public:
+
+  enum enumField { fOpen = 0, fHigh, fLow, fClose, fVolume, nFields };
+
+  typedef std::size_t size_type;
+  typedef boost::int32_t day_t;  // days since 1970/01/01
+  typedef std::vector<day_t> vDay_t;
+  typedef std::vector<std::string> vSymbol_t;
+  typedef std::vector<boost::posix_time::ptime> vThrough_t;
+
+  static const size_type npos = static_cast<size_type>( -1 );
+
+  // the rows [ixBegin, ixBegin + n) of one symbol, what a filter sees
+  struct Column {
+    size_type ixSymbol;
+    size_type ixBegin;   // date row of element 0
+    size_type n;
+    size_type ixFirst;   // offset of the symbol's first bar in the range, n if none
+    size_type ixLast;    // offset of the symbol's last bar in the range, n if none
+    const double* p[ nFields ];
+    const double* Open( void ) const { return p[ fOpen ]; };
+    const double* High( void ) const { return p[ fHigh ]; };
+    const double* Low( void ) const { return p[ fLow ]; };
+    const double* Close( void ) const { return p[ fClose ]; };
+    const double* Volume( void ) const { return p[ fVolume ]; };
+    bool Empty( void ) const { return n == ixFirst; };
+  };
+
+  typedef boost::function<bool (const Column&)> filter_t;
+
+  DailyBarPanel( void );
+  ~DailyBarPanel( void );
+
+  static bool Missing( double value ) { return value != value; };  // NaN, no bar for the symbol on the day
+
+  static day_t ToDay( const boost::gregorian::date& date );
+  static boost::gregorian::date FromDay( day_t day );
+
+  size_type Dates( void ) const { return m_vDay.size(); };
+  size_type Symbols( void ) const { return m_vSymbol.size(); };
+  size_type Stride( void ) const { return m_nStride; };  // doubles between the columns of consecutive symbols
+
+  day_t Day( size_type ixDate ) const { return m_vDay[ ixDate ]; };
+  boost::gregorian::date Date( size_type ixDate ) const { return FromDay( m_vDay[ ixDate ] ); };
+  const vDay_t& Days( void ) const { return m_vDay; };
+  size_type LowerBound( const boost::gregorian::date& date ) const;  // first row on or after the date, Dates() if none
+
+  const std::string& Symbol( size_type ixSymbol ) const { return m_vSymbol[ ixSymbol ]; };
+  size_type FindSymbol( const std::string& sSymbol ) const; // npos if not in the panel
+  const boost::posix_time::ptime& Through( size_type ixSymbol ) const { return m_vThrough[ ixSymbol ]; };
+  size_type FirstRow( size_type ixSymbol ) const { return m_vFirst[ ixSymbol ]; }; // npos when the symbol has no bars
+  size_type LastRow( size_type ixSymbol ) const { return m_vLast[ ixSymbol ]; };
+
+  const double* Data( enumField field ) const { return m_vField[ field ].empty() ? 0 : &m_vField[ field ][ 0 ]; }; // Symbols() columns of Stride()
+  double* Data( enumField field ) { return m_vField[ field ].empty() ? 0 : &m_vField[ field ][ 0 ]; }; // for loaders, see Reset
+  const double* Field( enumField field, size_type ixSymbol ) const { return Data( field ) + ixSymbol * m_nStride; }; // Dates() values
+  double Value( enumField field, size_type ixSymbol, size_type ixDate ) const { return m_vField[ field ][ ixSymbol * m_nStride + ixDate ]; };
+
+  Column GetColumn( size_type ixSymbol, size_type ixDateBegin, size_type ixDateEnd ) const;
+
+  // indexes of the symbols in [ixSymbolBegin, ixSymbolEnd) whose column over [ixDateBegin, ixDateEnd) f accepts, appended to v
+  void Select( size_type ixDateBegin, size_type ixDateEnd, filter_t f, std::vector<size_type>& v,
+    size_type ixSymbolBegin = 0, size_type ixSymbolEnd = npos ) const;
+
+  // the symbol's bars in [ixDateBegin, ixDateEnd) replace the content of bars, stamped at 00:00 of their day
+  void Bars( size_type ixSymbol, size_type ixDateBegin, size_type ixDateEnd, ou::tf::Bars& bars ) const;
+
+  // building
+
+  // bars, in time order, for the symbol, and the time of the last source bar they cover, folded in by Merge
+  void Add( const std::string& sSymbol, const pod::Bar* begin, const pod::Bar* end, const boost::posix_time::ptime& dtThrough );
+  size_type Staged( void ) const { return m_nStaged; };  // bars waiting for Merge
+  void Merge( void );
+
+  void Clear( void );
+
+  // empty matrices, all NaN, for the days and symbols, which a loader fills through Data(), then calls Extents() and Mark()
+  void Reset( const vDay_t& vDay, const vSymbol_t& vSymbol, const vThrough_t& vThrough );
+  void Extents( void ); // finds each symbol's first and last rows
+
+  // changes since the last Mark: symbols at and after MarkedSymbols() are new,
+  //   for those before it the rows from DirtyRow() on may have changed ( Dates() when none have )
+  //   MarkedDates() is Dates() at the mark
+  void Mark( void );
+  size_type MarkedSymbols( void ) const { return m_nMarkedSymbols; };
+  size_type MarkedDates( void ) const { return m_nMarkedDates; };
+  size_type DirtyRow( void ) const { return ( npos == m_ixDirty ) ? Dates() : m_ixDirty; };
+
+protected:
+private:
+
+  typedef std::map<std::string, size_type> mapSymbol_t;
+  typedef std::vector<double> vField_t;
+  typedef std::vector<size_type> vRow_t;
+
+  struct Staging {
+    std::string sSymbol;
+    std::vector<pod::Bar> vBar;
+    boost::posix_time::ptime dtThrough;
+  };
+  typedef std::vector<Staging> vStaging_t;
+
+  vDay_t m_vDay;
+  vSymbol_t m_vSymbol;
+  mapSymbol_t m_mapSymbol;
+  vThrough_t m_vThrough;
+  vRow_t m_vFirst;
+  vRow_t m_vLast;
+  vField_t m_vField[ nFields ];
+  size_type m_nStride;
+
+  vStaging_t m_vStaging;
+  size_type m_nStaged;
+
+  size_type m_nMarkedSymbols;
+  size_type m_nMarkedDates;
+  size_type m_ixDirty;
+
+  size_type AddSymbol( const std::string& sSymbol );
+  void Layout( const vDay_t& vDay, size_type nStride );
+  void Dirty( size_type ixSymbol, size_type ixRow );
+};
+
+} // namespace tf
+} // namespace ou
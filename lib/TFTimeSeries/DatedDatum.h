@@ -329,6 +329,15 @@ private:
   double m_dblIVPut;
 };
 
+// hook for HDF5TimeSeriesAccessor: datum types whose memory image differs from 
+//  the disk image ( see DatedDatumPod.h ) specialize this to fix up records in place
+template<typename DD>
+struct DatumStorage {
+  enum { bConvert = false };
+  static void AfterRead( DD*, size_t ) {};
+  static void BeforeWrite( DD*, size_t ) {};
+};
+
 } // namespace tf
 } // namespace ou
 
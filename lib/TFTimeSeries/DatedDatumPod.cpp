@@ -0,0 +1,118 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include "stdafx.h"
+
+#include <cstring>
+
+#include "DatedDatumPod.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace pod { // plain old data
+
+namespace {
+
+  const ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+
+  const boost::int64_t nNanoPerTick( 1000000000 / time_duration::ticks_per_second() );
+
+  // ptime is a single int64 tick count, which is what the hdf5 files hold
+  boost::int64_t RawImage( const ptime& dt ) {
+    static_assert( sizeof( ptime ) == sizeof( boost::int64_t ), "ptime image is not 64 bits" );
+    boost::int64_t nRaw;
+    std::memcpy( &nRaw, &dt, sizeof( nRaw ) );
+    return nRaw;
+  }
+
+  const boost::int64_t nRawEpoch( RawImage( dtEpoch ) );
+  const boost::int64_t nRawNull( RawImage( ptime( not_a_date_time ) ) );
+
+}
+
+epoch_t ToEpoch( const ptime& dt ) {
+  if ( dt.is_special() ) return epochNull;
+  return ( dt - dtEpoch ).ticks() * nNanoPerTick;
+}
+
+ptime FromEpoch( epoch_t nTime ) {
+  if ( epochNull == nTime ) return ptime( not_a_date_time );
+  return dtEpoch + time_duration( 0, 0, 0, nTime / nNanoPerTick );
+}
+
+epoch_t StorageToEpoch( boost::int64_t nRaw ) {
+  if ( nRawNull == nRaw ) return epochNull;
+  return ( nRaw - nRawEpoch ) * nNanoPerTick;
+}
+
+boost::int64_t EpochToStorage( epoch_t nTime ) {
+  if ( epochNull == nTime ) return nRawNull;
+  return ( nTime / nNanoPerTick ) + nRawEpoch;
+}
+
+// member names and disk types match those in DatedDatum.cpp
+
+H5::CompType* Quote::DefineDataType( H5::CompType* pComp ) {
+  if ( NULL == pComp ) pComp = new H5::CompType( sizeof( Quote ) );
+  pComp->insertMember( "DateTime", HOFFSET( Quote, m_nTime ),    H5::PredType::NATIVE_LLONG );
+  pComp->insertMember( "Bid",      HOFFSET( Quote, m_dblBid ),   H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Ask",      HOFFSET( Quote, m_dblAsk ),   H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "BidSize",  HOFFSET( Quote, m_nBidSize ), H5::PredType::NATIVE_INT );
+  pComp->insertMember( "AskSize",  HOFFSET( Quote, m_nAskSize ), H5::PredType::NATIVE_INT );
+  return pComp;
+}
+
+H5::CompType* Trade::DefineDataType( H5::CompType* pComp ) {
+  if ( NULL == pComp ) pComp = new H5::CompType( sizeof( Trade ) );
+  pComp->insertMember( "DateTime", HOFFSET( Trade, m_nTime ),      H5::PredType::NATIVE_LLONG );
+  pComp->insertMember( "Price",    HOFFSET( Trade, m_dblPrice ),   H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Size",     HOFFSET( Trade, m_nTradeSize ), H5::PredType::NATIVE_INT );
+  return pComp;
+}
+
+H5::CompType* Bar::DefineDataType( H5::CompType* pComp ) {
+  if ( NULL == pComp ) pComp = new H5::CompType( sizeof( Bar ) );
+  pComp->insertMember( "DateTime", HOFFSET( Bar, m_nTime ),    H5::PredType::NATIVE_LLONG );
+  pComp->insertMember( "Open",     HOFFSET( Bar, m_dblOpen ),  H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "High",     HOFFSET( Bar, m_dblHigh ),  H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Low",      HOFFSET( Bar, m_dblLow ),   H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Close",    HOFFSET( Bar, m_dblClose ), H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Volume",   HOFFSET( Bar, m_nVolume ),  H5::PredType::NATIVE_INT );
+  return pComp;
+}
+
+H5::CompType* Greek::DefineDataType( H5::CompType* pComp ) {
+  if ( NULL == pComp ) pComp = new H5::CompType( sizeof( Greek ) );
+  pComp->insertMember( "DateTime", HOFFSET( Greek, m_nTime ), H5::PredType::NATIVE_LLONG );
+  pComp->insertMember( "ImplVol",  HOFFSET( Greek, m_dblImpliedVolatility ), H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Delta",    HOFFSET( Greek, m_dblDelta ), H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Gamma",    HOFFSET( Greek, m_dblGamma ), H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Theta",    HOFFSET( Greek, m_dblTheta ), H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Vega",     HOFFSET( Greek, m_dblVega ),  H5::PredType::NATIVE_DOUBLE );
+  pComp->insertMember( "Rho",      HOFFSET( Greek, m_dblRho ),   H5::PredType::NATIVE_DOUBLE );
+  return pComp;
+}
+
+H5::CompType* Price::DefineDataType( H5::CompType* pComp ) {
+  if ( NULL == pComp ) pComp = new H5::CompType( sizeof( Price ) );
+  pComp->insertMember( "DateTime", HOFFSET( Price, m_nTime ),    H5::PredType::NATIVE_LLONG );
+  pComp->insertMember( "Price",    HOFFSET( Price, m_dblPrice ), H5::PredType::NATIVE_DOUBLE );
+  return pComp;
+}
+
+} // namespace pod
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,305 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// vtable free, trivially copyable versions of Quote, Trade, Bar, Greek, Price
+//   timestamp is a 64 bit count of nanoseconds since 1970/01/01 00:00:00,
+//   converted to ptime only at the edges ( DateTime() ).
+//   comparisons are integer comparisons.
+//   records can be memcpy'd, handed between threads, or mapped from a file.
+// Signature() matches the DatedDatum class of the same name, and DefineDataType()
+//   uses the same member names and disk types, so existing hdf5 datasets load.
+//   The hdf5 files store the ptime image in "DateTime", DatumStorage<> converts
+//   between that image and the epoch count after reads and before writes.
+
+#include <limits>
+#include <type_traits>
+
+#include <boost/cstdint.hpp>
+
+#include "DatedDatum.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace pod { // plain old data
+
+typedef boost::int64_t epoch_t;  // nanoseconds since 1970/01/01 00:00:00
+
+static const epoch_t epochNull = std::numeric_limits<epoch_t>::min();  // maps not_a_date_time
+
+epoch_t ToEpoch( const ptime& dt );
+ptime FromEpoch( epoch_t nTime );
+
+// convert the ptime memory image, as stored by DatedDatum::DefineDataType
+epoch_t StorageToEpoch( boost::int64_t nRaw );
+boost::int64_t EpochToStorage( epoch_t nTime );
+
+template<typename D>
+class Dated { // no data members, keeps derived structs standard layout
+public:
+  bool IsNull( void ) const { return epochNull == Self().m_nTime; };
+  epoch_t Epoch( void ) const { return Self().m_nTime; };
+  void Epoch( epoch_t nTime ) { Self().m_nTime = nTime; };
+  ptime DateTime( void ) const { return FromEpoch( Self().m_nTime ); };
+  void DateTime( const ptime& dt ) { Self().m_nTime = ToEpoch( dt ); };
+  bool operator<( const D& rhs ) const { return Self().m_nTime < rhs.m_nTime; };
+  bool operator<=( const D& rhs ) const { return Self().m_nTime <= rhs.m_nTime; };
+  bool operator>( const D& rhs ) const { return Self().m_nTime > rhs.m_nTime; };
+  bool operator>=( const D& rhs ) const { return Self().m_nTime >= rhs.m_nTime; };
+  bool operator==( const D& rhs ) const { return Self().m_nTime == rhs.m_nTime; };
+  bool operator!=( const D& rhs ) const { return Self().m_nTime != rhs.m_nTime; };
+protected:
+  const D& Self( void ) const { return static_cast<const D&>( *this ); };
+  D& Self( void ) { return static_cast<D&>( *this ); };
+};
+
+//
+// Quote
+//
+
+class Quote: public Dated<Quote> {
+  friend class Dated<Quote>;
+public:
+
+  typedef DatedDatum::price_t price_t;
+  typedef ou::tf::Quote::bidsize_t bidsize_t;
+  typedef ou::tf::Quote::asksize_t asksize_t;
+
+  Quote( void ): m_nTime( epochNull ), m_dblBid( 0 ), m_dblAsk( 0 ), m_nBidSize( 0 ), m_nAskSize( 0 ) {};
+  Quote( const ptime& dt ): m_nTime( ToEpoch( dt ) ), m_dblBid( 0 ), m_dblAsk( 0 ), m_nBidSize( 0 ), m_nAskSize( 0 ) {};
+  Quote( const ptime& dt, price_t dblBid, bidsize_t nBidSize, price_t dblAsk, asksize_t nAskSize )
+    : m_nTime( ToEpoch( dt ) ), m_dblBid( dblBid ), m_dblAsk( dblAsk ), m_nBidSize( nBidSize ), m_nAskSize( nAskSize ) {};
+  explicit Quote( const ou::tf::Quote& quote )
+    : m_nTime( ToEpoch( quote.DateTime() ) ),
+      m_dblBid( quote.Bid() ), m_dblAsk( quote.Ask() ), m_nBidSize( quote.BidSize() ), m_nAskSize( quote.AskSize() ) {};
+
+  ou::tf::Quote ToDatedDatum( void ) const { return ou::tf::Quote( DateTime(), m_dblBid, m_nBidSize, m_dblAsk, m_nAskSize ); };
+
+  price_t Bid( void ) const { return m_dblBid; };
+  price_t Ask( void ) const { return m_dblAsk; };
+  bidsize_t BidSize( void ) const { return m_nBidSize; };
+  asksize_t AskSize( void ) const { return m_nAskSize; };
+
+  bool IsValid( void ) const { return ( ( 0 != m_dblBid ) && ( 0 != m_dblAsk ) && ( 0 != m_nBidSize ) && ( 0 != m_nAskSize ) ); };
+  bool CrossedQuote( void ) const { return ( m_dblBid >= m_dblAsk ); };
+  price_t Midpoint( void ) const { return ( m_dblBid + m_dblAsk ) / 2.0; };
+  price_t Spread( void ) const { return m_dblAsk - m_dblBid; };
+
+  static H5::CompType* DefineDataType( H5::CompType* pType = NULL );
+  static boost::uint64_t Signature( void ) { return ou::tf::Quote::Signature(); };
+
+protected:
+private:
+  epoch_t m_nTime;
+  price_t m_dblBid;
+  price_t m_dblAsk;
+  bidsize_t m_nBidSize;
+  asksize_t m_nAskSize;
+};
+
+//
+// Trade
+//
+
+class Trade: public Dated<Trade> {
+  friend class Dated<Trade>;
+public:
+
+  typedef DatedDatum::price_t price_t;
+  typedef DatedDatum::volume_t volume_t;
+
+  Trade( void ): m_nTime( epochNull ), m_dblPrice( 0 ), m_nTradeSize( 0 ) {};
+  Trade( const ptime& dt ): m_nTime( ToEpoch( dt ) ), m_dblPrice( 0 ), m_nTradeSize( 0 ) {};
+  Trade( const ptime& dt, price_t dblTrade, volume_t nTradeSize )
+    : m_nTime( ToEpoch( dt ) ), m_dblPrice( dblTrade ), m_nTradeSize( nTradeSize ) {};
+  explicit Trade( const ou::tf::Trade& trade )
+    : m_nTime( ToEpoch( trade.DateTime() ) ), m_dblPrice( trade.Price() ), m_nTradeSize( trade.Volume() ) {};
+
+  ou::tf::Trade ToDatedDatum( void ) const { return ou::tf::Trade( DateTime(), m_dblPrice, m_nTradeSize ); };
+
+  price_t Price( void ) const { return m_dblPrice; };
+  volume_t Volume( void ) const { return m_nTradeSize; };
+
+  static H5::CompType* DefineDataType( H5::CompType* pType = NULL );
+  static boost::uint64_t Signature( void ) { return ou::tf::Trade::Signature(); };
+
+protected:
+private:
+  epoch_t m_nTime;
+  price_t m_dblPrice;
+  volume_t m_nTradeSize;
+};
+
+//
+// Bar
+//
+
+class Bar: public Dated<Bar> {
+  friend class Dated<Bar>;
+public:
+
+  typedef DatedDatum::price_t price_t;
+  typedef DatedDatum::volume_t volume_t;
+
+  Bar( void ): m_nTime( epochNull ), m_dblOpen( 0 ), m_dblHigh( 0 ), m_dblLow( 0 ), m_dblClose( 0 ), m_nVolume( 0 ) {};
+  Bar( const ptime& dt ): m_nTime( ToEpoch( dt ) ), m_dblOpen( 0 ), m_dblHigh( 0 ), m_dblLow( 0 ), m_dblClose( 0 ), m_nVolume( 0 ) {};
+  Bar( const ptime& dt, price_t dblOpen, price_t dblHigh, price_t dblLow, price_t dblClose, volume_t nVolume )
+    : m_nTime( ToEpoch( dt ) ),
+      m_dblOpen( dblOpen ), m_dblHigh( dblHigh ), m_dblLow( dblLow ), m_dblClose( dblClose ), m_nVolume( nVolume ) {};
+  explicit Bar( const ou::tf::Bar& bar )
+    : m_nTime( ToEpoch( bar.DateTime() ) ),
+      m_dblOpen( bar.Open() ), m_dblHigh( bar.High() ), m_dblLow( bar.Low() ), m_dblClose( bar.Close() ), m_nVolume( bar.Volume() ) {};
+
+  ou::tf::Bar ToDatedDatum( void ) const { return ou::tf::Bar( DateTime(), m_dblOpen, m_dblHigh, m_dblLow, m_dblClose, m_nVolume ); };
+
+  price_t Open( void ) const { return m_dblOpen; };
+  price_t High( void ) const { return m_dblHigh; };
+  price_t Low( void ) const { return m_dblLow; };
+  price_t Close( void ) const { return m_dblClose; };
+  volume_t Volume( void ) const { return m_nVolume; };
+
+  void Open( price_t price ) { m_dblOpen = price; };
+  void High( price_t price ) { m_dblHigh = price; };
+  void Low( price_t price ) { m_dblLow = price; };
+  void Close( price_t price ) { m_dblClose = price; };
+  void Volume( volume_t vol ) { m_nVolume = vol; };
+
+  static H5::CompType* DefineDataType( H5::CompType* pType = NULL );
+  static boost::uint64_t Signature( void ) { return ou::tf::Bar::Signature(); };
+
+protected:
+private:
+  epoch_t m_nTime;
+  price_t m_dblOpen;
+  price_t m_dblHigh;
+  price_t m_dblLow;
+  price_t m_dblClose;
+  volume_t m_nVolume;
+};
+
+//
+// Greek
+//
+
+class Greek: public Dated<Greek> {
+  friend class Dated<Greek>;
+public:
+
+  Greek( void ): m_nTime( epochNull ),
+    m_dblImpliedVolatility( 0 ), m_dblDelta( 0 ), m_dblGamma( 0 ), m_dblTheta( 0 ), m_dblVega( 0 ), m_dblRho( 0 ) {};
+  Greek( const ptime& dt ): m_nTime( ToEpoch( dt ) ),
+    m_dblImpliedVolatility( 0 ), m_dblDelta( 0 ), m_dblGamma( 0 ), m_dblTheta( 0 ), m_dblVega( 0 ), m_dblRho( 0 ) {};
+  Greek( const ptime& dt, double dblImpliedVolatility, double dblDelta, double dblGamma, double dblTheta, double dblVega, double dblRho )
+    : m_nTime( ToEpoch( dt ) ), m_dblImpliedVolatility( dblImpliedVolatility ),
+      m_dblDelta( dblDelta ), m_dblGamma( dblGamma ), m_dblTheta( dblTheta ), m_dblVega( dblVega ), m_dblRho( dblRho ) {};
+  explicit Greek( const ou::tf::Greek& greek )
+    : m_nTime( ToEpoch( greek.DateTime() ) ), m_dblImpliedVolatility( greek.ImpliedVolatility() ),
+      m_dblDelta( greek.Delta() ), m_dblGamma( greek.Gamma() ), m_dblTheta( greek.Theta() ), m_dblVega( greek.Vega() ), m_dblRho( greek.Rho() ) {};
+
+  ou::tf::Greek ToDatedDatum( void ) const {
+    return ou::tf::Greek( DateTime(), m_dblImpliedVolatility, m_dblDelta, m_dblGamma, m_dblTheta, m_dblVega, m_dblRho );
+  };
+
+  double ImpliedVolatility( void ) const { return m_dblImpliedVolatility; };
+  double Delta( void ) const { return m_dblDelta; };
+  double Gamma( void ) const { return m_dblGamma; };
+  double Theta( void ) const { return m_dblTheta; };
+  double Vega( void ) const { return m_dblVega; };
+  double Rho( void ) const { return m_dblRho; };
+
+  static H5::CompType* DefineDataType( H5::CompType* pType = NULL );
+  static boost::uint64_t Signature( void ) { return ou::tf::Greek::Signature(); };
+
+protected:
+private:
+  epoch_t m_nTime;
+  double m_dblImpliedVolatility;
+  double m_dblDelta;
+  double m_dblGamma;
+  double m_dblTheta;
+  double m_dblVega;
+  double m_dblRho;
+};
+
+//
+// Price
+//
+
+class Price: public Dated<Price> {
+  friend class Dated<Price>;
+public:
+
+  typedef DatedDatum::price_t price_t;
+
+  Price( void ): m_nTime( epochNull ), m_dblPrice( 0 ) {};
+  Price( const ptime& dt ): m_nTime( ToEpoch( dt ) ), m_dblPrice( 0 ) {};
+  Price( const ptime& dt, price_t dblPrice ): m_nTime( ToEpoch( dt ) ), m_dblPrice( dblPrice ) {};
+  explicit Price( const ou::tf::Price& price ): m_nTime( ToEpoch( price.DateTime() ) ), m_dblPrice( price.Value() ) {};
+
+  ou::tf::Price ToDatedDatum( void ) const { return ou::tf::Price( DateTime(), m_dblPrice ); };
+
+  price_t Value( void ) const { return m_dblPrice; };
+
+  static H5::CompType* DefineDataType( H5::CompType* pType = NULL );
+  static boost::uint64_t Signature( void ) { return ou::tf::Price::Signature(); };
+
+protected:
+private:
+  epoch_t m_nTime;
+  price_t m_dblPrice;
+};
+
+// the point of the exercise
+static_assert( std::is_trivially_copyable<Quote>::value, "pod::Quote not trivially copyable" );
+static_assert( std::is_trivially_copyable<Trade>::value, "pod::Trade not trivially copyable" );
+static_assert( std::is_trivially_copyable<Bar>::value, "pod::Bar not trivially copyable" );
+static_assert( std::is_trivially_copyable<Greek>::value, "pod::Greek not trivially copyable" );
+static_assert( std::is_trivially_copyable<Price>::value, "pod::Price not trivially copyable" );
+static_assert( std::is_standard_layout<Quote>::value, "pod::Quote not standard layout" );
+static_assert( sizeof( Quote ) < sizeof( ou::tf::Quote ), "pod::Quote not smaller" );
+
+// the pod datum of a DatedDatum class, as in pod::Of<ou::tf::Bar>::type
+template<typename DD> struct Of;
+template<> struct Of<ou::tf::Quote> { typedef Quote type; };
+template<> struct Of<ou::tf::Trade> { typedef Trade type; };
+template<> struct Of<ou::tf::Bar> { typedef Bar type; };
+template<> struct Of<ou::tf::Greek> { typedef Greek type; };
+template<> struct Of<ou::tf::Price> { typedef Price type; };
+
+// in-place conversion of the "DateTime" member for a block of records
+template<typename D>
+struct Storage {
+  static void AfterRead( D* p, size_t n ) {
+    for ( size_t ix = 0; ix < n; ++ix, ++p ) p->Epoch( StorageToEpoch( p->Epoch() ) );
+  }
+  static void BeforeWrite( D* p, size_t n ) {
+    for ( size_t ix = 0; ix < n; ++ix, ++p ) p->Epoch( EpochToStorage( p->Epoch() ) );
+  }
+};
+
+} // namespace pod
+
+// hdf5 accessor hooks for the pod family
+
+template<> struct DatumStorage<pod::Quote>: public pod::Storage<pod::Quote> { enum { bConvert = true }; };
+template<> struct DatumStorage<pod::Trade>: public pod::Storage<pod::Trade> { enum { bConvert = true }; };
+template<> struct DatumStorage<pod::Bar>: public pod::Storage<pod::Bar> { enum { bConvert = true }; };
+template<> struct DatumStorage<pod::Greek>: public pod::Storage<pod::Greek> { enum { bConvert = true }; };
+template<> struct DatumStorage<pod::Price>: public pod::Storage<pod::Price> { enum { bConvert = true }; };
+
+} // namespace tf
+} // namespace ou
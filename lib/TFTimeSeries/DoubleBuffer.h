@@ -18,26 +18,189 @@
 #define DOUBLEBUFFER_H
 
 #include <vector>
-#include <queue>
+#include <new>
+#include <cassert>
 
+#include <boost/atomic.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/thread/thread.hpp>
 #include <boost/thread/mutex.hpp>
-#include <boost/thread/locks.hpp>
+#include <boost/thread/lock_guard.hpp>
+
+// 2026/10/18 single producer / single consumer, no locks:
+//   Append is called from the one feed (background) thread, and is wait-free
+//     unless a new block has to be allocated, which happens once per nBlockSize entries,
+//     and not at all in steady state, as drained blocks are recycled
+//   Sync and everything else is called from the one consumer (foreground) thread,
+//     and drains whatever has been published since the previous Sync in a batch
+//   neither side ever waits on the other
+//   the producer is the thread of the first Push, for the life of the queue, which is asserted,
+//     a queue fed from more than one thread, even one at a time, is a Queue
+//   Queue, used by the chart entries, which are appended from feed, simulation and gui threads,
+//     gives each producer thread an SpscQueue of its own, so Append takes no lock once a thread has its queue
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+// unbounded queue built from a linked chain of fixed size blocks
+template<typename datum_t, std::size_t nBlockSize = 256>
+class SpscQueue: boost::noncopyable {
+public:
+  typedef std::size_t size_type;
+
+  SpscQueue( void );
+  ~SpscQueue( void );  // neither thread may be active
+
+  void Push( const datum_t& ); // producer thread only, asserted unless NDEBUG
+
+  // consumer thread only, f( const datum_t& ) for each entry published since previous Drain
+  template<typename Function>
+  size_type Drain( Function f );
+
+protected:
+private:
+
+  struct Block {
+    typedef typename boost::aligned_storage<sizeof( datum_t ), boost::alignment_of<datum_t>::value>::type slot_t;
+    boost::atomic<size_type> m_nPublished; // written by producer only
+    boost::atomic<Block*> m_pNext; // written by producer only
+    slot_t m_rSlot[ nBlockSize ];
+    Block( void ): m_nPublished( 0 ), m_pNext( 0 ) {}
+    datum_t* Slot( size_type ix ) { return reinterpret_cast<datum_t*>( &m_rSlot[ ix ] ); }
+    void Reset( void ) {
+      m_nPublished.store( 0, boost::memory_order_relaxed );
+      m_pNext.store( 0, boost::memory_order_relaxed );
+    }
+  };
+
+  // producer and consumer state padded onto separate cache lines to prevent false sharing
+  //   (padding rather than alignas, as pre-c++17 new does not honour over-alignment)
+  struct Producer {
+    Block* m_pTail;
+    size_type m_ixTail;
+  } m_producer;
+  char m_padProducer[ 64 ];
+
+  struct Consumer {
+    Block* m_pHead;
+    size_type m_ixHead;
+  } m_consumer;
+  char m_padConsumer[ 64 ];
+
+  boost::atomic<Block*> m_pSpare; // one drained block handed back from consumer to producer
+
+#ifndef NDEBUG
+  enum EProducer { ProducerNone, ProducerClaiming, ProducerKnown };
+  boost::atomic<EProducer> m_stateProducer;
+  boost::thread::id m_idProducer; // written once, by the first Push, before ProducerKnown is published
+  bool IsProducer( void );
+#endif
+
+};
+
+template<typename datum_t, std::size_t nBlockSize>
+SpscQueue<datum_t,nBlockSize>::SpscQueue( void )
+: m_pSpare( 0 )
+#ifndef NDEBUG
+, m_stateProducer( ProducerNone )
+#endif
+{
+  Block* pBlock = new Block;
+  m_producer.m_pTail = pBlock;
+  m_producer.m_ixTail = 0;
+  m_consumer.m_pHead = pBlock;
+  m_consumer.m_ixHead = 0;
+}
+
+template<typename datum_t, std::size_t nBlockSize>
+SpscQueue<datum_t,nBlockSize>::~SpscQueue( void ) {
+  Drain( []( const datum_t& ){} ); // destroys any remaining entries
+  Block* pBlock = m_consumer.m_pHead;
+  while ( 0 != pBlock ) {
+    Block* pNext = pBlock->m_pNext.load( boost::memory_order_acquire );
+    delete pBlock;
+    pBlock = pNext;
+  }
+  delete m_pSpare.load( boost::memory_order_acquire );
+}
+
+#ifndef NDEBUG
+template<typename datum_t, std::size_t nBlockSize>
+bool SpscQueue<datum_t,nBlockSize>::IsProducer( void ) {
+  EProducer state( m_stateProducer.load( boost::memory_order_acquire ) );
+  if ( ProducerKnown != state ) {
+    state = ProducerNone;
+    if ( m_stateProducer.compare_exchange_strong( state, ProducerClaiming, boost::memory_order_acquire ) ) {
+      m_idProducer = boost::this_thread::get_id();
+      m_stateProducer.store( ProducerKnown, boost::memory_order_release );
+      return true;
+    }
+    while ( ProducerKnown != m_stateProducer.load( boost::memory_order_acquire ) ) {} // a racing first Push is claiming
+  }
+  return boost::this_thread::get_id() == m_idProducer;
+}
+#endif
+
+template<typename datum_t, std::size_t nBlockSize>
+void SpscQueue<datum_t,nBlockSize>::Push( const datum_t& datum ) {
+  assert( IsProducer() ); // a second producer thread needs a Queue
+  if ( nBlockSize == m_producer.m_ixTail ) {
+    Block* pBlock = m_pSpare.exchange( 0, boost::memory_order_acquire );
+    if ( 0 == pBlock ) {
+      pBlock = new Block;
+    }
+    m_producer.m_pTail->m_pNext.store( pBlock, boost::memory_order_release );
+    m_producer.m_pTail = pBlock;
+    m_producer.m_ixTail = 0;
+  }
+  new( m_producer.m_pTail->Slot( m_producer.m_ixTail ) ) datum_t( datum );
+  ++m_producer.m_ixTail;
+  m_producer.m_pTail->m_nPublished.store( m_producer.m_ixTail, boost::memory_order_release );
+}
+
+template<typename datum_t, std::size_t nBlockSize>
+template<typename Function>
+typename SpscQueue<datum_t,nBlockSize>::size_type SpscQueue<datum_t,nBlockSize>::Drain( Function f ) {
+  size_type nDrained( 0 );
+  while ( true ) {
+    Block* pHead = m_consumer.m_pHead;
+    const size_type nPublished = pHead->m_nPublished.load( boost::memory_order_acquire );
+    while ( m_consumer.m_ixHead < nPublished ) {
+      datum_t* pDatum = pHead->Slot( m_consumer.m_ixHead );
+      f( *pDatum );
+      pDatum->~datum_t();
+      ++m_consumer.m_ixHead;
+      ++nDrained;
+    }
+    if ( nBlockSize != m_consumer.m_ixHead ) break; // caught up with producer
+    Block* pNext = pHead->m_pNext.load( boost::memory_order_acquire );
+    if ( 0 == pNext ) break; // producer has filled the block but not yet linked the next
+    m_consumer.m_pHead = pNext;
+    m_consumer.m_ixHead = 0;
+    pHead->Reset();
+    delete m_pSpare.exchange( pHead, boost::memory_order_acq_rel ); // recycle, producer may not have used the previous spare
+  }
+  return nDrained;
+}
+
+//
+// =================
+//
+
 template<typename TS>
 class DoubleBufferRef {
 public:
   typedef typename TS::datum_t datum_t;
   DoubleBufferRef( TS& tsBackground, TS& tsForeground );
   virtual ~DoubleBufferRef();
-  void Append( const datum_t& );
-  void Sync( void );
+  void Append( const datum_t& ); // producer thread
+  void Sync( void ); // consumer thread
 protected:
 private:
-  boost::mutex m_mutex;
-  TS& m_tsInbound; // inbound time series via background thread
+  SpscQueue<datum_t> m_queue;
+  TS& m_tsInbound; // inbound time series via background thread, touched only by background thread
   TS& m_tsBatched; // syncs to inbound when needed and used in other foreground threads
 };
 
@@ -47,18 +210,20 @@ DoubleBufferRef<TS>::DoubleBufferRef( TS& tsBackground, TS& tsForeground )
 {
 }
 
+template<typename TS>
+DoubleBufferRef<TS>::~DoubleBufferRef() {
+}
+
 template<typename TS>
 void DoubleBufferRef<TS>::Append( const datum_t& datum ) {
-  boost::lock_guard<boost::mutex> guard(m_mutex);
   m_tsInbound.Append( datum );
+  m_queue.Push( datum );
 }
 
 template<typename TS>
 void DoubleBufferRef<TS>::Sync( void ) {
-  boost::lock_guard<boost::mutex> guard(m_mutex);
-  while ( m_tsInbound.Size() > m_tsBatched.Size() ) {
-    m_tsBatched.Append( m_tsInbound[ m_tsBatched.Size() ] );
-  }
+  TS& ts( m_tsBatched );
+  m_queue.Drain( [&ts]( const datum_t& datum ){ ts.Append( datum ); } );
 }
 
 //
@@ -73,19 +238,18 @@ public:
   DoubleBuffer( void );
   virtual ~DoubleBuffer() {}
   
-  void Append( const datum_t& ); // sync'd
-  size_type Sync( void ); // uses lock
-  void Reserve( size_type nSize ); // sync'd
-  void Clear( void ); // sync'd
-  size_type Size( void ); // sync'd
+  void Append( const datum_t& ); // producer thread
+  size_type Sync( void ); // consumer thread
+  void Reserve( size_type nSize ); // consumer thread
+  void Clear( void ); // consumer thread, discards anything not yet sync'd
+  size_type Size( void ); // consumer thread, sync's first
   
   const datum_t* GetRef( void ) const;  // not sync'd
   const datum_t* operator[]( size_type ix ) const; // not sync'd
   const vDatum_t& GetVector( void ) const { return m_tsBatched; } // not sync'd
 protected:
 private:
-  boost::mutex m_mutex;
-  vDatum_t m_tsInbound; // inbound time series via background thread
+  SpscQueue<datum_t> m_queue; // inbound via background thread
   vDatum_t m_tsBatched; // syncs to inbound when needed and used in other foreground threads
 };
 
@@ -94,23 +258,19 @@ DoubleBuffer<datum_t>::DoubleBuffer( void ) {}
 
 template<typename datum_t>
 void DoubleBuffer<datum_t>::Append( const datum_t& datum ) {
-  boost::lock_guard<boost::mutex> guard(m_mutex);
-  m_tsInbound.push_back( datum );
+  m_queue.Push( datum );
 }
 
 template<typename datum_t>
 void DoubleBuffer<datum_t>::Clear( void ) {
-  boost::lock_guard<boost::mutex> guard(m_mutex);
-  m_tsInbound.clear();
+  m_queue.Drain( []( const datum_t& ){} );
   m_tsBatched.clear();
 }
 
 template<typename datum_t>
 typename DoubleBuffer<datum_t>::size_type DoubleBuffer<datum_t>::Sync( void ) {
-  boost::lock_guard<boost::mutex> guard(m_mutex);
-  while ( m_tsInbound.size() > m_tsBatched.size() ) {
-    m_tsBatched.push_back( m_tsInbound[ m_tsBatched.size() ] );
-  }
+  vDatum_t& v( m_tsBatched );
+  m_queue.Drain( [&v]( const datum_t& datum ){ v.push_back( datum ); } );
   return m_tsBatched.size();
 }
 
@@ -133,10 +293,7 @@ const datum_t* DoubleBuffer<datum_t>::operator[]( size_type ix ) const {
 
 template<typename datum_t>
 void DoubleBuffer<datum_t>::Reserve( size_type nSize ) {
-  boost::lock_guard<boost::mutex> guard(m_mutex);
-  assert( nSize >= m_tsInbound.size() );
   assert( nSize >= m_tsBatched.size() );
-  m_tsInbound.reserve( nSize );
   m_tsBatched.reserve( nSize );
 }
 
@@ -144,31 +301,59 @@ void DoubleBuffer<datum_t>::Reserve( size_type nSize ) {
 // =================
 //
 
+// any number of producer threads, each with an SpscQueue of its own, found by its thread id, one consumer
+//   a thread's first Append adds its queue, under a lock, queues are kept for the life of the Queue
+//   Sync drains the queues in turn, entries keep their order for each producer, not across producers
 template<typename datum_t>
-class Queue {
-  typedef std::queue<datum_t> qDatum_t;
+class Queue: boost::noncopyable {
 public:
-  Queue( void ) {}
-  virtual ~Queue() {}
+  Queue( void ): m_pProducers( 0 ) {}
+  virtual ~Queue() {  // no thread may be active
+    Producer* pProducer = m_pProducers.load( boost::memory_order_acquire );
+    while ( 0 != pProducer ) {
+      Producer* pNext = pProducer->pNext;
+      delete pProducer;
+      pProducer = pNext;
+    }
+  }
   
+  // any thread
   void Append( const datum_t& datum ) {
-    boost::lock_guard<boost::mutex> guard(m_mutex);
-    m_qDatum.push( datum );
+    const boost::thread::id id( boost::this_thread::get_id() );
+    Producer* pProducer = m_pProducers.load( boost::memory_order_acquire );
+    while ( ( 0 != pProducer ) && ( id != pProducer->id ) ) pProducer = pProducer->pNext;
+    if ( 0 == pProducer ) pProducer = Add( id );
+    pProducer->queue.Push( datum );
   }
   
+  // consumer thread only
   template<typename Function>
   void Sync( Function f ) {
-    boost::lock_guard<boost::mutex> guard(m_mutex);
-    while ( !m_qDatum.empty() ) {
-      f( m_qDatum.front() );
-      m_qDatum.pop();
+    for ( Producer* pProducer = m_pProducers.load( boost::memory_order_acquire ); 0 != pProducer; pProducer = pProducer->pNext ) {
+      pProducer->queue.Drain( f );
     }
   }
   
 protected:
 private:
-  boost::mutex m_mutex;
-  qDatum_t m_qDatum;
+
+  struct Producer { // id and pNext are set before the producer is published, and not changed after
+    const boost::thread::id id;
+    Producer* pNext;
+    SpscQueue<datum_t> queue;
+    Producer( boost::thread::id id_, Producer* pNext_ ): id( id_ ), pNext( pNext_ ) {}
+  };
+
+  boost::atomic<Producer*> m_pProducers;
+  boost::mutex m_mutexAdd; // taken once per producer thread
+
+  Producer* Add( boost::thread::id id ) {
+    boost::lock_guard<boost::mutex> lock( m_mutexAdd );
+    // only the thread itself adds its id, so it is not there, the lock orders adds from other threads
+    Producer* pProducer = new Producer( id, m_pProducers.load( boost::memory_order_relaxed ) );
+    m_pProducers.store( pProducer, boost::memory_order_release );
+    return pProducer;
+  }
 };
 
 } // namespace tf
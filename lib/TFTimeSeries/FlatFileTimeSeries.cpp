@@ -0,0 +1,148 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include "stdafx.h"
+
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+
+#include "FlatFileTimeSeries.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+  const char szMagic[ 8 ] = { 'T', 'F', 'F', 'L', 'A', 'T', 0, 0 };
+}
+
+FlatFile::FlatFile( const std::string& sFileName, boost::uint64_t nSignature, std::size_t nRecordSize )
+: m_sFileName( sFileName ), m_pHeader( 0 )
+{
+  namespace ip = boost::interprocess;
+  try {
+    ip::file_mapping mapping( sFileName.c_str(), ip::read_only );
+    ip::mapped_region region( mapping, ip::read_only );
+    m_mapping.swap( mapping );
+    m_region.swap( region );
+  }
+  catch ( ip::interprocess_exception& e ) {
+    throw std::runtime_error( "FlatFile " + sFileName + ": " + e.what() );
+  }
+  if ( sizeof( FlatFileHeader ) > m_region.get_size() ) {
+    throw std::runtime_error( "FlatFile " + sFileName + ": no header" );
+  }
+  m_pHeader = reinterpret_cast<const FlatFileHeader*>( m_region.get_address() );
+  if ( 0 != std::memcmp( szMagic, m_pHeader->szMagic, sizeof( szMagic ) ) ) {
+    throw std::runtime_error( "FlatFile " + sFileName + ": not a flat file" );
+  }
+  if ( c_nVersion != m_pHeader->nVersion ) {
+    throw std::runtime_error( "FlatFile " + sFileName + ": unknown version" );
+  }
+  if ( ( nSignature != m_pHeader->nSignature ) || ( nRecordSize != m_pHeader->nRecordSize ) ) {
+    throw std::runtime_error( "FlatFile " + sFileName + ": different datum type" );
+  }
+  if ( ( m_region.get_size() - sizeof( FlatFileHeader ) ) / nRecordSize < m_pHeader->nRecords ) {
+    throw std::runtime_error( "FlatFile " + sFileName + ": truncated" );
+  }
+}
+
+FlatFile::~FlatFile( void ) {
+}
+
+const char* FlatFile::TypeName( boost::uint64_t nSignature ) {
+  if ( pod::Quote::Signature() == nSignature ) return "quotes";
+  if ( pod::Trade::Signature() == nSignature ) return "trades";
+  if ( pod::Bar::Signature() == nSignature ) return "bars";
+  if ( pod::Greek::Signature() == nSignature ) return "greeks";
+  if ( pod::Price::Signature() == nSignature ) return "prices";
+  return 0;
+}
+
+std::string FlatFile::FileName(
+  const std::string& sRoot, boost::uint64_t nSignature, const boost::gregorian::date& date, const std::string& sSymbol ) {
+  if ( !Daily( nSignature ) ) return FileName( sRoot, nSignature, sSymbol );
+  std::string sFileName;
+  const char* szType = TypeName( nSignature );
+  if ( 0 != szType ) {
+    boost::filesystem::path path( sRoot );
+    path /= szType;
+    path /= boost::gregorian::to_iso_string( date );
+    path /= sSymbol + ".tfs";
+    sFileName = path.string();
+  }
+  return sFileName;
+}
+
+std::string FlatFile::FileName( const std::string& sRoot, boost::uint64_t nSignature, const std::string& sSymbol ) {
+  std::string sFileName;
+  const char* szType = TypeName( nSignature );
+  if ( 0 != szType ) {
+    boost::filesystem::path path( sRoot );
+    path /= szType;
+    path /= sSymbol + ".tfs";
+    sFileName = path.string();
+  }
+  return sFileName;
+}
+
+bool FlatFile::Daily( boost::uint64_t nSignature ) {
+  return pod::Bar::Signature() != nSignature;
+}
+
+void FlatFile::Write( const std::string& sFileName, boost::uint64_t nSignature, std::size_t nRecordSize,
+  const void* pRecords, boost::uint64_t nRecords, pod::epoch_t nFirst, pod::epoch_t nLast ) {
+
+  FlatFileHeader header;
+  std::memset( &header, 0, sizeof( header ) );
+  std::memcpy( header.szMagic, szMagic, sizeof( szMagic ) );
+  header.nVersion = c_nVersion;
+  header.nRecordSize = nRecordSize;
+  header.nSignature = nSignature;
+  header.nRecords = nRecords;
+  header.nFirst = nFirst;
+  header.nLast = nLast;
+
+  const boost::filesystem::path path( sFileName );
+  boost::filesystem::path pathTemp;
+  try {
+    pathTemp = boost::filesystem::unique_path( sFileName + ".%%%%-%%%%-%%%%-%%%%.tmp" ); // one per writer
+    if ( path.has_parent_path() ) boost::filesystem::create_directories( path.parent_path() );
+    {
+      std::ofstream file( pathTemp.string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+      file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+      file.write( reinterpret_cast<const char*>( pRecords ), nRecords * nRecordSize );
+      file.close();
+      if ( file.fail() ) {
+        throw std::runtime_error( "FlatFile::Write " + pathTemp.string() + ": write failed" );
+      }
+    }
+    boost::filesystem::rename( pathTemp, path );
+  }
+  catch ( boost::filesystem::filesystem_error& e ) {
+    boost::system::error_code ec;
+    if ( !pathTemp.empty() ) boost::filesystem::remove( pathTemp, ec );
+    throw std::runtime_error( std::string( "FlatFile::Write " ) + e.what() );
+  }
+  catch ( std::runtime_error& ) {
+    boost::system::error_code ec;
+    boost::filesystem::remove( pathTemp, ec );
+    throw;
+  }
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,149 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// flat file store for pod datums, the alternative to the hdf5 file:
+//   ticks: one file per symbol, per day, per datum type: <root>/<type>/<yyyymmdd>/<symbol>.tfs
+//   bars: one file per symbol, the whole series: <root>/bars/<symbol>.tfs, a year of daily bars is 12k
+//   a 64 byte header, then the records, fixed width, in time order, as they are in memory
+//   the file is mapped read only, so readers in any number of threads or processes share
+//     the page cache, and a record is read without a copy or a library call
+// the header carries the Signature() of the datum and the record size, a file is only
+//   opened as the type which wrote it
+// files are written whole: to a temporary name, unique to the writer, then renamed over the old file,
+//   so a reader sees the previous file, or the new one, never a partial one, and concurrent
+//   writers of a file do not share a temporary, the last rename wins
+// records are in the byte order of the machine which wrote them
+
+#include <string>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "DatedDatumPod.h"
+#include "TimeSeriesStore.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+struct FlatFileHeader {
+  char szMagic[ 8 ];  // "TFFLAT"
+  boost::uint32_t nVersion;
+  boost::uint32_t nRecordSize;
+  boost::uint64_t nSignature;
+  boost::uint64_t nRecords;
+  pod::epoch_t nFirst;  // time of the first and last records, epochNull when empty
+  pod::epoch_t nLast;
+  boost::uint8_t reserved[ 16 ];
+};
+
+static_assert( 64 == sizeof( FlatFileHeader ), "FlatFileHeader needs to be 64 bytes" );
+
+class FlatFile: boost::noncopyable {
+public:
+
+  // maps the file, throws std::runtime_error if it is missing, or does not hold records of this signature and size
+  FlatFile( const std::string& sFileName, boost::uint64_t nSignature, std::size_t nRecordSize );
+  ~FlatFile( void );
+
+  const std::string& FileName( void ) const { return m_sFileName; };
+  const FlatFileHeader& Header( void ) const { return *m_pHeader; };
+  boost::uint64_t Records( void ) const { return m_pHeader->nRecords; };
+  const void* Data( void ) const { return m_pHeader + 1; };
+
+  // <root>/<type>/<yyyymmdd>/<symbol>.tfs, empty if the signature is not one of the pod datums
+  //   for a type which is not Daily(), date is not used, and the name is as below
+  static std::string FileName(
+    const std::string& sRoot, boost::uint64_t nSignature, const boost::gregorian::date& date, const std::string& sSymbol );
+  // <root>/<type>/<symbol>.tfs, the whole series, for a type which is not Daily()
+  static std::string FileName( const std::string& sRoot, boost::uint64_t nSignature, const std::string& sSymbol );
+  static bool Daily( boost::uint64_t nSignature ); // the type is split into a file per day, all but bars
+  static const char* TypeName( boost::uint64_t nSignature ); // quotes, trades, bars, greeks, prices, 0 if none of these
+
+  // writes the file whole, creating directories as needed, throws std::runtime_error on failure
+  static void Write( const std::string& sFileName, boost::uint64_t nSignature, std::size_t nRecordSize,
+    const void* pRecords, boost::uint64_t nRecords, pod::epoch_t nFirst, pod::epoch_t nLast );
+
+protected:
+private:
+
+  static const boost::uint32_t c_nVersion = 1;
+
+  const std::string m_sFileName;
+  boost::interprocess::file_mapping m_mapping;
+  boost::interprocess::mapped_region m_region;
+  const FlatFileHeader* m_pHeader;
+};
+
+//
+// =================
+//
+
+template<class DD>
+class FlatFileTimeSeries: public TimeSeriesStore<DD> {
+public:
+
+  static_assert( std::is_trivially_copyable<DD>::value, "FlatFileTimeSeries holds pod datums" );
+
+  typedef typename TimeSeriesStore<DD>::size_type size_type;
+  typedef const DD* const_iterator;
+
+  explicit FlatFileTimeSeries( const std::string& sFileName )
+    : m_file( sFileName, DD::Signature(), sizeof( DD ) ),
+      m_begin( reinterpret_cast<const DD*>( m_file.Data() ) ), m_end( m_begin + m_file.Records() ) {};
+  virtual ~FlatFileTimeSeries( void ) {};
+
+  const_iterator begin( void ) const { return m_begin; };
+  const_iterator end( void ) const { return m_end; };
+  const DD& operator[]( size_type ix ) const { return m_begin[ ix ]; };
+  const_iterator LowerBound( const_iterator begin, const_iterator end, const boost::posix_time::ptime& dt ) const {
+    return std::lower_bound( begin, end, DD( dt ) );
+  }
+
+  // TimeSeriesStore
+  size_type Size( void ) { return m_end - m_begin; };
+  bool Shared( void ) const { return true; };
+  void Read( size_type ixStart, size_type count, DD* p ) {
+    assert( ( ixStart + count ) <= Size() );
+    std::memcpy( p, m_begin + ixStart, count * sizeof( DD ) );
+  }
+  size_type LowerBound( const boost::posix_time::ptime& dt ) { return LowerBound( m_begin, m_end, dt ) - m_begin; };
+  using TimeSeriesStore<DD>::Read;
+
+  static void Write( const std::string& sFileName, const DD* begin, const DD* end ) {
+    const bool bEmpty( begin == end );
+    FlatFile::Write( sFileName, DD::Signature(), sizeof( DD ), begin, end - begin,
+      bEmpty ? pod::epochNull : begin->Epoch(), bEmpty ? pod::epochNull : ( end - 1 )->Epoch() );
+  }
+
+protected:
+private:
+  FlatFile m_file;
+  const DD* m_begin;
+  const DD* m_end;
+};
+
+} // namespace tf
+} // namespace ou
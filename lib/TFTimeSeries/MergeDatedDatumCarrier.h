@@ -15,18 +15,26 @@
 #pragma once
 
 #include <stdexcept>
+#include <limits>
+
+#include <boost/cstdint.hpp>
+
+#if defined( _MSC_VER )
+#include <xmmintrin.h>
+#endif
 
 #include <OUCommon/FastDelegate.h>
 using namespace fastdelegate;
 
-#include <OUCommon/TimeSource.h>
-
 #include "TimeSeries.h"
 
 // Each carrier holds a TimeSeries.  The carrier holds an index to the current DatedDatum in each TimeSeries.
 // The current DatedDatum timestamp is maintained for the merge process to figure out which DatedDatum to 
 // send into the merge process
 
+// 2026/10/18 the timestamp is kept as an integer key for the loser tree in MergeDatedDatums,
+//   and a carrier can be given a handler typed on its datum, which avoids a dynamic_cast per datum
+
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
@@ -34,22 +42,49 @@ class MergeCarrierBase {
   friend class MergeDatedDatums;
 public:
   typedef FastDelegate1<const DatedDatum &> OnDatumHandler;
-  MergeCarrierBase( void ) {};
+  typedef boost::int64_t key_t;
+  static const key_t keyDepleted = std::numeric_limits<key_t>::max();  // sorts after everything
+  MergeCarrierBase( void ): m_nKey( keyDepleted ), m_pDatum( 0 ), m_ixCarrier( 0 ) {};
   virtual ~MergeCarrierBase( void ) {};
   virtual void ProcessDatum( void ) 
     { throw std::runtime_error( "ProcessDatum not defined" ); };
   virtual void Reset( void ) 
     { throw std::runtime_error( "Reset not defined" ); };
-  inline const ptime &GetDateTime( void ) { return m_dt; };
+  virtual std::size_t Size( void ) const
+    { throw std::runtime_error( "Size not defined" ); };
+  virtual ptime FirstDateTime( void ) const  // of the whole series, not of the current datum
+    { throw std::runtime_error( "FirstDateTime not defined" ); };
+  virtual ptime LastDateTime( void ) const
+    { throw std::runtime_error( "LastDateTime not defined" ); };
   const DatedDatum* GetDatedDatum( void ) const { return m_pDatum; };
-  bool operator<( const MergeCarrierBase& other ) const { return m_dt < other.m_dt; };
-  bool operator<( const MergeCarrierBase* pOther ) const { return m_dt < pOther->m_dt; };
-  static bool lt( MergeCarrierBase* plhs, MergeCarrierBase *prhs ) { return plhs->m_dt < prhs->m_dt; };
+  key_t GetKey( void ) const { return m_nKey; };
+  bool operator<( const MergeCarrierBase& other ) const { return m_nKey < other.m_nKey; };
+  bool operator<( const MergeCarrierBase* pOther ) const { return m_nKey < pOther->m_nKey; };
+  static bool lt( MergeCarrierBase* plhs, MergeCarrierBase *prhs ) { return plhs->m_nKey < prhs->m_nKey; };
+  // ticks since an epoch, ordered the same as the time it represents
+  static key_t Key( const ptime& dt ) {
+    return ( dt - Epoch() ).ticks();
+  }
+  static ptime DateTime( key_t nKey ) {
+    return Epoch() + time_duration( 0, 0, 0, nKey );
+  }
+  static void Prefetch( const void* p ) {
+#if defined( __GNUC__ )
+    __builtin_prefetch( p );
+#elif defined( _MSC_VER )
+    _mm_prefetch( (const char*) p, _MM_HINT_T0 );
+#endif
+  }
 protected:
-  ptime m_dt;  // datetime of datum to be merged (used in comparison)
+  key_t m_nKey;  // datetime of datum to be merged (used in comparison)
   const DatedDatum* m_pDatum;
   OnDatumHandler OnDatum;
+  std::size_t m_ixCarrier;  // order of Add into MergeDatedDatums
 private:
+  static const ptime& Epoch( void ) {
+    static const ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+    return dtEpoch;
+  }
 };
 
 template<class T> 
@@ -57,12 +92,38 @@ class MergeCarrier: public MergeCarrierBase {
   // T is a DatedDatum type
   friend class MergeDatedDatums;
 public:
+  typedef FastDelegate1<const T &> OnTypedDatumHandler;
   MergeCarrier<T>( TimeSeries<T>& series, OnDatumHandler function );
+  MergeCarrier<T>( TimeSeries<T>& series, OnTypedDatumHandler function );
   virtual ~MergeCarrier<T>( void );
   void ProcessDatum( void );
   void Reset( void );
+  std::size_t Size( void ) const { return m_series.Size(); };
+  ptime FirstDateTime( void ) const { return m_series.begin()->DateTime(); };
+  ptime LastDateTime( void ) const { return ( m_series.end() - 1 )->DateTime(); };
 protected:
+  typedef typename TimeSeries<T>::const_iterator const_iterator;
   TimeSeries<T>& m_series;  // series from which a datum is to be merged to output
+  OnTypedDatumHandler OnTypedDatum;
+  const T* m_pTypedDatum;
+  const_iterator m_iter;
+  const_iterator m_end;
+  void Load( void ) {
+    if ( m_end == m_iter ) {
+      m_pTypedDatum = 0;
+      m_pDatum = 0;
+      m_nKey = keyDepleted;
+    }
+    else {
+      m_pTypedDatum = &(*m_iter);
+      m_pDatum = m_pTypedDatum;
+      m_nKey = Key( m_pTypedDatum->DateTime() );
+      // with many series, the merge visits them in effectively random order, and each step
+      //   waits on the key of the next datum, so fetch it now, it is needed when this carrier next wins
+      const_iterator iterNext( m_iter + 1 );
+      if ( m_end != iterNext ) Prefetch( &(*iterNext) );
+    }
+  }
 private:
 };
 
@@ -72,35 +133,40 @@ MergeCarrier<T>::MergeCarrier( TimeSeries<T>& series, OnDatumHandler function )
 {
   assert( 0 != m_series.Size() );
   OnDatum = function;
-  m_pDatum = m_series.First();  // preload with first datum so we have it's time available for comparison
-  m_dt = ( 0 == m_pDatum ) 
-    ? boost::date_time::special_values::not_a_date_time 
-    : m_pDatum->DateTime();
+  Reset();
+}
+
+template<class T> 
+MergeCarrier<T>::MergeCarrier( TimeSeries<T>& series, OnTypedDatumHandler function ) 
+  : MergeCarrierBase(), m_series( series ), OnTypedDatum( function )
+{
+  assert( 0 != m_series.Size() );
+  Reset();
 }
 
 template<class T> 
 MergeCarrier<T>::~MergeCarrier() {
 }
 
+// simulation time is set by MergeDatedDatums prior to this call
 template<class T> 
 void MergeCarrier<T>::ProcessDatum(void) {
-  if ( ou::TimeSource::LocalCommonInstance().GetSimulationMode() ) {
-    ou::TimeSource::LocalCommonInstance().SetSimulationTime( m_pDatum->DateTime() );
+  if ( 0 != OnTypedDatum ) {
+    OnTypedDatum( *m_pTypedDatum );
+  }
+  else {
+    if ( 0 != OnDatum ) 
+      OnDatum( *m_pDatum );
   }
-  if ( 0 != OnDatum ) 
-    OnDatum( *m_pDatum );
-  m_pDatum = m_series.Next();
-  m_dt = ( NULL == m_pDatum ) 
-    ? boost::date_time::special_values::not_a_date_time 
-    : m_pDatum->DateTime();
+  ++m_iter;
+  Load();
 }
 
 template<class T> 
 void MergeCarrier<T>::Reset() {
-  m_pDatum = m_series.First();  // preload with first datum so we have it's time available for comparison
-  m_dt = ( 0 == m_pDatum ) 
-    ? boost::date_time::special_values::not_a_date_time 
-    : m_pDatum->DateTime();
+  m_iter = m_series.begin();
+  m_end = m_series.end();
+  Load();  // preload with first datum so we have it's time available for comparison
 }
 
 } // namespace tf
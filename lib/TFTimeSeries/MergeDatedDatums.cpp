@@ -16,6 +16,13 @@
 
 //#include "LibCommon/Log.h"
 
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+#include <cassert>
+
+#include <OUCommon/TimeSource.h>
+
 #include "MergeDatedDatums.h"
 
 namespace ou { // One Unified
@@ -31,30 +38,76 @@ MergeDatedDatums::MergeDatedDatums(void)
 }
 
 MergeDatedDatums::~MergeDatedDatums(void) {
-  while ( !m_mhCarriers.Empty() ) {
-    MergeCarrierBase *p = m_mhCarriers.RemoveEnd();
-    delete p;
+  for ( std::vector<MergeCarrierBase*>::iterator iter = m_vCarriers.begin(); m_vCarriers.end() != iter; ++iter ) {
+    delete *iter;
   }
 }
 
 void MergeDatedDatums::Add( TimeSeries<Quote>& series, MergeDatedDatums::OnDatumHandler function) {
-  m_mhCarriers.Append( new MergeCarrier<Quote>( series, function ) );
+  Add( new MergeCarrier<Quote>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<Trade>& series, MergeDatedDatums::OnDatumHandler function) {
-  m_mhCarriers.Append( new MergeCarrier<Trade>( series, function ) );
+  Add( new MergeCarrier<Trade>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<Bar>& series, MergeDatedDatums::OnDatumHandler function) {
-  m_mhCarriers.Append( new MergeCarrier<Bar>( series, function ) );
+  Add( new MergeCarrier<Bar>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<Greek>& series, MergeDatedDatums::OnDatumHandler function) {
-  m_mhCarriers.Append( new MergeCarrier<Greek>( series, function ) );
+  Add( new MergeCarrier<Greek>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<MarketDepth>& series, MergeDatedDatums::OnDatumHandler function) {
-  m_mhCarriers.Append( new MergeCarrier<MarketDepth>( series, function ) );
+  Add( new MergeCarrier<MarketDepth>( series, function ) );
+}
+
+void MergeDatedDatums::Add( MergeCarrierBase* pCarrier ) {
+  assert( eInit == m_state );
+  pCarrier->m_ixCarrier = m_vCarriers.size();
+  m_vCarriers.push_back( pCarrier );
+  m_vKey.push_back( pCarrier->m_nKey );
+}
+
+// leaves are carriers 0..n-1 at tree positions n..2n-1, internal node i has children 2i and 2i+1
+void MergeDatedDatums::BuildTournament( void ) {
+  const std::size_t n( m_vCarriers.size() );
+  m_vLoser.assign( n, 0 );
+  if ( 0 == n ) return;
+  std::vector<std::size_t> vWinner( 2 * n );
+  for ( std::size_t ix = 0; ix < n; ++ix ) {
+    vWinner[ n + ix ] = ix;
+  }
+  for ( std::size_t ix = n - 1; 0 < ix; --ix ) {
+    const std::size_t ixLeft( vWinner[ 2 * ix ] );
+    const std::size_t ixRight( vWinner[ 2 * ix + 1 ] );
+    if ( Beats( ixLeft, ixRight ) ) {
+      vWinner[ ix ] = ixLeft;
+      m_vLoser[ ix ] = ixRight;
+    }
+    else {
+      vWinner[ ix ] = ixRight;
+      m_vLoser[ ix ] = ixLeft;
+    }
+  }
+  m_vLoser[ 0 ] = ( 1 == n ) ? 0 : vWinner[ 1 ];
+}
+
+// keys are effectively random across carriers, so the comparison at each level
+//   is written to compile to conditional moves rather than an unpredictable branch
+void MergeDatedDatums::ReplayTournament( std::size_t ixCarrier ) {
+  std::size_t ixWinner( ixCarrier );
+  key_t nKeyWinner( m_vKey[ ixCarrier ] );
+  for ( std::size_t ixNode = ( ixCarrier + m_vCarriers.size() ) >> 1; 0 < ixNode; ixNode >>= 1 ) {
+    const std::size_t ixLoser( m_vLoser[ ixNode ] );
+    const key_t nKeyLoser( m_vKey[ ixLoser ] );
+    const bool bSwap( ( nKeyLoser < nKeyWinner ) | ( ( nKeyLoser == nKeyWinner ) & ( ixLoser < ixWinner ) ) );
+    m_vLoser[ ixNode ] = bSwap ? ixWinner : ixLoser;
+    ixWinner = bSwap ? ixLoser : ixWinner;
+    nKeyWinner = bSwap ? nKeyLoser : nKeyWinner;
+  }
+  m_vLoser[ 0 ] = ixWinner;
 }
 
 // http://www.codeguru.com/forum/archive/index.php/t-344661.html
@@ -73,30 +126,95 @@ protected:
 // the thread is not created in this class 
 // for example, see CSimulationProvider
 void MergeDatedDatums::Run() {
+  Merge( 0 );
+}
+
+void MergeDatedDatums::Run( vSchedule_t& vRecord ) {
+  if ( std::numeric_limits<idCarrier_t>::max() < m_vCarriers.size() ) {
+    throw std::runtime_error( "MergeDatedDatums::Run too many carriers to record" );
+  }
+  vRecord.clear();
+  vSchedule_t::size_type nDatums( 0 );
+  for ( std::vector<MergeCarrierBase*>::const_iterator iter = m_vCarriers.begin(); m_vCarriers.end() != iter; ++iter ) {
+    nDatums += (*iter)->Size();
+  }
+  vRecord.reserve( nDatums );
+  Merge( &vRecord );
+}
+
+void MergeDatedDatums::Merge( vSchedule_t* pvRecord ) {
   m_request = eRun;
-  size_t cntCarriers = m_mhCarriers.Size();
-//  LOG << "#carriers: " << cntCarriers;  // need cross thread writing 
-  MergeCarrierBase *pCarrier;
+//  LOG << "#carriers: " << m_vCarriers.size();  // need cross thread writing 
+  // resolve the (thread local) time source once rather than per datum
+  ou::TimeSource* pTimeSource( 0 );
+  if ( ou::TimeSource::LocalCommonInstance().GetSimulationMode() ) {
+    pTimeSource = &ou::TimeSource::LocalCommonInstance();
+  }
   m_cntProcessedDatums = 0;
   m_state = eRunning;
-  while ( ( 0 != cntCarriers ) && ( eRun == m_request ) ) {  // once all series have been depleted, end of run
-    pCarrier = m_mhCarriers.GetRoot();
+  BuildTournament();
+  while ( ( 0 != m_vCarriers.size() ) && ( eRun == m_request ) ) {
+    const std::size_t ixCarrier( m_vLoser[ 0 ] );
+    const key_t nKey( m_vKey[ ixCarrier ] );
+    if ( MergeCarrierBase::keyDepleted == nKey ) break;  // once all series have been depleted, end of run
+    if ( 0 != pvRecord ) pvRecord->push_back( (idCarrier_t) ixCarrier );
+    if ( 0 != pTimeSource ) pTimeSource->SetSimulationTime( MergeCarrierBase::DateTime( nKey ) );
+    MergeCarrierBase* pCarrier( m_vCarriers[ ixCarrier ] );
     pCarrier->ProcessDatum();  // automatically loads next datum when done
     ++m_cntProcessedDatums;
-    if ( NULL == pCarrier->GetDatedDatum() ) {
-      // retire the consumed carrier
-      m_mhCarriers.ArchiveRoot();
-      --cntCarriers;
-    }
-    else {
-      // reorder the carriers
-      m_mhCarriers.SiftDown();
-    }
+    m_vKey[ ixCarrier ] = pCarrier->m_nKey;
+    ReplayTournament( ixCarrier );
   }
   m_state = eStopped;
 //  LOG << "Merge stats: " << m_cntProcessedDatums << ", " << m_cntReorders;
 }
 
+// each carrier has to be consumed exactly to its end by the schedule
+bool MergeDatedDatums::Validate( const vSchedule_t& vSchedule ) const {
+  std::vector<std::size_t> vCount( m_vCarriers.size(), 0 );
+  for ( vSchedule_t::const_iterator iter = vSchedule.begin(); vSchedule.end() != iter; ++iter ) {
+    if ( vCount.size() <= *iter ) return false;
+    ++vCount[ *iter ];
+  }
+  for ( std::size_t ix = 0; ix < m_vCarriers.size(); ++ix ) {
+    if ( m_vCarriers[ ix ]->Size() != vCount[ ix ] ) return false;
+  }
+  if ( !vSchedule.empty() ) { // a series edited to the same length still shifts these, in most cases
+    ptime dtFirst( boost::posix_time::pos_infin );
+    ptime dtLast( boost::posix_time::neg_infin );
+    for ( std::size_t ix = 0; ix < m_vCarriers.size(); ++ix ) {
+      if ( 0 != vCount[ ix ] ) {
+        dtFirst = std::min( dtFirst, m_vCarriers[ ix ]->FirstDateTime() );
+        dtLast = std::max( dtLast, m_vCarriers[ ix ]->LastDateTime() );
+      }
+    }
+    if ( dtFirst != m_vCarriers[ vSchedule.front() ]->FirstDateTime() ) return false;
+    if ( dtLast != m_vCarriers[ vSchedule.back() ]->LastDateTime() ) return false;
+  }
+  return true;
+}
+
+// no tournament and no time comparisons, just the delegate for each datum in turn
+void MergeDatedDatums::Replay( const vSchedule_t& vSchedule ) {
+  assert( Validate( vSchedule ) );
+  m_request = eRun;
+  ou::TimeSource* pTimeSource( 0 );
+  if ( ou::TimeSource::LocalCommonInstance().GetSimulationMode() ) {
+    pTimeSource = &ou::TimeSource::LocalCommonInstance();
+  }
+  m_cntProcessedDatums = 0;
+  m_state = eRunning;
+  vSchedule_t::const_iterator iter = vSchedule.begin();
+  while ( ( vSchedule.end() != iter ) && ( eRun == m_request ) ) {
+    MergeCarrierBase* pCarrier( m_vCarriers[ *iter ] );
+    if ( 0 != pTimeSource ) pTimeSource->SetSimulationTime( MergeCarrierBase::DateTime( pCarrier->m_nKey ) );
+    pCarrier->ProcessDatum();
+    ++m_cntProcessedDatums;
+    ++iter;
+  }
+  m_state = eStopped;
+}
+
 void MergeDatedDatums::Stop( void ) {
   m_request = eStop;
 }
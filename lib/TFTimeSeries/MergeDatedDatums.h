@@ -16,8 +16,12 @@
 
 #include <vector>
 
+#include <boost/cstdint.hpp>
+
 // 2012/08/12 could try using std:priority_queue instead or boost::max_heap
-#include <OUCommon/MinHeap.h>
+// 2026/10/18 loser tree (tournament) on integer keys replaces the CMinHeap:
+//   one comparison per level on the way back to the root, against stored losers only,
+//   keys are in a contiguous vector rather than behind carrier pointers
 
 #include <OUCommon/FastDelegate.h>
 using namespace fastdelegate;
@@ -38,21 +42,46 @@ public:
 
   typedef FastDelegate1<const DatedDatum &> OnDatumHandler;
 
+  // a schedule is the carrier id (order of Add) for each datum, in merged order,
+  //   each carrier is consumed front to back, so the element index is implicit
+  typedef boost::uint16_t idCarrier_t;
+  typedef std::vector<idCarrier_t> vSchedule_t;
+
   void Add( TimeSeries<Quote>& series, OnDatumHandler );
   void Add( TimeSeries<Trade>& series, OnDatumHandler );
   void Add( TimeSeries<Bar>& series, OnDatumHandler );
   void Add( TimeSeries<Greek>& series, OnDatumHandler );
   void Add( TimeSeries<MarketDepth>& series, OnDatumHandler );
+
+  // typed handlers, no dynamic_cast required in the handler
+  template<typename T>
+  void Add( TimeSeries<T>& series, typename MergeCarrier<T>::OnTypedDatumHandler function ) {
+    Add( new MergeCarrier<T>( series, function ) );
+  }
+
+  void Add( MergeCarrierBase* ); // takes ownership, for carriers not backed by a TimeSeries
+
   void Run( void );
+  void Run( vSchedule_t& vRecord );  // tournament merge, recording the schedule for subsequent Replay
+  void Replay( const vSchedule_t& ); // straight scan, schedule from a Run over the same series
+  // schedule covers exactly the series added, and starts and ends on the series holding the first and last times
+  bool Validate( const vSchedule_t& ) const;
   void Stop( void );
 
   enumMergingState GetState( void ) const { return m_state; };
 
+  std::size_t Carriers( void ) const { return m_vCarriers.size(); };
+  const MergeCarrierBase& Carrier( std::size_t ix ) const { return *m_vCarriers[ ix ]; }; // in order of Add
+
   unsigned long GetCountProcessedDatums( void ) const { return m_cntProcessedDatums; };
 
 protected:
 
-  ou::CMinHeap<MergeCarrierBase*, MergeCarrierBase> m_mhCarriers;
+  typedef MergeCarrierBase::key_t key_t;
+
+  std::vector<MergeCarrierBase*> m_vCarriers; // order of Add, indexed by idCarrier_t
+  std::vector<key_t> m_vKey; // current key of each carrier
+  std::vector<std::size_t> m_vLoser; // [0] is the overall winner, [1..n-1] the loser at each internal node
 
   // not all states or commands are implemented yet
   enum enumMergingCommands { eUnknown, eRun, eStop, ePause, eResume, eReset };
@@ -62,6 +91,15 @@ protected:
 
   unsigned long m_cntProcessedDatums;
 
+  void Merge( vSchedule_t* pvRecord );
+
+  // earlier key wins, ties go to the earlier Add, so merges are deterministic
+  bool Beats( std::size_t ixLhs, std::size_t ixRhs ) const {
+    return ( m_vKey[ ixLhs ] < m_vKey[ ixRhs ] ) || ( ( m_vKey[ ixLhs ] == m_vKey[ ixRhs ] ) && ( ixLhs < ixRhs ) );
+  }
+  void BuildTournament( void );
+  void ReplayTournament( std::size_t ixCarrier ); // after the winner's key has changed
+
 private:
 
 };
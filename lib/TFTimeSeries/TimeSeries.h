@@ -23,6 +23,7 @@
 //#include <boost/thread/lock_types.hpp>
 
 #include <OUCommon/Delegate.h>
+#include <OUCommon/SegmentedVector.h>
 
 #include "DatedDatum.h"
 #include "TSAllocator.h"
@@ -91,7 +92,7 @@ private:
   boost::mutex m_mutex;
 };
 */
-template<typename T> 
+template<typename T, typename Container = std::vector<T, ou::allocator<T, heap<T> > > > 
 class TimeSeries: 
   public TimeSeriesBase
 //  ,public Lockable 
@@ -102,7 +103,7 @@ public:
   
   typedef typename ou::allocator<T, heap<T> > allocator_t;
   
-  typedef typename std::vector<T, allocator_t> vTimeSeries_t;
+  typedef Container vTimeSeries_t;  // std::vector, or ou::SegmentedVector for large live series
 
   typedef typename vTimeSeries_t::size_type size_type;
 
@@ -111,11 +112,11 @@ public:
   typedef typename vTimeSeries_t::reference reference;
   typedef typename vTimeSeries_t::const_reference const_reference;
   
-  TimeSeries<T>( void );
-  TimeSeries<T>( size_type nSize );
-  TimeSeries<T>( const std::string& sName, size_type nSize = 0 );
-  TimeSeries<T>( const TimeSeries<T>& );
-  virtual ~TimeSeries<T>( void );
+  TimeSeries( void );
+  TimeSeries( size_type nSize );
+  TimeSeries( const std::string& sName, size_type nSize = 0 );
+  TimeSeries( const TimeSeries& );
+  virtual ~TimeSeries( void );
 
   size_type Size() const { return m_vSeries.size(); };
 
@@ -157,8 +158,8 @@ public:
   void SetName( const std::string& sName ) { m_sName = sName; };
   const std::string& GetName( void ) const { return m_sName; };
 
-  virtual TimeSeries<T>* Subset( const ptime &time ); // from At or After to end
-  virtual TimeSeries<T>* Subset( const ptime &time, unsigned int n ); // from At or After for n T
+  virtual TimeSeries* Subset( const ptime &time ); // from At or After to end
+  virtual TimeSeries* Subset( const ptime &time, unsigned int n ); // from At or After for n T
 
   H5::DataSpace* DefineDataSpace( H5::DataSpace* pSpace = NULL );
 
@@ -167,6 +168,10 @@ public:
   
   size_type Capacity( void ) const { return m_vSeries.capacity(); }
 
+  // SegmentedVector only: frees whole blocks before ix for rolling retention,
+  //   returns count released, indexes held by callers shift down by that amount
+  size_type ReleaseBefore( size_type ix );
+
   // TSVariance, TSMA uses this, sets to false
   void DisableAppend( void ) { m_bAppendToVector = false; };
   bool AppendEnabled( void ) const { return m_bAppendToVector; };  // affects Append(...) only
@@ -190,44 +195,44 @@ private:
   
 };
 
-template<typename T> 
-TimeSeries<T>::TimeSeries(void)
+template<typename T, typename C>
+TimeSeries<T,C>::TimeSeries(void)
   : TimeSeries( "", 0 ) {
   
 }
 
-template<typename T> 
-TimeSeries<T>::TimeSeries( size_type size )
+template<typename T, typename C>
+TimeSeries<T,C>::TimeSeries( size_type size )
   : TimeSeries( "", size ) {
 }
 
-template<typename T>
-TimeSeries<T>::TimeSeries( const std::string& sName, size_type nSize )
+template<typename T, typename C>
+TimeSeries<T,C>::TimeSeries( const std::string& sName, size_type nSize )
   : m_vIterator( m_vSeries.end() ), m_sName( sName ), m_bAppendToVector( true ) {
-  //m_vSeries.get_allocator().lockRequest = fastdelegate::MakeDelegate( this, &TimeSeries<T>::lock );
+  //m_vSeries.get_allocator().lockRequest = fastdelegate::MakeDelegate( this, &TimeSeries<T,C>::lock );
   //m_lock = boost::unique_lock<boost::mutex>( m_mutex, boost::defer_lock );
   if ( ( 0 != nSize ) && ( m_vSeries.size() < nSize ) ) m_vSeries.reserve( nSize );
 }
 
 // this probably isn't going to work as the mutex may make this non-copyable
-template<typename T>
-TimeSeries<T>::TimeSeries( const TimeSeries<T>& series )
+template<typename T, typename C>
+TimeSeries<T,C>::TimeSeries( const TimeSeries<T,C>& series )
   : m_bAppendToVector( series.m_bAppendToVector ) {
   m_vSeries = series.m_vSeries;
   //assert( !m_bLock );
-  //m_vSeries.get_allocator().lockRequest = fastdelegate::MakeDelegate( this, &TimeSeries<T>::lock );
+  //m_vSeries.get_allocator().lockRequest = fastdelegate::MakeDelegate( this, &TimeSeries<T,C>::lock );
   //m_lock = boost::unique_lock<boost::mutex>( m_mutex, boost::defer_lock );
   m_vIterator = m_vSeries.end();
 }
 
-template<typename T> 
-TimeSeries<T>::~TimeSeries(void) {
+template<typename T, typename C>
+TimeSeries<T,C>::~TimeSeries(void) {
   //m_vSeries.get_allocator().lockRequest = 0;
   Clear();
 }
 
-template<typename T> 
-void TimeSeries<T>::Append(const T& datum) {
+template<typename T, typename C>
+void TimeSeries<T,C>::Append(const T& datum) {
   //strict_lock<TimeSeries<T> > guard(*this);
   if ( m_bAppendToVector ) {
     m_vSeries.push_back( datum );
@@ -243,8 +248,8 @@ void TimeSeries<T>::Append(const T& datum) {
   OnAppend( datum );
 }
 
-template<typename T> 
-void TimeSeries<T>::Insert( const ptime& dt, const T& datum ) {
+template<typename T, typename C>
+void TimeSeries<T,C>::Insert( const ptime& dt, const T& datum ) {
   T key( dt );
   std::pair<iterator, iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
@@ -257,8 +262,8 @@ void TimeSeries<T>::Insert( const ptime& dt, const T& datum ) {
   }
 }
 
-template<typename T> 
-void TimeSeries<T>::Insert( const T& datum ) {
+template<typename T, typename C>
+void TimeSeries<T,C>::Insert( const T& datum ) {
   std::pair<iterator, iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
   p = equal_range( m_vSeries.begin(), m_vSeries.end(), datum );
@@ -270,15 +275,15 @@ void TimeSeries<T>::Insert( const T& datum ) {
   }
 }
 
-template<typename T> 
-void TimeSeries<T>::Clear( void ) {
+template<typename T, typename C>
+void TimeSeries<T,C>::Clear( void ) {
   //strict_lock<TimeSeries<T> > guard(*this);
   m_vSeries.clear();
 }
 
 
-template<typename T> 
-const T* TimeSeries<T>::First() {
+template<typename T, typename C>
+const T* TimeSeries<T,C>::First() {
   //strict_lock<TimeSeries<T> > guard(*this);
   m_vIterator = m_vSeries.begin();
   if ( m_vSeries.end() == m_vIterator ) {
@@ -289,8 +294,8 @@ const T* TimeSeries<T>::First() {
   }
 }
 
-template<typename T> 
-const T* TimeSeries<T>::Next() {
+template<typename T, typename C>
+const T* TimeSeries<T,C>::Next() {
   //strict_lock<TimeSeries<T> > guard(*this);
   if ( m_vSeries.end() == m_vIterator ) {
     return NULL;
@@ -306,8 +311,8 @@ const T* TimeSeries<T>::Next() {
   }
 }
 
-template<typename T> 
-const T* TimeSeries<T>::Last() {
+template<typename T, typename C>
+const T* TimeSeries<T,C>::Last() {
   //strict_lock<TimeSeries<T> > guard(*this);
   m_vIterator = m_vSeries.end();
   if ( 0 == m_vSeries.size() ) {
@@ -319,8 +324,8 @@ const T* TimeSeries<T>::Last() {
   }
 }
 
-template<typename T> 
-typename TimeSeries<T>::const_reference TimeSeries<T>::Ago( size_type ix ) {
+template<typename T, typename C>
+typename TimeSeries<T,C>::const_reference TimeSeries<T,C>::Ago( size_type ix ) {
   //strict_lock<TimeSeries<T> > guard(*this);
   assert( ix < m_vSeries.size() );
   typename vTimeSeries_t::const_reverse_iterator iter( m_vSeries.rbegin() );
@@ -328,23 +333,23 @@ typename TimeSeries<T>::const_reference TimeSeries<T>::Ago( size_type ix ) {
   return *iter;
 }
 
-template<typename T> 
-typename TimeSeries<T>::const_reference TimeSeries<T>::operator []( size_type ix ) {
+template<typename T, typename C>
+typename TimeSeries<T,C>::const_reference TimeSeries<T,C>::operator []( size_type ix ) {
   //strict_lock<TimeSeries<T> > guard(*this);
   assert( ix < m_vSeries.size() );
   return m_vSeries.at( ix );
 }
 
-template<typename T> 
-typename TimeSeries<T>::const_reference TimeSeries<T>::At( size_type ix ) {
+template<typename T, typename C>
+typename TimeSeries<T,C>::const_reference TimeSeries<T,C>::At( size_type ix ) {
   //strict_lock<TimeSeries<T> > guard(*this);
   assert( ix < m_vSeries.size() );
   return m_vSeries.at( ix );
 }
 
 /*
-template<typename T> 
-typename TimeSeries<T>::const_reference TimeSeries<T>::At( const ptime& dt ) {
+template<typename T, typename C>
+typename TimeSeries<T,C>::const_reference TimeSeries<T,C>::At( const ptime& dt ) {
   // assumes sorted vector
   // assumes valid access, else undefined
   // TODO: Check that this is correct
@@ -359,8 +364,8 @@ typename TimeSeries<T>::const_reference TimeSeries<T>::At( const ptime& dt ) {
 }
 */
 
-template<typename T> 
-typename TimeSeries<T>::const_iterator TimeSeries<T>::AtOrAfter( const ptime &dt ) const {
+template<typename T, typename C>
+typename TimeSeries<T,C>::const_iterator TimeSeries<T,C>::AtOrAfter( const ptime &dt ) const {
   // assumes sorted vector
   // assumes valid access, else undefined
   // TODO: Check that this is correct
@@ -375,8 +380,8 @@ typename TimeSeries<T>::const_iterator TimeSeries<T>::AtOrAfter( const ptime &dt
   return p.first;
 }
 
-template<typename T> 
-typename TimeSeries<T>::const_iterator TimeSeries<T>::After( const ptime &dt ) const {
+template<typename T, typename C>
+typename TimeSeries<T,C>::const_iterator TimeSeries<T,C>::After( const ptime &dt ) const {
   // assumes sorted vector
   // assumes valid access, else undefined
   // TODO: Check that this is correct
@@ -387,42 +392,42 @@ typename TimeSeries<T>::const_iterator TimeSeries<T>::After( const ptime &dt ) c
   return p.second;
 }
 
-template<typename T> 
-void TimeSeries<T>::Sort( void ) {
+template<typename T, typename C>
+void TimeSeries<T,C>::Sort( void ) {
   //strict_lock<TimeSeries<T> > guard(*this);
   sort( m_vSeries.begin(), m_vSeries.end() );  // may not keep time series with identical keys in acquired order (may not be an issue, as external clock is written to be monotonically increasing)
 }
 
-template<typename T> 
-TimeSeries<T>* TimeSeries<T>::Subset( const ptime &dt ) {
+template<typename T, typename C>
+TimeSeries<T,C>* TimeSeries<T,C>::Subset( const ptime &dt ) {
   T datum( dt );
-  TimeSeries<T>* series = nullptr;
+  TimeSeries<T,C>* series = nullptr;
   const_iterator iter;
   //strict_lock<TimeSeries<T> > guard(*this);
   iter = lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() != iter ) {
-    series = new TimeSeries<T>( (unsigned int) (m_vSeries.end() - iter) );
+    series = new TimeSeries<T,C>( (unsigned int) (m_vSeries.end() - iter) );
     while ( m_vSeries.end() != iter ) {
       series->Append( *iter );
       ++iter;
     }
   }
   else {
-    series = new TimeSeries<T>();
+    series = new TimeSeries<T,C>();
   }
   return series;
 }
 
-template<typename T> 
-TimeSeries<T>* TimeSeries<T>::Subset( const ptime &dt, unsigned int n ) { // n is max count
+template<typename T, typename C>
+TimeSeries<T,C>* TimeSeries<T,C>::Subset( const ptime &dt, unsigned int n ) { // n is max count
   T datum( dt );
-  TimeSeries<T>* series = NULL;
+  TimeSeries<T,C>* series = NULL;
   const_iterator iter;
   //strict_lock<TimeSeries<T> > guard(*this);
   iter = lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() != iter ) {
     unsigned int todo = std::min<unsigned int>( n, (unsigned int) ( m_vSeries.end() - iter ) );
-    series = new TimeSeries<T>( todo );
+    series = new TimeSeries<T,C>( todo );
     while ( 0 < todo ) {
       series->Append( *iter );
       ++iter;
@@ -430,13 +435,21 @@ TimeSeries<T>* TimeSeries<T>::Subset( const ptime &dt, unsigned int n ) { // n i
     }
   }
   else {
-    series = new TimeSeries<T>();
+    series = new TimeSeries<T,C>();
   }
   return series;
 }
 
-template<typename T> 
-H5::DataSpace* TimeSeries<T>::DefineDataSpace( H5::DataSpace* pSpace ) {
+template<typename T, typename C>
+typename TimeSeries<T,C>::size_type TimeSeries<T,C>::ReleaseBefore( size_type ix ) {
+  //strict_lock<TimeSeries<T> > guard(*this);
+  size_type nReleased = m_vSeries.release_front( ix );
+  m_vIterator = m_vSeries.end();
+  return nReleased;
+}
+
+template<typename T, typename C>
+H5::DataSpace* TimeSeries<T,C>::DefineDataSpace( H5::DataSpace* pSpace ) {
   if ( NULL == pSpace ) pSpace = new H5::DataSpace( H5S_SIMPLE );
   hsize_t curSize = m_vSeries.size();
   hsize_t maxSize = H5S_UNLIMITED; 
@@ -450,6 +463,10 @@ H5::DataSpace* TimeSeries<T>::DefineDataSpace( H5::DataSpace* pSpace ) {
   return pSpace; 
 }
 
+// large live series: elements never move as the series grows, old blocks can be released
+template<typename T>
+using SegmentedTimeSeries = TimeSeries<T, ou::SegmentedVector<T> >;
+
 // Bars
 
 class Bars: public TimeSeries<Bar> {
@@ -0,0 +1,62 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#pragma once
+
+// read side of a stored time series, independent of where it is kept
+//   implementations: FlatFileTimeSeries (memory mapped files, TFTimeSeries)
+//                    HDF5TimeSeriesStore (datasets in the hdf5 file, TFHDF5TimeSeries)
+// DD is one of the pod datums (DatedDatumPod.h), which are what both backends store
+// Shared() tells whether one instance may be read from several threads at once,
+//   otherwise each thread needs its own instance, and, for hdf5, reads are serialized by the library anyway
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+template<class DD>
+class TimeSeriesStore: boost::noncopyable {
+public:
+
+  typedef boost::uint64_t size_type;
+
+  virtual ~TimeSeriesStore( void ) {};
+
+  virtual size_type Size( void ) = 0;
+  virtual bool Shared( void ) const = 0;
+
+  virtual void Read( size_type ixStart, size_type count, DD* p ) = 0; // [ixStart, ixStart + count) needs to be within Size()
+  virtual size_type LowerBound( const boost::posix_time::ptime& dt ) = 0; // first at or after dt, Size() if none
+
+  // the datums in [dtBegin, dtEnd) replace the content of v
+  void Read( const boost::posix_time::ptime& dtBegin, const boost::posix_time::ptime& dtEnd, std::vector<DD>& v ) {
+    const size_type ixBegin = LowerBound( dtBegin );
+    const size_type ixEnd = LowerBound( dtEnd );
+    v.resize( ( ixBegin < ixEnd ) ? ixEnd - ixBegin : 0 );
+    if ( !v.empty() ) Read( ixBegin, v.size(), &v[ 0 ] );
+  }
+
+protected:
+private:
+};
+
+} // namespace tf
+} // namespace ou
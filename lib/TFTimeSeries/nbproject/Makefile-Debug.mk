@@ -36,9 +36,12 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 # Object Files
 OBJECTFILES= \
 	${OBJECTDIR}/BarFactory.o \
+	${OBJECTDIR}/DailyBarPanel.o \
 	${OBJECTDIR}/DatedDatum.o \
+	${OBJECTDIR}/DatedDatumPod.o \
 	${OBJECTDIR}/DoubleBuffer.o \
 	${OBJECTDIR}/ExchangeHolidays.o \
+	${OBJECTDIR}/FlatFileTimeSeries.o \
 	${OBJECTDIR}/MergeDatedDatums.o \
 	${OBJECTDIR}/TSAllocator.o \
 	${OBJECTDIR}/TSMicrostructure.o \
@@ -77,11 +80,21 @@ ${OBJECTDIR}/BarFactory.o: BarFactory.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/BarFactory.o BarFactory.cpp
 
+${OBJECTDIR}/DailyBarPanel.o: DailyBarPanel.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/DailyBarPanel.o DailyBarPanel.cpp
+
 ${OBJECTDIR}/DatedDatum.o: DatedDatum.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/DatedDatum.o DatedDatum.cpp
 
+${OBJECTDIR}/DatedDatumPod.o: DatedDatumPod.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/DatedDatumPod.o DatedDatumPod.cpp
+
 ${OBJECTDIR}/DoubleBuffer.o: DoubleBuffer.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -92,6 +105,11 @@ ${OBJECTDIR}/ExchangeHolidays.o: ExchangeHolidays.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ExchangeHolidays.o ExchangeHolidays.cpp
 
+${OBJECTDIR}/FlatFileTimeSeries.o: FlatFileTimeSeries.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/FlatFileTimeSeries.o FlatFileTimeSeries.cpp
+
 ${OBJECTDIR}/MergeDatedDatums.o: MergeDatedDatums.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
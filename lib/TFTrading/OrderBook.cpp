@@ -0,0 +1,397 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+// Started 2026/10/18
+
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+#include "OrderBook.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+OrderBook::OrderBook( price_t dblTickSize, unsigned int nTop, unsigned int nWindow, unsigned int nWindowMax )
+: m_dblTickSize( dblTickSize ), m_nTop( nTop ), m_nWindow( std::max<unsigned int>( 64, nWindow ) ),
+  m_nWindowMax( std::max<unsigned int>( m_nWindow, nWindowMax ) ),
+  m_bBased( false ), m_bWide( false ), m_tickBase( 0 ), m_bTopChanged( false ),
+  m_vMarketMakerSlot( 64, 0 )
+{
+  m_top.vBid.reserve( m_nTop );
+  m_top.vAsk.reserve( m_nTop );
+}
+
+OrderBook::~OrderBook( void ) {
+}
+
+void OrderBook::Clear( void ) {
+  m_bBased = false;
+  m_bWide = false;
+  for ( int side = 0; side < 2; ++side ) {
+    m_rSide[ side ] = Side();
+  }
+  m_vMarketMaker.clear();
+  m_vMarketMakerSlot.assign( m_vMarketMakerSlot.size(), 0 );
+  m_bTopChanged = true;
+}
+
+OrderBook::tick_t OrderBook::Tick( price_t dblPrice ) const {
+  return static_cast<tick_t>( std::floor( dblPrice / m_dblTickSize + 0.5 ) );
+}
+
+OrderBook::MarketMaker& OrderBook::FindMarketMaker( MMID_t mmid ) {
+  const std::size_t mask = m_vMarketMakerSlot.size() - 1;
+  std::size_t ix = static_cast<std::size_t>( ( mmid * 0x9E3779B97F4A7C15ULL ) >> 32 ) & mask;
+  for ( ; 0 != m_vMarketMakerSlot[ ix ]; ix = ( ix + 1 ) & mask ) {
+    MarketMaker& mm( m_vMarketMaker[ m_vMarketMakerSlot[ ix ] - 1 ] );
+    if ( mmid == mm.mmid ) return mm;
+  }
+  // not present
+  m_vMarketMaker.push_back( MarketMaker( mmid ) );
+  if ( m_vMarketMakerSlot.size() < 2 * m_vMarketMaker.size() ) {
+    m_vMarketMakerSlot.assign( 2 * m_vMarketMakerSlot.size(), 0 );
+    for ( std::size_t ixMM = 0; ixMM < m_vMarketMaker.size(); ++ixMM ) {
+      PlaceMarketMaker( m_vMarketMaker[ ixMM ].mmid, static_cast<boost::uint32_t>( ixMM + 1 ) );
+    }
+  }
+  else {
+    m_vMarketMakerSlot[ ix ] = static_cast<boost::uint32_t>( m_vMarketMaker.size() );
+  }
+  return m_vMarketMaker.back();
+}
+
+void OrderBook::PlaceMarketMaker( MMID_t mmid, boost::uint32_t ix ) {
+  const std::size_t mask = m_vMarketMakerSlot.size() - 1;
+  std::size_t ixSlot = static_cast<std::size_t>( ( mmid * 0x9E3779B97F4A7C15ULL ) >> 32 ) & mask;
+  while ( 0 != m_vMarketMakerSlot[ ixSlot ] ) ixSlot = ( ixSlot + 1 ) & mask;
+  m_vMarketMakerSlot[ ixSlot ] = ix;
+}
+
+void OrderBook::Rebase( void ) {
+  // centre the array on the quotes, doubling it, up to m_nWindowMax, until they fill no more than half,
+  //   when they don't fit, centre it on the inside, the quotes away from it go to the maps,
+  //   when the inside doesn't fit, centre it on the best of the side with more quotes
+  tick_t tickMin( 0 );
+  tick_t tickMax( 0 );
+  tick_t rtickBest[ 2 ] = { 0, 0 };  // Bid, Ask
+  bool rbBest[ 2 ] = { false, false };
+  std::size_t rnQuotes[ 2 ] = { 0, 0 };
+  for ( vMarketMaker_t::const_iterator iter = m_vMarketMaker.begin(); m_vMarketMaker.end() != iter; ++iter ) {
+    for ( int side = 0; side < 2; ++side ) {
+      const Quote& quote( iter->rQuote[ side ] );
+      if ( quote.bActive ) {
+        ++rnQuotes[ side ];
+        if ( !rbBest[ 0 ] && !rbBest[ 1 ] ) {
+          tickMin = tickMax = quote.tick;
+        }
+        tickMin = std::min( tickMin, quote.tick );
+        tickMax = std::max( tickMax, quote.tick );
+        if ( !rbBest[ side ] || ( ( MarketDepth::Bid == side ) ? ( quote.tick > rtickBest[ side ] ) : ( quote.tick < rtickBest[ side ] ) ) ) {
+          rtickBest[ side ] = quote.tick;
+          rbBest[ side ] = true;
+        }
+      }
+    }
+  }
+
+  unsigned int nWindow( m_nWindow );
+  while ( ( nWindow < 2 * ( tickMax - tickMin + 1 ) ) && ( nWindow < m_nWindowMax ) ) {
+    nWindow = static_cast<unsigned int>( std::min<tick_t>( 2 * static_cast<tick_t>( nWindow ), m_nWindowMax ) );
+  }
+  m_bWide = false;
+  if ( 2 * ( tickMax - tickMin + 1 ) <= nWindow ) {
+    m_tickBase = ( tickMin + tickMax ) / 2 - nWindow / 2;
+  }
+  else {  // nWindow is m_nWindowMax
+    const tick_t tickBid( rbBest[ MarketDepth::Bid ] ? rtickBest[ MarketDepth::Bid ] : rtickBest[ MarketDepth::Ask ] );
+    const tick_t tickAsk( rbBest[ MarketDepth::Ask ] ? rtickBest[ MarketDepth::Ask ] : rtickBest[ MarketDepth::Bid ] );
+    const tick_t tickLo( std::min( tickBid, tickAsk ) );  // crossed, at times
+    const tick_t tickHi( std::max( tickBid, tickAsk ) );
+    if ( 2 * ( tickHi - tickLo + 1 ) <= nWindow ) {
+      m_tickBase = ( tickLo + tickHi ) / 2 - nWindow / 2;
+    }
+    else {
+      m_bWide = true;
+      const int sideAnchor( ( rnQuotes[ MarketDepth::Ask ] > rnQuotes[ MarketDepth::Bid ] ) ? MarketDepth::Ask : MarketDepth::Bid );
+      m_tickBase = rtickBest[ sideAnchor ] - nWindow / 2;
+    }
+  }
+  m_nWindow = nWindow;
+  m_bBased = true;
+
+  for ( int side = 0; side < 2; ++side ) {
+    m_rSide[ side ].vSlot.assign( m_nWindow, Slot() );
+    m_rSide[ side ].mapOutside.clear();
+    m_rSide[ side ].ixBest = -1;
+    m_rSide[ side ].ixTopEdge = -1;
+    m_rSide[ side ].nLevels = 0;
+  }
+  for ( vMarketMaker_t::const_iterator iter = m_vMarketMaker.begin(); m_vMarketMaker.end() != iter; ++iter ) {
+    for ( int side = 0; side < 2; ++side ) {
+      const Quote& quote( iter->rQuote[ side ] );
+      if ( quote.bActive ) AddTick( static_cast<ESide>( side ), quote.tick, quote.nVolume );
+    }
+  }
+  m_bTopChanged = true;
+}
+
+bool OrderBook::Better( ESide eSide, tick_t tick ) const {
+  return ( MarketDepth::Bid == eSide ) ? ( m_tickBase + m_nWindow <= tick ) : ( tick < m_tickBase );
+}
+
+bool OrderBook::BestTick( ESide eSide, tick_t& tick ) const {
+  const Side& side( m_rSide[ eSide ] );
+  const mapSlot_t& map( side.mapOutside );
+  if ( !map.empty() ) {
+    const tick_t tickMap( ( MarketDepth::Bid == eSide ) ? map.rbegin()->first : map.begin()->first );
+    if ( ( 0 > side.ixBest ) || Better( eSide, tickMap ) ) {
+      tick = tickMap;
+      return true;
+    }
+  }
+  if ( 0 > side.ixBest ) return false;
+  tick = m_tickBase + side.ixBest;
+  return true;
+}
+
+bool OrderBook::InsideFits( void ) const {
+  tick_t tickBid;
+  tick_t tickAsk;
+  if ( !BestTick( MarketDepth::Bid, tickBid ) || !BestTick( MarketDepth::Ask, tickAsk ) ) return true;
+  const tick_t nInside( ( tickBid < tickAsk ) ? ( tickAsk - tickBid + 1 ) : ( tickBid - tickAsk + 1 ) );
+  return 2 * nInside <= m_nWindowMax;
+}
+
+void OrderBook::AddTick( ESide eSide, tick_t tick, volume_t nVolume ) {
+  if ( InWindow( tick ) ) {
+    Add( eSide, static_cast<int>( tick - m_tickBase ), nVolume );
+  }
+  else {
+    Slot& slot( m_rSide[ eSide ].mapOutside[ tick ] );
+    slot.nVolume += static_cast<boost::uint32_t>( nVolume );
+    ++slot.nQuotes;
+    if ( ( 0 > m_rSide[ eSide ].ixTopEdge ) || Better( eSide, tick ) ) m_bTopChanged = true;  // the top reaches into the map
+  }
+}
+
+void OrderBook::RemoveTick( ESide eSide, tick_t tick, volume_t nVolume ) {
+  if ( InWindow( tick ) ) {
+    Remove( eSide, static_cast<int>( tick - m_tickBase ), nVolume );
+  }
+  else {
+    mapSlot_t& map( m_rSide[ eSide ].mapOutside );
+    mapSlot_t::iterator iter = map.find( tick );
+    assert( map.end() != iter );
+    iter->second.nVolume -= static_cast<boost::uint32_t>( nVolume );
+    if ( 0 == --iter->second.nQuotes ) map.erase( iter );
+    if ( ( 0 > m_rSide[ eSide ].ixTopEdge ) || Better( eSide, tick ) ) m_bTopChanged = true;
+  }
+}
+
+void OrderBook::NoteTop( ESide eSide, int ix ) {
+  const int ixEdge = m_rSide[ eSide ].ixTopEdge;
+  if ( ( 0 > ixEdge ) || ( ( MarketDepth::Bid == eSide ) ? ( ix >= ixEdge ) : ( ix <= ixEdge ) ) ) {
+    m_bTopChanged = true;
+  }
+}
+
+void OrderBook::Add( ESide eSide, int ix, volume_t nVolume ) {
+  Side& side( m_rSide[ eSide ] );
+  Slot& slot( side.vSlot[ ix ] );
+  slot.nVolume += static_cast<boost::uint32_t>( nVolume );
+  if ( 0 == slot.nQuotes++ ) {
+    ++side.nLevels;
+    if ( ( 0 > side.ixBest ) || ( ( MarketDepth::Bid == eSide ) ? ( ix > side.ixBest ) : ( ix < side.ixBest ) ) ) {
+      side.ixBest = ix;
+    }
+  }
+  NoteTop( eSide, ix );
+}
+
+void OrderBook::Remove( ESide eSide, int ix, volume_t nVolume ) {
+  Side& side( m_rSide[ eSide ] );
+  Slot& slot( side.vSlot[ ix ] );
+  slot.nVolume -= static_cast<boost::uint32_t>( nVolume );
+  if ( 0 == --slot.nQuotes ) {
+    slot.nVolume = 0;
+    --side.nLevels;
+    if ( ix == side.ixBest ) {
+      if ( 0 == side.nLevels ) {
+        side.ixBest = -1;
+      }
+      else {
+        // the next level is there to be found, in the worse direction
+        int ixNext( ix );
+        if ( MarketDepth::Bid == eSide ) {
+          do { --ixNext; } while ( 0 == side.vSlot[ ixNext ].nQuotes );
+        }
+        else {
+          do { ++ixNext; } while ( 0 == side.vSlot[ ixNext ].nQuotes );
+        }
+        side.ixBest = ixNext;
+      }
+    }
+  }
+  NoteTop( eSide, ix );
+}
+
+bool OrderBook::Update( const boost::posix_time::ptime& dt, ESide eSide, MMID_t mmid, price_t dblPrice, volume_t nVolume ) {
+
+  if ( ( MarketDepth::Bid != eSide ) && ( MarketDepth::Ask != eSide ) ) return false;
+
+  m_dtLast = dt;
+  MarketMaker& mm( FindMarketMaker( mmid ) );
+  Quote& quote( mm.rQuote[ eSide ] );
+
+  if ( 1e15 * m_dblTickSize <= dblPrice ) return false;  // no tick for it
+
+  const bool bQuote = ( 0.0 < dblPrice ) && ( 0 < nVolume );
+  const tick_t tick = bQuote ? Tick( dblPrice ) : 0;
+  if ( bQuote ) {
+    if ( quote.bActive && ( tick == quote.tick ) && ( nVolume == quote.nVolume ) ) return false;  // repeated
+  }
+  else {
+    if ( !quote.bActive ) return false;  // nothing to withdraw
+  }
+
+  const bool bOld( quote.bActive );
+  const tick_t tickOld( quote.tick );
+  if ( quote.bActive ) {
+    RemoveTick( eSide, quote.tick, quote.nVolume );
+    quote.bActive = false;
+  }
+
+  if ( bQuote ) {
+    quote.tick = tick;
+    quote.nVolume = nVolume;
+    quote.bActive = true;
+    if ( !m_bBased || ( !m_bWide && !InWindow( tick ) && ( Better( eSide, tick ) || ( m_nWindow < m_nWindowMax ) ) ) ) {
+      Rebase();  // places this quote with the others
+    }
+    else {
+      AddTick( eSide, tick, nVolume );
+    }
+  }
+
+  const Side& side( m_rSide[ eSide ] );
+  if ( m_bWide ) {
+    if ( InsideFits() ) Rebase();  // the wide inside has closed
+  }
+  else {
+    if ( ( 0 == side.nLevels ) && !side.mapOutside.empty() ) Rebase();  // the best is in the map, bring it into the array
+  }
+
+  if ( !OnChange.IsEmpty() ) {
+    if ( bOld ) EmitChange( eSide, tickOld );
+    if ( bQuote && ( !bOld || ( tick != tickOld ) ) ) EmitChange( eSide, tick );
+  }
+  return true;
+}
+
+void OrderBook::EmitChange( ESide eSide, tick_t tick ) {
+  const Side& side( m_rSide[ eSide ] );
+  Slot slot;
+  if ( InWindow( tick ) ) {
+    slot = side.vSlot[ static_cast<int>( tick - m_tickBase ) ];
+  }
+  else {
+    mapSlot_t::const_iterator iter = side.mapOutside.find( tick );
+    if ( side.mapOutside.end() != iter ) slot = iter->second;
+  }
+  Change change;
+  change.dt = m_dtLast;
+  change.eSide = eSide;
+  change.level = Level( tick * m_dblTickSize, slot.nVolume, slot.nQuotes );
+  OnChange( change );
+}
+
+void OrderBook::EndOfGroup( void ) {
+  if ( !m_bTopChanged ) return;
+  m_bTopChanged = false;
+  if ( OnTop.IsEmpty() ) {
+    // without a published top, any change is taken to change it
+    m_rSide[ MarketDepth::Bid ].ixTopEdge = -1;
+    m_rSide[ MarketDepth::Ask ].ixTopEdge = -1;
+  }
+  else {
+    m_top.dt = m_dtLast;
+    m_rSide[ MarketDepth::Bid ].ixTopEdge = FillTop( MarketDepth::Bid, m_top.vBid );
+    m_rSide[ MarketDepth::Ask ].ixTopEdge = FillTop( MarketDepth::Ask, m_top.vAsk );
+    OnTop( m_top );
+  }
+}
+
+int OrderBook::FillTop( ESide eSide, vLevel_t& vLevel ) const {
+  vLevel.clear();
+  const Side& side( m_rSide[ eSide ] );
+  const mapSlot_t& map( side.mapOutside );
+  const bool bBid( MarketDepth::Bid == eSide );
+  mapSlot_t::const_reverse_iterator iterBid = map.rbegin();  // map levels, best first
+  mapSlot_t::const_iterator iterAsk = map.begin();
+  // first the map levels better than the array, there only with a wide inside
+  if ( bBid ) {
+    for ( ; ( map.rend() != iterBid ) && Better( eSide, iterBid->first ) && ( m_nTop > vLevel.size() ); ++iterBid ) {
+      vLevel.push_back( Level( iterBid->first * m_dblTickSize, iterBid->second.nVolume, iterBid->second.nQuotes ) );
+    }
+  }
+  else {
+    for ( ; ( map.end() != iterAsk ) && Better( eSide, iterAsk->first ) && ( m_nTop > vLevel.size() ); ++iterAsk ) {
+      vLevel.push_back( Level( iterAsk->first * m_dblTickSize, iterAsk->second.nVolume, iterAsk->second.nQuotes ) );
+    }
+  }
+  const bool bBeyond( !vLevel.empty() );  // changes in the map change the top
+  if ( 0 <= side.ixBest ) {
+    const int step = bBid ? -1 : 1;
+    const int ixEnd = bBid ? -1 : static_cast<int>( side.vSlot.size() );
+    for ( int ix = side.ixBest; ( ixEnd != ix ) && ( m_nTop > vLevel.size() ); ix += step ) {
+      const Slot& slot( side.vSlot[ ix ] );
+      if ( 0 != slot.nQuotes ) {
+        vLevel.push_back( Level( Price( ix ), slot.nVolume, slot.nQuotes ) );
+        if ( m_nTop == vLevel.size() ) return bBeyond ? -1 : ix;
+      }
+    }
+  }
+  // on into the map, its remaining levels are worse than those in the array
+  if ( bBid ) {
+    for ( ; ( map.rend() != iterBid ) && ( m_nTop > vLevel.size() ); ++iterBid ) {
+      vLevel.push_back( Level( iterBid->first * m_dblTickSize, iterBid->second.nVolume, iterBid->second.nQuotes ) );
+    }
+  }
+  else {
+    for ( ; ( map.end() != iterAsk ) && ( m_nTop > vLevel.size() ); ++iterAsk ) {
+      vLevel.push_back( Level( iterAsk->first * m_dblTickSize, iterAsk->second.nVolume, iterAsk->second.nQuotes ) );
+    }
+  }
+  return -1;
+}
+
+void OrderBook::GetTop( Top& top ) const {
+  top.dt = m_dtLast;
+  FillTop( MarketDepth::Bid, top.vBid );
+  FillTop( MarketDepth::Ask, top.vAsk );
+}
+
+OrderBook::price_t OrderBook::BestBid( void ) const {
+  tick_t tick;
+  return BestTick( MarketDepth::Bid, tick ) ? tick * m_dblTickSize : 0.0;
+}
+
+OrderBook::price_t OrderBook::BestAsk( void ) const {
+  tick_t tick;
+  return BestTick( MarketDepth::Ask, tick ) ? tick * m_dblTickSize : 0.0;
+}
+
+} // namespace tf
+} // namespace ou
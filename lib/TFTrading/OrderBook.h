@@ -0,0 +1,175 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+// Started 2026/10/18
+
+// a book of market maker quotes, as level 2 feeds send them: each market maker has at most one bid and one ask,
+//   and each update replaces that market maker's quote on its side
+// the quotes are aggregated into price levels, held in an array per side, indexed by the price in ticks,
+//   offset from a base, so applying an update touches two array entries and one market maker entry
+//   the market makers are found through a small open addressed table of their ids
+//   the best level moves with the updates, when it empties, the scan for the next is over the gap to it
+//   a price outside the array re-bases it, growing it if the quotes no longer fit, this rebuilds from the market maker table,
+//     the array grows to at most nWindowMax slots, levels beyond it, away from the inside, are kept in a map per side,
+//     a quote better than the array, or an array side emptied with levels in the map, re-centres it on the inside
+//   an inside wider than nWindowMax, as with a lone stub quote, or a bad price, centres the array on the best of the side
+//     with more quotes, the levels of either side beyond the array, better or worse, go to its map,
+//     the array is re-centred once the inside fits again
+//   a price beyond 1e15 ticks is not taken
+// events:
+//   OnChange: each level whose volume changed, as the updates are applied
+//   OnTop: the top levels of both sides, at the end of a group of updates which changed them
+// not synchronized: updates, queries, and events are expected on one thread, the feed's
+
+#include <map>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <OUCommon/Delegate.h>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class OrderBook {
+public:
+
+  typedef MarketDepth::MMID_t MMID_t;
+  typedef MarketDepth::ESide ESide;
+  typedef MarketDepth::price_t price_t;
+  typedef MarketDepth::volume_t volume_t;
+
+  struct Level {
+    price_t dblPrice;
+    volume_t nVolume;  // across the market makers at the price
+    unsigned int nQuotes;  // market makers at the price
+    Level( void ): dblPrice( 0.0 ), nVolume( 0 ), nQuotes( 0 ) {};
+    Level( price_t dblPrice_, volume_t nVolume_, unsigned int nQuotes_ )
+      : dblPrice( dblPrice_ ), nVolume( nVolume_ ), nQuotes( nQuotes_ ) {};
+  };
+  typedef std::vector<Level> vLevel_t;
+
+  struct Top {
+    boost::posix_time::ptime dt;  // of the last update applied
+    vLevel_t vBid;  // best first
+    vLevel_t vAsk;  // best first
+  };
+
+  struct Change {
+    boost::posix_time::ptime dt;
+    ESide eSide;
+    Level level;  // as it now is, no volume and no quotes when it emptied
+  };
+
+  explicit OrderBook( price_t dblTickSize = 0.01, unsigned int nTop = 10, unsigned int nWindow = 4096, unsigned int nWindowMax = 65536 );
+  ~OrderBook( void );
+
+  // replaces the market maker's quote on the side, a quote with no price or no volume withdraws it
+  //   false when the quote changed nothing: it repeats the market maker's last, or withdraws one not there
+  bool Update( const boost::posix_time::ptime& dt, ESide eSide, MMID_t mmid, price_t dblPrice, volume_t nVolume );
+  bool Update( const MarketDepth& md ) { return Update( md.DateTime(), md.m_eSide, md.MMID(), md.Price(), md.Volume() ); };
+
+  void EndOfGroup( void );  // OnTop, when the top levels changed since the last group
+  void Clear( void );
+
+  price_t BestBid( void ) const;  // 0 when there is none
+  price_t BestAsk( void ) const;  // 0 when there is none
+  std::size_t Levels( ESide eSide ) const { return m_rSide[ eSide ].nLevels + m_rSide[ eSide ].mapOutside.size(); };
+  std::size_t MarketMakers( void ) const { return m_vMarketMaker.size(); };
+  void GetTop( Top& top ) const;
+
+  ou::Delegate<const Change&> OnChange;
+  ou::Delegate<const Top&> OnTop;
+
+protected:
+private:
+
+  typedef boost::int64_t tick_t;
+
+  struct Slot {  // a price level, kept to eight bytes, the volume at a price fits in 32 bits
+    boost::uint32_t nVolume;
+    boost::uint32_t nQuotes;
+    Slot( void ): nVolume( 0 ), nQuotes( 0 ) {};
+  };
+  typedef std::vector<Slot> vSlot_t;
+  typedef std::map<tick_t, Slot> mapSlot_t;
+
+  struct Side {
+    vSlot_t vSlot;  // indexed by tick - m_tickBase
+    mapSlot_t mapOutside;  // levels beyond the array, all worse than those in it
+    int ixBest;  // -1 when the array side is empty
+    int ixTopEdge;  // the worst level of the last top published, changes at it, or better, change the top, -1 when it reached the map
+    std::size_t nLevels;  // not empty, in the array
+    Side( void ): ixBest( -1 ), ixTopEdge( -1 ), nLevels( 0 ) {};
+  };
+
+  struct Quote {
+    tick_t tick;
+    volume_t nVolume;
+    bool bActive;
+    Quote( void ): tick( 0 ), nVolume( 0 ), bActive( false ) {};
+  };
+
+  struct MarketMaker {
+    MMID_t mmid;
+    Quote rQuote[ 2 ];  // Bid, Ask
+    MarketMaker( MMID_t mmid_ ): mmid( mmid_ ) {};
+  };
+  typedef std::vector<MarketMaker> vMarketMaker_t;
+
+  price_t m_dblTickSize;
+  unsigned int m_nTop;
+  unsigned int m_nWindow;  // slots per side
+  const unsigned int m_nWindowMax;
+
+  bool m_bBased;  // m_tickBase is set
+  bool m_bWide;  // the inside is wider than m_nWindowMax, the maps may hold levels better than the array
+  tick_t m_tickBase;
+
+  Side m_rSide[ 2 ];  // Bid, Ask
+  bool m_bTopChanged;
+  boost::posix_time::ptime m_dtLast;
+
+  vMarketMaker_t m_vMarketMaker;
+  std::vector<boost::uint32_t> m_vMarketMakerSlot;  // open addressed on the mmid, index + 1 into m_vMarketMaker, 0 is empty
+
+  Top m_top;  // reused for each OnTop
+
+  MarketMaker& FindMarketMaker( MMID_t mmid );  // adds it when not present
+  void PlaceMarketMaker( MMID_t mmid, boost::uint32_t ix );
+
+  tick_t Tick( price_t dblPrice ) const;
+  price_t Price( int ix ) const { return ( m_tickBase + ix ) * m_dblTickSize; };
+  bool InWindow( tick_t tick ) const { return m_bBased && ( m_tickBase <= tick ) && ( tick < m_tickBase + m_nWindow ); };
+  void Rebase( void );  // re-centred on the quotes, the array is kept as it is while they fit
+  bool Better( ESide eSide, tick_t tick ) const;  // beyond the array, on the side of the inside
+  bool BestTick( ESide eSide, tick_t& tick ) const;  // false when the side is empty
+  bool InsideFits( void ) const;  // in m_nWindowMax, or a side is empty
+
+  void AddTick( ESide eSide, tick_t tick, volume_t nVolume );  // to the array, or the map
+  void RemoveTick( ESide eSide, tick_t tick, volume_t nVolume );
+  void Add( ESide eSide, int ix, volume_t nVolume );
+  void Remove( ESide eSide, int ix, volume_t nVolume );
+  void NoteTop( ESide eSide, int ix );
+  void EmitChange( ESide eSide, tick_t tick );
+  int FillTop( ESide eSide, vLevel_t& vLevel ) const;  // the index of the worst level, -1 when the side has fewer than m_nTop
+};
+
+} // namespace tf
+} // namespace ou
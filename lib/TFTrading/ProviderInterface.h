@@ -24,6 +24,7 @@
 
 #include "KeyTypes.h"
 #include "Symbol.h"
+#include "SymbolDispatch.h"
 #include "Order.h"
 #include "OrderManager.h"
 
@@ -185,6 +186,10 @@ protected:
   typedef std::pair<symbol_id_t, pSymbol_t> pair_mapSymbols_t;
   mapSymbols_t m_mapSymbols;
 
+  // 2026/10/18 the symbols of m_mapSymbols by id, for resolving incoming messages without building a string
+  SymbolDispatch<S*> m_dispatchSymbols;
+  S* LookupSymbol( const char* pId, std::size_t nId ) const { return m_dispatchSymbols.Find( pId, nId ); }; // 0 when not present
+
   //void Connecting( void );
   void ConnectionComplete( void );
   void Disconnecting( void );
@@ -226,6 +231,7 @@ ProviderInterface<P,S>::~ProviderInterface(void) {
     ++iter;
   }
   */
+  m_dispatchSymbols.Clear();
   m_mapSymbols.clear();
 }
 
@@ -281,6 +287,7 @@ typename ProviderInterface<P,S>::pSymbol_t ProviderInterface<P,S>::AddCSymbol( p
     m_mapSymbols.insert( pair_mapSymbols_t( pSymbol->GetId(), pSymbol ) );
     iter = m_mapSymbols.find( pSymbol->GetId() );
     assert( m_mapSymbols.end() != iter );
+    m_dispatchSymbols.Insert( pSymbol->GetId(), pSymbol.get() );
   }
   else {
     throw std::runtime_error( "AddCSymbol " + pSymbol->GetId() + " symbol already exists in provider" );
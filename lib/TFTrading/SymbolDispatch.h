@@ -0,0 +1,146 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+// Started 2026/10/18
+
+// symbol id to symbol, for providers resolving the symbol of each incoming message
+//   looked up with the raw bytes of the id, as they sit in the message, so no string is built
+//   open addressing with linear probing, the table is kept at most half full, and is rebuilt when it doubles
+//   each slot carries the full hash, so a probe only compares ids when the hashes match
+// threading: Find runs on any number of threads, without locks, while Insert and Clear run on another
+//   a slot is filled before its value is published, and is never rewritten, so a reader seeing the value sees the id
+//   a larger, or a cleared, table is built aside and published, the one replaced is retired, not freed,
+//     as a reader may still be probing it, retired tables go with the dispatch
+//   inserts and clears are serialized among themselves
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/lock_guard.hpp>
+
+#include <OUCommon/SpinLock.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+template <typename V> // V is a pointer, 0 is not present
+class SymbolDispatch: boost::noncopyable {
+public:
+
+  SymbolDispatch( void ): m_nEntries( 0 ), m_pTable( new Table( 64 ) ) {};
+  ~SymbolDispatch( void ) {
+    delete m_pTable.load( boost::memory_order_relaxed );
+    for ( typename vTable_t::iterator iter = m_vRetired.begin(); m_vRetired.end() != iter; ++iter ) delete *iter;
+  };
+
+  static boost::uint64_t Hash( const char* pId, std::size_t nId ) { // fnv-1a
+    boost::uint64_t hash( 14695981039346656037ULL );
+    for ( const char* p = pId, *e = pId + nId; p != e; ++p ) {
+      hash ^= static_cast<unsigned char>( *p );
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  V Find( const char* pId, std::size_t nId ) const { // 0 when not present
+    const Table* pTable = m_pTable.load( boost::memory_order_acquire );
+    return pTable->Find( Hash( pId, nId ), pId, nId );
+  }
+
+  V Find( const std::string& sId ) const { return Find( sId.data(), sId.size() ); };
+
+  bool Insert( const std::string& sId, V value ) { // false, and unchanged, when already present
+    boost::lock_guard<ou::SpinLock> lock( m_spinlockWriter );
+    const boost::uint64_t hash = Hash( sId.data(), sId.size() );
+    Table* pTable = m_pTable.load( boost::memory_order_relaxed );
+    if ( 0 != pTable->Find( hash, sId.data(), sId.size() ) ) return false;
+    if ( pTable->nSlots < 2 * ( m_nEntries + 1 ) ) {
+      Table* pLarger = new Table( 2 * pTable->nSlots );
+      for ( std::size_t ix = 0; ix < pTable->nSlots; ++ix ) {
+        const Slot& slot( pTable->rSlot[ ix ] );
+        V v = slot.value.load( boost::memory_order_relaxed );
+        if ( 0 != v ) pLarger->Place( slot.hash, slot.sId, v );
+      }
+      Retire( pLarger );
+      pTable = pLarger;
+    }
+    pTable->Place( hash, sId, value );
+    ++m_nEntries;
+    return true;
+  }
+
+  std::size_t Size( void ) const { return m_nEntries; };
+
+  void Clear( void ) {
+    boost::lock_guard<ou::SpinLock> lock( m_spinlockWriter );
+    Retire( new Table( m_pTable.load( boost::memory_order_relaxed )->nSlots ) );
+    m_nEntries = 0;
+  }
+
+protected:
+private:
+
+  struct Slot {
+    boost::uint64_t hash;
+    std::string sId;
+    boost::atomic<V> value;  // published last, with release
+    Slot( void ): hash( 0 ), value( 0 ) {};
+  };
+
+  struct Table: boost::noncopyable {
+    const std::size_t nSlots;
+    const std::size_t mask;
+    Slot* rSlot;
+    explicit Table( std::size_t nSlots_ ): nSlots( nSlots_ ), mask( nSlots_ - 1 ), rSlot( new Slot[ nSlots_ ] ) {};
+    ~Table( void ) { delete [] rSlot; };
+    V Find( boost::uint64_t hash, const char* pId, std::size_t nId ) const {
+      for ( std::size_t ix = hash & mask; ; ix = ( ix + 1 ) & mask ) {
+        const Slot& slot( rSlot[ ix ] );
+        V value = slot.value.load( boost::memory_order_acquire );
+        if ( 0 == value ) return 0;
+        if ( ( hash == slot.hash ) && ( nId == slot.sId.size() ) && ( 0 == std::memcmp( pId, slot.sId.data(), nId ) ) ) {
+          return value;
+        }
+      }
+    }
+    void Place( boost::uint64_t hash, const std::string& sId, V value ) {
+      std::size_t ix = hash & mask;
+      while ( 0 != rSlot[ ix ].value.load( boost::memory_order_relaxed ) ) ix = ( ix + 1 ) & mask;
+      Slot& slot( rSlot[ ix ] );
+      slot.hash = hash;
+      slot.sId = sId;
+      slot.value.store( value, boost::memory_order_release );
+    }
+  };
+  typedef std::vector<Table*> vTable_t;
+
+  std::size_t m_nEntries;
+  boost::atomic<Table*> m_pTable;
+  vTable_t m_vRetired;  // replaced tables, readers may still be in them
+  ou::SpinLock m_spinlockWriter;
+
+  void Retire( Table* pTable ) { // publishes pTable, keeps the one it replaces
+    m_vRetired.push_back( m_pTable.exchange( pTable, boost::memory_order_acq_rel ) );
+  }
+
+};
+
+} // namespace tf
+} // namespace ou
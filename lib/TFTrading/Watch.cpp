@@ -16,6 +16,7 @@
 
 #include <TFHDF5TimeSeries/HDF5DataManager.h>
 #include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesAppender.h>
 #include <TFHDF5TimeSeries/HDF5IterateGroups.h>
 #include <TFHDF5TimeSeries/HDF5Attribute.h>
 
@@ -31,7 +32,8 @@ namespace tf { // TradeFrame
 Watch::Watch( pInstrument_t pInstrument, pProvider_t pDataProvider ) :
   m_pInstrument( pInstrument ), 
   m_pDataProvider( pDataProvider ), 
-  m_cntWatching( 0 ), m_bWatching( false ), m_bWatchingEnabled( false )
+  m_cntWatching( 0 ), m_bRetainSeries( true ), m_pQuoteAppender( 0 ), m_pTradeAppender( 0 ),
+  m_bWatchingEnabled( false ), m_bWatching( false )
 {
   assert( 0 != pInstrument.get() );
   assert( 0 != pDataProvider.get() );
@@ -39,10 +41,11 @@ Watch::Watch( pInstrument_t pInstrument, pProvider_t pDataProvider ) :
 }
 
 Watch::Watch( const Watch& rhs ) :
+  m_quote( rhs.m_quote ), m_trade( rhs.m_trade ), 
   m_pInstrument( rhs.m_pInstrument ),
   m_pDataProvider( rhs.m_pDataProvider ),
-  m_quote( rhs.m_quote ), m_trade( rhs.m_trade ), 
-  m_cntWatching( 0 ), m_bWatching( false ), m_bWatchingEnabled( false )
+  m_cntWatching( 0 ), m_bRetainSeries( true ), m_pQuoteAppender( 0 ), m_pTradeAppender( 0 ),
+  m_bWatchingEnabled( false ), m_bWatching( false )
 {
   assert( 0 == rhs.m_cntWatching );
   assert( !rhs.m_bWatching );
@@ -53,6 +56,7 @@ Watch::~Watch(void) {
   while ( 0 != m_cntWatching ) {
     StopWatch();
   }
+  StopRecording();
 }
 
 Watch& Watch::operator=( const Watch& rhs ) {
@@ -60,6 +64,7 @@ Watch& Watch::operator=( const Watch& rhs ) {
   assert( 0 == m_cntWatching );
   assert( !rhs.m_bWatching );
   assert( !m_bWatching );
+  assert( !Recording() );
   m_pInstrument = rhs.m_pInstrument;
   m_pDataProvider = rhs.m_pDataProvider;
   m_cntWatching = 0;
@@ -184,7 +189,8 @@ void Watch::EmitValues( void ) const {
 void Watch::HandleQuote( const Quote& quote ) {
   m_quote = quote;
   //OnPossibleResizeBegin( stateTimeSeries_t( m_quotes.Capacity(), m_quotes.Size() ) );
-  {
+  if ( 0 != m_pQuoteAppender ) m_pQuoteAppender->Append( quote );
+  if ( m_bRetainSeries ) {
     //boost::mutex::scoped_lock lock(m_mutexLockAppend);
     m_quotes.Append( quote );
   }
@@ -197,7 +203,8 @@ void Watch::HandleQuote( const Quote& quote ) {
 void Watch::HandleTrade( const Trade& trade ) {
   m_trade = trade;
   //OnPossibleResizeBegin( stateTimeSeries_t( m_trades.Capacity(), m_trades.Size() ) );
-  {
+  if ( 0 != m_pTradeAppender ) m_pTradeAppender->Append( trade );
+  if ( m_bRetainSeries ) {
     //boost::mutex::scoped_lock lock(m_mutexLockAppend);
     m_trades.Append( trade );
   }
@@ -234,26 +241,28 @@ void Watch::SaveSeries( const std::string& sPrefix ) {
 
   try {
 
-    if ( 0 != m_quotes.Size() ) {
-      sPathName = sPrefix + "/quotes/" + m_pInstrument->GetInstrumentName();
-      HDF5WriteTimeSeries<ou::tf::Quotes> wtsQuotes( dm, true, true, 5, 256 );
-      wtsQuotes.Write( sPathName, &m_quotes );
-      HDF5Attributes attrQuotes( dm, sPathName );
-      attrQuotes.SetSignature( ou::tf::Quote::Signature() );
-      attrQuotes.SetMultiplier( m_pInstrument->GetMultiplier() );
-      attrQuotes.SetSignificantDigits( m_pInstrument->GetSignificantDigits() ); 
-      attrQuotes.SetProviderType( m_pDataProvider->ID() );
+    if ( Recording() ) { // already on disk, with attributes
+      m_pQuoteAppender->Flush();
+      m_pTradeAppender->Flush();
+      if ( ( sPrefix != m_sRecordPrefix ) && !m_bRetainSeries ) {  // 2026/10/18 nothing in memory to write under sPrefix
+        std::cout << "Watch::SaveSeries " << m_pInstrument->GetInstrumentName() << ": not retained, only recorded in " << m_sRecordPrefix << std::endl;
+      }
     }
-
-    if ( 0 != m_trades.Size() ) {
-      sPathName = sPrefix + "/trades/" + m_pInstrument->GetInstrumentName();
-      HDF5WriteTimeSeries<ou::tf::Trades> wtsTrades( dm, true, true, 5, 256 );
-      wtsTrades.Write( sPathName, &m_trades );
-      HDF5Attributes attrTrades( dm, sPathName );
-      attrTrades.SetSignature( ou::tf::Trade::Signature() );
-      attrTrades.SetMultiplier( m_pInstrument->GetMultiplier() );
-      attrTrades.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
-      attrTrades.SetProviderType( m_pDataProvider->ID() );
+    if ( !Recording() || ( m_bRetainSeries && ( sPrefix != m_sRecordPrefix ) ) ) {
+
+      if ( 0 != m_quotes.Size() ) {
+        sPathName = sPrefix + "/quotes/" + m_pInstrument->GetInstrumentName();
+        HDF5WriteTimeSeries<quotes_t> wtsQuotes( dm, true, true, 5, 256 );
+        wtsQuotes.Write( sPathName, &m_quotes );
+        SetSeriesAttributes( dm, sPathName, ou::tf::Quote::Signature() );
+      }
+
+      if ( 0 != m_trades.Size() ) {
+        sPathName = sPrefix + "/trades/" + m_pInstrument->GetInstrumentName();
+        HDF5WriteTimeSeries<trades_t> wtsTrades( dm, true, true, 5, 256 );
+        wtsTrades.Write( sPathName, &m_trades );
+        SetSeriesAttributes( dm, sPathName, ou::tf::Trade::Signature() );
+      }
     }
 
   }
@@ -263,6 +272,52 @@ void Watch::SaveSeries( const std::string& sPrefix ) {
 
 }
 
+void Watch::SetSeriesAttributes( HDF5DataManager& dm, const std::string& sPathName, boost::uint64_t signature ) {
+  HDF5Attributes attr( dm, sPathName );
+  attr.SetSignature( signature );
+  attr.SetMultiplier( m_pInstrument->GetMultiplier() );
+  attr.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
+  attr.SetProviderType( m_pDataProvider->ID() );
+}
+
+void Watch::RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix, bool bRetain ) {
+  assert( !Recording() );
+  m_bRetainSeries = bRetain;
+  m_sRecordPrefix = sPrefix;
+  m_pTradeAppender = new HDF5TimeSeriesAppender<Trade>( 
+    writer, sPrefix + "/trades/" + m_pInstrument->GetInstrumentName(), 256, 5, MakeDelegate( this, &Watch::HandleTradesCreated ) );
+  m_pQuoteAppender = new HDF5TimeSeriesAppender<Quote>( 
+    writer, sPrefix + "/quotes/" + m_pInstrument->GetInstrumentName(), 256, 5, MakeDelegate( this, &Watch::HandleQuotesCreated ) );
+}
+
+void Watch::StopRecording( void ) {  // stop watching first
+  if ( Recording() ) {
+    delete m_pQuoteAppender;
+    m_pQuoteAppender = 0;
+    delete m_pTradeAppender;
+    m_pTradeAppender = 0;
+    m_bRetainSeries = true;
+  }
+}
+
+// writer thread
+void Watch::HandleQuotesCreated( HDF5DataManager& dm, const std::string& sPathName ) {
+  try {
+    SetSeriesAttributes( dm, sPathName, ou::tf::Quote::Signature() );
+  }
+  catch (...) {  // may already exist
+  }
+}
+
+// writer thread
+void Watch::HandleTradesCreated( HDF5DataManager& dm, const std::string& sPathName ) {
+  try {
+    SetSeriesAttributes( dm, sPathName, ou::tf::Trade::Signature() );
+  }
+  catch (...) {  // may already exist
+  }
+}
+
 
 } // namespace tf
 } // namespace ou
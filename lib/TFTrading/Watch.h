@@ -35,6 +35,10 @@
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+class HDF5DataManager;
+class HDF5AppendWriter;
+template<class DD> class HDF5TimeSeriesAppender;
+
 class Watch {
 public:
 
@@ -82,8 +86,12 @@ public:
   const Fundamentals_t& Fundamentals( void ) const { return m_fundamentals; };
   const Summary_t& Summary( void ) const { return m_summary; };
 
-  const Quotes& GetQuotes( void ) const { return m_quotes; };
-  const Trades& GetTrades( void ) const { return m_trades; };
+  // 2026/10/18 held in blocks, a long session neither copies nor moves what it has gathered as it grows
+  typedef SegmentedTimeSeries<Quote> quotes_t;
+  typedef SegmentedTimeSeries<Trade> trades_t;
+
+  const quotes_t& GetQuotes( void ) const { return m_quotes; };
+  const trades_t& GetTrades( void ) const { return m_trades; };
 
   ou::Delegate<const Quote&> OnQuote;
   ou::Delegate<const Trade&> OnTrade;
@@ -99,6 +107,15 @@ public:
 
   virtual void SaveSeries( const std::string& sPrefix );
 
+  // quotes and trades are written under sPrefix as they arrive, rather than all at once by SaveSeries,
+  //   bRetain keeps them in GetQuotes/GetTrades as well, otherwise memory used by the watch stays bounded
+  //   start before watching, SaveSeries then only needs to flush what has been recorded,
+  //   SaveSeries with some other prefix writes the retained series there as well, there is nothing to write when not retained
+  virtual void RecordSeries( HDF5AppendWriter& writer, const std::string& sPrefix, bool bRetain = false );
+  virtual void StopRecording( void ); // writes what remains
+  bool Recording( void ) const { return 0 != m_pQuoteAppender; };
+  const std::string& RecordPrefix( void ) const { return m_sRecordPrefix; };  // 2026/10/18 valid while Recording()
+
 protected:
 
   // use an iterator instead?  or keep as is as it facilitates multi-thread append and access operations
@@ -107,8 +124,8 @@ protected:
   ou::tf::Quote m_quote;
   ou::tf::Trade m_trade;
 
-  ou::tf::Quotes m_quotes;
-  ou::tf::Trades m_trades;
+  quotes_t m_quotes;
+  trades_t m_trades;
 
   pInstrument_t m_pInstrument;
 
@@ -117,9 +134,21 @@ protected:
   std::stringstream m_ss;
 
   unsigned int m_cntWatching;
+
+  bool m_bRetainSeries;
+
+  // signature, multiplier, significant digits, provider
+  virtual void SetSeriesAttributes( HDF5DataManager& dm, const std::string& sPathName, boost::uint64_t signature );
   
 private:
 
+  HDF5TimeSeriesAppender<Quote>* m_pQuoteAppender;
+  HDF5TimeSeriesAppender<Trade>* m_pTradeAppender;
+  std::string m_sRecordPrefix;
+
+  void HandleQuotesCreated( HDF5DataManager& dm, const std::string& sPathName );
+  void HandleTradesCreated( HDF5DataManager& dm, const std::string& sPathName );
+
   bool m_bWatchingEnabled;
   bool m_bWatching; // in/out of connected state
   
@@ -56,6 +56,7 @@ OBJECTFILES= \
 	${OBJECTDIR}/Managers.o \
 	${OBJECTDIR}/NoRiskInterestRateSeries.o \
 	${OBJECTDIR}/Order.o \
+	${OBJECTDIR}/OrderBook.o \
 	${OBJECTDIR}/OrderManager.o \
 	${OBJECTDIR}/OrdersOutstanding.o \
 	${OBJECTDIR}/Portfolio.o \
@@ -201,6 +202,11 @@ ${OBJECTDIR}/Order.o: Order.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/Order.o Order.cpp
 
+${OBJECTDIR}/OrderBook.o: OrderBook.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -D_DEBUG -I../ -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/OrderBook.o OrderBook.cpp
+
 ${OBJECTDIR}/OrderManager.o: OrderManager.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
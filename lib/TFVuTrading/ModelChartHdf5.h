@@ -78,6 +78,28 @@ public:
 
   }
 
+  // as above, for the rows from dtBegin up to, but not including, dtEnd, 
+  //   the dataset's time index locates them, so only those rows are read
+  template<typename TS> // TS=timeseries
+  void ChartTimeSeries( 
+    ou::tf::HDF5DataManager* pdm, ou::ChartDataView* pChartDataView, const std::string& sName, const std::string& sPath,
+    const ptime& dtBegin, const ptime& dtEnd ) {
+
+    pChartDataView->SetNames( sName, sPath );
+
+    ou::tf::HDF5TimeSeriesContainer<typename TS::datum_t> tsRepository( *pdm, sPath );
+    typename ou::tf::HDF5TimeSeriesContainer<typename TS::datum_t>::iterator begin, end;
+    begin = tsRepository.LowerBound( tsRepository.begin(), tsRepository.end(), dtBegin );
+    end = tsRepository.LowerBound( begin, tsRepository.end(), dtEnd );
+    hsize_t cnt = end - begin;
+    TS series;
+    series.Resize( cnt );
+    tsRepository.Read( begin, end, &series );
+
+    AddChartEntries( pChartDataView, series );
+
+  }
+
   // Normal timeseries plus equities/options structs can be used here:
   template<typename TS> // TS=timeseries
   void ChartTimeSeries( ou::ChartDataView* pChartDataView, const TS& series, const std::string& sName, const std::string& sDescription ) {
@@ -30,6 +30,12 @@
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+namespace {
+  // 2026/10/18 with recent only, how much of a dataset is charted, ending with its last row
+  const time_duration c_tdTickWindow( hours( 24 ) );  // quotes, trades, greeks, ivs: the last day
+  const time_duration c_tdBarWindow( hours( 24 * 365 ) );  // bars: the last year
+}
+
 PanelChartHdf5::PanelChartHdf5(void): m_pChartDataView( 0 ), m_winChart( 0 ), m_pdm( 0 ) {
   Init();
 }
@@ -48,6 +54,7 @@ PanelChartHdf5::~PanelChartHdf5(void) {
 }
 
 void PanelChartHdf5::Init() {
+  m_bRecentOnly = false;
 }
 
 bool PanelChartHdf5::Create( wxWindow* parent, wxWindowID id, const wxPoint& pos, const wxSize& size, long style ) {
@@ -261,19 +268,19 @@ void PanelChartHdf5::LoadDataAndGenerateChart( CustomItemData::enumDatumType edt
   else {
     switch ( edt ) {
     case CustomItemData::Bars:
-      m_ModelChartHdf5.ChartTimeSeries<Bars>( m_pdm, m_pChartDataView, "Bars", sPath );
+      Chart<Bars>( "Bars", sPath, c_tdBarWindow );
       break;
     case CustomItemData::Quotes:
-      m_ModelChartHdf5.ChartTimeSeries<Quotes>( m_pdm, m_pChartDataView, "Quotes", sPath );
+      Chart<Quotes>( "Quotes", sPath, c_tdTickWindow );
       break;
     case CustomItemData::Trades:
-      m_ModelChartHdf5.ChartTimeSeries<Trades>( m_pdm, m_pChartDataView, "Trades", sPath );
+      Chart<Trades>( "Trades", sPath, c_tdTickWindow );
       break;
     case CustomItemData::AtmIV:
-      m_ModelChartHdf5.ChartTimeSeries<PriceIVs>( m_pdm, m_pChartDataView, "Price IV", sPath );
+      Chart<PriceIVs>( "Price IV", sPath, c_tdTickWindow );
       break;
     case CustomItemData::Greeks:
-      m_ModelChartHdf5.ChartTimeSeries<Greeks>( m_pdm, m_pChartDataView, "Greeks", sPath );
+      Chart<Greeks>( "Greeks", sPath, c_tdTickWindow );
       break;
     default:
       throw std::runtime_error("unknown CustomItemData");
@@ -52,6 +52,10 @@ public:
   wxIcon GetIconResource( const wxString& name );
   static bool ShowToolTips() { return true; };
 
+  // 2026/10/18 whole series are charted by default, recent only charts the last day of ticks, or year of bars
+  void SetChartRecentOnly( bool bRecentOnly ) { m_bRecentOnly = bRecentOnly; };
+  bool GetChartRecentOnly( void ) const { return m_bRecentOnly; };
+
 protected:
 
   void Init();
@@ -77,6 +81,8 @@ private:
 
   ModelChartHdf5 m_ModelChartHdf5;
 
+  bool m_bRecentOnly;
+
   std::string m_sCurrentPath;  // used while traversing and building tree
   wxTreeItemId m_curTreeItem; // used while traversing and building tree
   CustomItemData::enumDatumType m_eLatestDatumType;  // need this until all timeseries have a signature attribute associated
@@ -87,6 +93,23 @@ private:
 
   void LoadDataAndGenerateChart( CustomItemData::enumDatumType, const std::string& sPath );
 
+  // 2026/10/18 charts the whole series, or with m_bRecentOnly, the tdWindow ending with the series' last row
+  template<typename TS> // TS=timeseries
+  void Chart( const std::string& sName, const std::string& sPath, const time_duration& tdWindow ) {
+    if ( !m_bRecentOnly ) {
+      m_ModelChartHdf5.ChartTimeSeries<TS>( m_pdm, m_pChartDataView, sName, sPath );
+      return;
+    }
+    ptime dtBegin( boost::posix_time::neg_infin );
+    {
+      ou::tf::HDF5TimeSeriesAccessor<typename TS::datum_t> accessor( *m_pdm, sPath );
+      if ( 0 < accessor.size() ) {
+        dtBegin = accessor.Fetch( accessor.size() - 1 ).DateTime() - tdWindow;
+      }
+    }
+    m_ModelChartHdf5.ChartTimeSeries<TS>( m_pdm, m_pChartDataView, sName, sPath, dtBegin, boost::posix_time::pos_infin );
+  }
+
   void HandleLoadTreeHdf5Group( const std::string& s1, const std::string& s2 );
   void HandleLoadTreeHdf5Object( const std::string& s1, const std::string& s2 );
 